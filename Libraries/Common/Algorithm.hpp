@@ -343,6 +343,104 @@ void Sort(range r, Comparer comparer)
   QuickSort(r.Begin(), r.End(), &r.Front(), comparer);
 }
 
+// Compares values by the keys a radix sort key function returns
+template <typename KeyFunction>
+struct RadixKeyLess
+{
+  RadixKeyLess(KeyFunction& keyFunction) : mKeyFunction(keyFunction)
+  {
+  }
+
+  template <typename type>
+  bool operator()(const type& left, const type& right)
+  {
+    return mKeyFunction(left) < mKeyFunction(right);
+  }
+
+  KeyFunction& mKeyFunction;
+};
+
+const size_t cRadixSortBits = 8;
+const size_t cRadixSortBuckets = 1 << cRadixSortBits;
+
+// Stable least significant digit radix sort of a contiguous range by the
+// unsigned integer key that keyFunction(value) returns (smallest key first).
+// The scratch array is resized to the size of the range, keep it around
+// between sorts so that sorting doesn't allocate. Digits that are the same in
+// every key are skipped, so keys that only use some of their bits (such as
+// small ids packed into the upper bits) only pay for the bits they use.
+template <typename range, typename ScratchArrayType, typename KeyFunction>
+void RadixSort(range r, ScratchArrayType& scratch, KeyFunction keyFunction)
+{
+  // if you see an error on this line, odds are you passed in an array instead
+  // of array.All()
+  size_t temp = sizeof(typename range::contiguousRangeType);
+  UnusedParameter(temp);
+
+  typedef typename range::value_type type;
+  typedef decltype(keyFunction(r.Front())) KeyType;
+  const size_t cPassCount = sizeof(KeyType) * 8 / cRadixSortBits;
+  const size_t cMask = cRadixSortBuckets - 1;
+
+  size_t count = r.End() - r.Begin();
+  if (count < 2)
+    return;
+
+  // Counting and scattering isn't worth it for small ranges (insertion sort is
+  // also stable)
+  if (count <= cSortLimit)
+  {
+    InsertionSort(r.Begin(), r.End(), RadixKeyLess<KeyFunction>(keyFunction), &r.Front());
+    return;
+  }
+
+  // Count every digit of every key in one pass over the values
+  size_t bucketStarts[cPassCount][cRadixSortBuckets];
+  memset(bucketStarts, 0, sizeof(bucketStarts));
+  for (type* it = r.Begin(); it != r.End(); ++it)
+  {
+    KeyType key = keyFunction(*it);
+    for (size_t pass = 0; pass < cPassCount; ++pass)
+      ++bucketStarts[pass][(key >> (pass * cRadixSortBits)) & cMask];
+  }
+
+  scratch.Resize(count);
+  type* source = r.Begin();
+  type* destination = scratch.Data();
+
+  for (size_t pass = 0; pass < cPassCount; ++pass)
+  {
+    size_t shift = pass * cRadixSortBits;
+    size_t* passStarts = bucketStarts[pass];
+
+    // Every key has the same digit so nothing would move
+    if (passStarts[(keyFunction(source[0]) >> shift) & cMask] == count)
+      continue;
+
+    // Turn the counts into the start of each bucket
+    size_t total = 0;
+    for (size_t bucket = 0; bucket < cRadixSortBuckets; ++bucket)
+    {
+      size_t bucketCount = passStarts[bucket];
+      passStarts[bucket] = total;
+      total += bucketCount;
+    }
+
+    // Scatter in order so that the sort is stable
+    for (size_t i = 0; i < count; ++i)
+      destination[passStarts[(keyFunction(source[i]) >> shift) & cMask]++] = source[i];
+
+    Swap(source, destination);
+  }
+
+  // An odd number of passes leaves the sorted values in the scratch array
+  if (source != r.Begin())
+  {
+    for (size_t i = 0; i < count; ++i)
+      r.Begin()[i] = source[i];
+  }
+}
+
 template <typename iterator>
 void Reverse(iterator start, iterator end)
 {
@@ -110,6 +110,12 @@ void BitStream::Clear(bool freeMemory)
     mAlignment = BitAlignment::Bit;
   }
 }
+void BitStream::ResetCursors()
+{
+  mBitsWritten = 0;
+  mBitsRead = 0;
+  mAlignment = BitAlignment::Bit;
+}
 
 //
 // Write Operations
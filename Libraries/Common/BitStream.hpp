@@ -122,6 +122,10 @@ public:
   /// Clears all data written and resets the bitstream, optionally freeing
   /// reserved memory
   void Clear(bool freeMemory);
+  /// Resets the read and write cursors without zeroing or freeing reserved
+  /// memory (written bits overwrite existing memory, so the stale bytes are
+  /// never read)
+  void ResetCursors();
 
   //
   // Measure Operations
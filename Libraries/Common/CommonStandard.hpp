@@ -184,10 +184,15 @@ namespace Math
 
 #include "MathToString.hpp"
 
-// Currently the SIMD extensions are not technically platform agnostic and need
-// to be revisited. It may be acceptable to include the intrinsic headers on
-// multiple platforms, but it's unknown.
-#if defined(USESSE)
+// The SIMD extensions only need SSE2, which every x64 target has. Code with an
+// SSE path checks ZeroSimdSse2 (rather than USESSE) so the path is compiled and
+// used wherever the compiler targets SSE2. Other targets (such as Emscripten)
+// use the scalar paths.
+#if defined(USESSE) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define ZeroSimdSse2
+#endif
+
+#if defined(ZeroSimdSse2)
 #  include "SimMath.hpp"
 #  include "SimVectors.hpp"
 #  include "SimMatrix3.hpp"
@@ -239,6 +244,7 @@ namespace Zero
 #include "Browser.hpp"
 #include "RendererEnumerations.hpp"
 #include "Renderer.hpp"
+#include "EmptyRenderer.hpp"
 #include "Audio.hpp"
 #include "CallStack.hpp"
 #include "WebRequest.hpp"
@@ -0,0 +1,433 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+EmptyRendererStats::EmptyRendererStats() :
+    mFrames(0),
+    mRenderTasks(0),
+    mDrawCalls(0),
+    mStateChanges(0),
+    mMaterialChanges(0),
+    mMeshUploads(0),
+    mTextureUploads(0),
+    mShaderCompiles(0),
+    mBytesUploaded(0),
+    mInvalidCommands(0)
+{
+}
+
+EmptyRenderer::EmptyRenderer() :
+    mRenderTasks(nullptr),
+    mRenderQueues(nullptr),
+    mFrameBlock(nullptr),
+    mViewBlock(nullptr),
+    mStreamedPending(false),
+    mStreamedMaterial(nullptr),
+    mStreamedTexture(nullptr),
+    mStreamedType(PrimitiveType::Triangles),
+    mActiveMaterial(nullptr),
+    mLazyShaderCompilation(false)
+{
+  // Report the same support as a typical desktop driver so that nothing is
+  // skipped for lack of support
+  mDriverSupport.mTextureCompression = true;
+  mDriverSupport.mMultiTargetBlend = true;
+  mDriverSupport.mSamplerObjects = true;
+  mDriverSupport.mIntel = false;
+}
+
+EmptyRenderer::~EmptyRenderer()
+{
+  DeleteObjectsInContainer(mMaterialRenderDataToDestroy);
+  DeleteObjectsInContainer(mMeshRenderDataToDestroy);
+  DeleteObjectsInContainer(mTextureRenderDataToDestroy);
+}
+
+void EmptyRenderer::BuildOrthographicTransform(
+    Mat4Ref matrix, float size, float aspect, float nearPlane, float farPlane)
+{
+  BuildOrthographicTransformGl(matrix, size, aspect, nearPlane, farPlane);
+}
+
+void EmptyRenderer::BuildPerspectiveTransform(Mat4Ref matrix, float fov, float aspect, float nearPlane, float farPlane)
+{
+  BuildPerspectiveTransformGl(matrix, fov, aspect, nearPlane, farPlane);
+}
+
+MaterialRenderData* EmptyRenderer::CreateMaterialRenderData()
+{
+  MaterialRenderData* renderData = new MaterialRenderData();
+  renderData->mResourceId = 0;
+  return renderData;
+}
+
+MeshRenderData* EmptyRenderer::CreateMeshRenderData()
+{
+  return new MeshRenderData();
+}
+
+TextureRenderData* EmptyRenderer::CreateTextureRenderData()
+{
+  return new TextureRenderData();
+}
+
+void EmptyRenderer::AddMaterial(AddMaterialInfo* info)
+{
+  if (info->mRenderData == nullptr)
+  {
+    mStatsLock.Lock();
+    Invalid("Material added without render data.");
+    mStatsLock.Unlock();
+    return;
+  }
+
+  info->mRenderData->mCompositeName = info->mCompositeName;
+  info->mRenderData->mResourceId = info->mMaterialId;
+}
+
+void EmptyRenderer::AddMesh(AddMeshInfo* info)
+{
+  mStatsLock.Lock();
+
+  if (info->mRenderData == nullptr)
+    Invalid("Mesh added without render data.");
+
+  if (info->mVertexData != nullptr)
+  {
+    if (info->mVertexSize == 0 || info->mVertexCount == 0)
+      Invalid("Mesh has vertex data but no vertices.");
+    if (info->mVertexAttributes.Empty())
+      Invalid("Mesh has vertex data but no vertex attributes.");
+
+    forRange (VertexAttribute& attribute, info->mVertexAttributes.All())
+    {
+      if (attribute.mOffset >= info->mVertexSize)
+        Invalid("Mesh vertex attribute is outside of the vertex.");
+    }
+
+    ++mStats.mMeshUploads;
+    mStats.mBytesUploaded += (u64)info->mVertexSize * info->mVertexCount;
+  }
+
+  if (info->mIndexData != nullptr)
+  {
+    if (info->mIndexSize != 1 && info->mIndexSize != 2 && info->mIndexSize != 4)
+      Invalid("Mesh index size is not 1, 2 or 4 bytes.");
+    if (info->mVertexData == nullptr)
+      Invalid("Mesh has index data but no vertex data.");
+
+    mStats.mBytesUploaded += (u64)info->mIndexSize * info->mIndexCount;
+  }
+
+  mStatsLock.Unlock();
+
+  delete[] info->mVertexData;
+  delete[] info->mIndexData;
+}
+
+void EmptyRenderer::AddTexture(AddTextureInfo* info)
+{
+  mStatsLock.Lock();
+
+  if (info->mRenderData == nullptr)
+    Invalid("Texture added without render data.");
+
+  if (info->mImageData != nullptr)
+  {
+    if (info->mWidth == 0 || info->mHeight == 0)
+      Invalid("Texture has image data but no size.");
+    if (info->mMipCount == 0 || info->mMipHeaders == nullptr)
+      Invalid("Texture has image data but no mip headers.");
+
+    for (uint i = 0; info->mMipHeaders != nullptr && i < info->mMipCount; ++i)
+    {
+      MipHeader& mip = info->mMipHeaders[i];
+      if ((u64)mip.mDataOffset + mip.mDataSize > info->mTotalDataSize)
+        Invalid("Texture mip data is outside of the image data.");
+    }
+
+    ++mStats.mTextureUploads;
+    mStats.mBytesUploaded += info->mTotalDataSize;
+  }
+
+  mStatsLock.Unlock();
+
+  delete[] info->mImageData;
+  delete[] info->mMipHeaders;
+}
+
+void EmptyRenderer::RemoveMaterial(MaterialRenderData* data)
+{
+  mMaterialRenderDataToDestroy.PushBack(data);
+}
+
+void EmptyRenderer::RemoveMesh(MeshRenderData* data)
+{
+  mMeshRenderDataToDestroy.PushBack(data);
+}
+
+void EmptyRenderer::RemoveTexture(TextureRenderData* data)
+{
+  mTextureRenderDataToDestroy.PushBack(data);
+}
+
+bool EmptyRenderer::GetLazyShaderCompilation()
+{
+  return mLazyShaderCompilation;
+}
+
+void EmptyRenderer::SetLazyShaderCompilation(bool isLazy)
+{
+  mLazyShaderCompilation = isLazy;
+}
+
+void EmptyRenderer::AddShaders(Array<ShaderEntry>& entries, uint forceCompileBatchCount)
+{
+  // Processed entries must be removed so that the job knows when to stop
+  uint processCount = Math::Min(forceCompileBatchCount, (uint)entries.Size());
+  if (processCount == 0)
+    processCount = entries.Size();
+
+  mStatsLock.Lock();
+  for (uint i = 0; i < processCount; ++i)
+  {
+    ShaderEntry& entry = entries[i];
+    if (entry.mVertexShader.Empty() || entry.mPixelShader.Empty())
+      Invalid("Shader is missing its vertex or pixel shader.");
+    ++mStats.mShaderCompiles;
+  }
+  mStatsLock.Unlock();
+
+  entries.Erase(entries.SubRange(0, processCount));
+}
+
+void EmptyRenderer::RemoveShaders(Array<ShaderEntry>& entries)
+{
+}
+
+void EmptyRenderer::SetVSync(bool vsync)
+{
+}
+
+void EmptyRenderer::GetTextureData(GetTextureDataInfo* info)
+{
+  // Nothing was ever rendered
+  info->mImage = nullptr;
+}
+
+void EmptyRenderer::DoRenderTasks(RenderTasks* renderTasks, RenderQueues* renderQueues)
+{
+  mRenderTasks = renderTasks;
+  mRenderQueues = renderQueues;
+
+  mStatsLock.Lock();
+
+  forRange (RenderTaskRange& taskRange, mRenderTasks->mRenderTaskRanges.All())
+    DoRenderTaskRange(taskRange);
+
+  ++mStats.mFrames;
+  mStatsLock.Unlock();
+
+  DeleteObjectsInContainer(mMaterialRenderDataToDestroy);
+  DeleteObjectsInContainer(mMeshRenderDataToDestroy);
+  DeleteObjectsInContainer(mTextureRenderDataToDestroy);
+}
+
+EmptyRendererStats EmptyRenderer::GetStats()
+{
+  mStatsLock.Lock();
+  EmptyRendererStats stats = mStats;
+  mStatsLock.Unlock();
+  return stats;
+}
+
+void EmptyRenderer::ResetStats()
+{
+  mStatsLock.Lock();
+  mStats = EmptyRendererStats();
+  mStatsLock.Unlock();
+}
+
+void EmptyRenderer::DoRenderTaskRange(RenderTaskRange& taskRange)
+{
+  if (taskRange.mFrameBlockIndex >= mRenderQueues->mFrameBlocks.Size() ||
+      taskRange.mViewBlockIndex >= mRenderQueues->mViewBlocks.Size())
+  {
+    Invalid("Render task range refers to a missing frame or view block.");
+    return;
+  }
+
+  mFrameBlock = &mRenderQueues->mFrameBlocks[taskRange.mFrameBlockIndex];
+  mViewBlock = &mRenderQueues->mViewBlocks[taskRange.mViewBlockIndex];
+
+  RenderTaskBuffer& taskBuffer = mRenderTasks->mRenderTaskBuffer;
+  uint taskIndex = taskRange.mTaskIndex;
+  for (uint i = 0; i < taskRange.mTaskCount; ++i)
+  {
+    if (taskIndex >= taskBuffer.mCurrentIndex)
+    {
+      Invalid("Render task data is not valid.");
+      return;
+    }
+
+    RenderTask* task = (RenderTask*)&taskBuffer.mRenderTaskData[taskIndex];
+    ++mStats.mRenderTasks;
+
+    switch (task->mId)
+    {
+    case RenderTaskType::ClearTarget:
+      ++mStats.mStateChanges;
+      taskIndex += sizeof(RenderTaskClearTarget);
+      break;
+
+    case RenderTaskType::RenderPass:
+    {
+      RenderTaskRenderPass* renderPass = (RenderTaskRenderPass*)task;
+      DoRenderTaskRenderPass(renderPass);
+      // Skip past the sub RenderGroup tasks
+      taskIndex += sizeof(RenderTaskRenderPass) * (renderPass->mSubRenderGroupCount + 1);
+      i += renderPass->mSubRenderGroupCount;
+    }
+    break;
+
+    case RenderTaskType::PostProcess:
+      // Full screen triangle
+      ++mStats.mStateChanges;
+      ++mStats.mDrawCalls;
+      taskIndex += sizeof(RenderTaskPostProcess);
+      break;
+
+    case RenderTaskType::BackBufferBlit:
+      if (((RenderTaskBackBufferBlit*)task)->mColorTarget == nullptr)
+        Invalid("Back buffer blit has no color target.");
+      taskIndex += sizeof(RenderTaskBackBufferBlit);
+      break;
+
+    case RenderTaskType::TextureUpdate:
+      if (((RenderTaskTextureUpdate*)task)->mRenderData == nullptr)
+        Invalid("Texture update has no render data.");
+      taskIndex += sizeof(RenderTaskTextureUpdate);
+      break;
+
+    default:
+      Invalid("Render task not implemented.");
+      return;
+    }
+  }
+}
+
+void EmptyRenderer::DoRenderTaskRenderPass(RenderTaskRenderPass* task)
+{
+  if (task->mRenderGroupIndex >= mViewBlock->mRenderGroupRanges.Size())
+  {
+    Invalid("Render pass refers to a missing RenderGroup.");
+    return;
+  }
+
+  // Map of RenderGroup id to the index of its sub task
+  HashMap<int, size_t> taskIndexMap;
+  for (uint i = 1; i <= task->mSubRenderGroupCount; ++i)
+    taskIndexMap.Insert((task + i)->mRenderGroupIndex, i);
+
+  // Invalid index so that state is set for the first object
+  size_t currentTaskIndex = size_t(-1);
+  mActiveMaterial = nullptr;
+
+  IndexRange viewNodeRange = mViewBlock->mRenderGroupRanges[task->mRenderGroupIndex];
+  if (viewNodeRange.end > mViewBlock->mViewNodes.Size())
+  {
+    Invalid("RenderGroup range is outside of the view nodes.");
+    return;
+  }
+
+  for (uint i = viewNodeRange.start; i < viewNodeRange.end; ++i)
+  {
+    ViewNode& viewNode = mViewBlock->mViewNodes[i];
+    if ((uint)viewNode.mFrameNodeIndex >= mFrameBlock->mFrameNodes.Size())
+    {
+      Invalid("View node refers to a missing frame node.");
+      continue;
+    }
+
+    FrameNode& frameNode = mFrameBlock->mFrameNodes[viewNode.mFrameNodeIndex];
+
+    size_t index = taskIndexMap.FindValue(viewNode.mRenderGroupId, 0);
+    if (index != currentTaskIndex)
+    {
+      // RenderGroups that are not rendered
+      if ((task + index)->mRender == false)
+        continue;
+
+      currentTaskIndex = index;
+      FlushStreamed();
+      ++mStats.mStateChanges;
+    }
+
+    DrawNode(viewNode, frameNode);
+  }
+
+  FlushStreamed();
+}
+
+void EmptyRenderer::DrawNode(ViewNode& viewNode, FrameNode& frameNode)
+{
+  MaterialRenderData* material = frameNode.mMaterialRenderData;
+  if (material == nullptr)
+    return;
+
+  if (material != mActiveMaterial)
+  {
+    mActiveMaterial = material;
+    ++mStats.mMaterialChanges;
+  }
+
+  switch (frameNode.mRenderingType)
+  {
+  case RenderingType::Static:
+    FlushStreamed();
+    if (frameNode.mMeshRenderData != nullptr)
+      ++mStats.mDrawCalls;
+    break;
+
+  case RenderingType::Streamed:
+  {
+    uint vertexEnd = viewNode.mStreamedVertexStart + viewNode.mStreamedVertexCount;
+    if (vertexEnd > mRenderQueues->mStreamedVertices.Size())
+    {
+      Invalid("View node refers to missing streamed vertices.");
+      break;
+    }
+
+    bool batchChanged = material != mStreamedMaterial || frameNode.mTextureRenderData != mStreamedTexture ||
+                        viewNode.mStreamedVertexType != mStreamedType;
+    if (batchChanged)
+      FlushStreamed();
+
+    mStreamedPending = mStreamedPending || viewNode.mStreamedVertexCount != 0;
+    mStreamedMaterial = material;
+    mStreamedTexture = frameNode.mTextureRenderData;
+    mStreamedType = viewNode.mStreamedVertexType;
+  }
+  break;
+  }
+}
+
+void EmptyRenderer::FlushStreamed()
+{
+  if (mStreamedPending)
+    ++mStats.mDrawCalls;
+
+  mStreamedPending = false;
+  mStreamedMaterial = nullptr;
+  mStreamedTexture = nullptr;
+}
+
+void EmptyRenderer::Invalid(cstr message)
+{
+  Error("EmptyRenderer: %s", message);
+  ++mStats.mInvalidCommands;
+}
+
+} // namespace Zero
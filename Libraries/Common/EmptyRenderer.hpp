@@ -0,0 +1,107 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+/// Totals of the commands the EmptyRenderer has been given.
+class EmptyRendererStats
+{
+public:
+  EmptyRendererStats();
+
+  uint mFrames;
+  uint mRenderTasks;
+  // Static draws plus every flush of streamed vertices (batched the same way
+  // as the OpenGL renderer batches them).
+  uint mDrawCalls;
+  // Render target and render settings changes.
+  uint mStateChanges;
+  // Changes of material between draws.
+  uint mMaterialChanges;
+
+  uint mMeshUploads;
+  uint mTextureUploads;
+  uint mShaderCompiles;
+  // Vertex, index and texture bytes given to the renderer.
+  u64 mBytesUploaded;
+
+  // Commands that would have been invalid for a real renderer.
+  uint mInvalidCommands;
+};
+
+/// Renderer that doesn't need graphics hardware. Every call is validated and
+/// recorded but nothing is drawn, so the rest of the rendering pipeline can run
+/// and be measured on machines without a gpu. Used by platforms without a
+/// renderer, when running without a main window, or when selected with the
+/// 'nullrenderer' command line argument.
+class EmptyRenderer : public Renderer
+{
+public:
+  EmptyRenderer();
+  ~EmptyRenderer() override;
+
+  // Renderer Interface
+  void BuildOrthographicTransform(Mat4Ref matrix, float size, float aspect, float nearPlane, float farPlane) override;
+  void BuildPerspectiveTransform(Mat4Ref matrix, float fov, float aspect, float nearPlane, float farPlane) override;
+
+  MaterialRenderData* CreateMaterialRenderData() override;
+  MeshRenderData* CreateMeshRenderData() override;
+  TextureRenderData* CreateTextureRenderData() override;
+
+  void AddMaterial(AddMaterialInfo* info) override;
+  void AddMesh(AddMeshInfo* info) override;
+  void AddTexture(AddTextureInfo* info) override;
+  void RemoveMaterial(MaterialRenderData* data) override;
+  void RemoveMesh(MeshRenderData* data) override;
+  void RemoveTexture(TextureRenderData* data) override;
+
+  bool GetLazyShaderCompilation() override;
+  void SetLazyShaderCompilation(bool isLazy) override;
+  void AddShaders(Array<ShaderEntry>& entries, uint forceCompileBatchCount) override;
+  void RemoveShaders(Array<ShaderEntry>& entries) override;
+
+  void SetVSync(bool vsync) override;
+
+  void GetTextureData(GetTextureDataInfo* info) override;
+
+  void DoRenderTasks(RenderTasks* renderTasks, RenderQueues* renderQueues) override;
+
+  /// Copy of the recorded statistics (safe to call from any thread).
+  EmptyRendererStats GetStats();
+  void ResetStats();
+
+private:
+  void DoRenderTaskRange(RenderTaskRange& taskRange);
+  void DoRenderTaskRenderPass(RenderTaskRenderPass* task);
+  void DrawNode(ViewNode& viewNode, FrameNode& frameNode);
+  void FlushStreamed();
+
+  // Reports an invalid command (mStatsLock must be locked).
+  void Invalid(cstr message);
+
+  RenderTasks* mRenderTasks;
+  RenderQueues* mRenderQueues;
+  FrameBlock* mFrameBlock;
+  ViewBlock* mViewBlock;
+
+  // Streamed draws are batched until any of these change
+  bool mStreamedPending;
+  MaterialRenderData* mStreamedMaterial;
+  TextureRenderData* mStreamedTexture;
+  PrimitiveType::Enum mStreamedType;
+
+  MaterialRenderData* mActiveMaterial;
+  bool mLazyShaderCompilation;
+
+  // Render data is destroyed after the next render tasks, the render tasks
+  // being processed can still reference it.
+  Array<MaterialRenderData*> mMaterialRenderDataToDestroy;
+  Array<MeshRenderData*> mMeshRenderDataToDestroy;
+  Array<TextureRenderData*> mTextureRenderDataToDestroy;
+
+  SpinLock mStatsLock;
+  EmptyRendererStats mStats;
+};
+
+} // namespace Zero
@@ -3,6 +3,9 @@
 
 namespace Zero
 {
+// CreateFunctor allocates a functor that binds a function to its arguments.
+// MakeFunctor returns the same functor by value so it can be stored without
+// an allocation (in a fixed size buffer, for example).
 class Functor
 {
 public:
@@ -24,15 +27,21 @@ public:
 };
 
 template <typename ReturnType>
-Functor* CreateFunctor(ReturnType (*functionPointer)())
+FunctorStatic0<ReturnType> MakeFunctor(ReturnType (*functionPointer)())
 {
   ErrorIf(functionPointer == nullptr);
 
-  auto functor = new FunctorStatic0<ReturnType>();
-  functor->mFunctionPointer = functionPointer;
+  FunctorStatic0<ReturnType> functor;
+  functor.mFunctionPointer = functionPointer;
   return functor;
 }
 
+template <typename ReturnType>
+Functor* CreateFunctor(ReturnType (*functionPointer)())
+{
+  return new FunctorStatic0<ReturnType>(MakeFunctor(functionPointer));
+}
+
 template <typename ReturnType, typename InstanceType>
 class FunctorInstance0 : public Functor
 {
@@ -48,16 +57,23 @@ public:
 };
 
 template <typename ReturnType, typename InstanceType>
-Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)(), InstanceType* instance)
+FunctorInstance0<ReturnType, InstanceType> MakeFunctor(
+    ReturnType (InstanceType::*functionPointer)(), InstanceType* instance)
 {
   ErrorIf(instance == nullptr);
 
-  auto functor = new FunctorInstance0<ReturnType, InstanceType>();
-  functor->mFunctionPointer = functionPointer;
-  functor->mInstance = instance;
+  FunctorInstance0<ReturnType, InstanceType> functor;
+  functor.mFunctionPointer = functionPointer;
+  functor.mInstance = instance;
   return functor;
 }
 
+template <typename ReturnType, typename InstanceType>
+Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)(), InstanceType* instance)
+{
+  return new FunctorInstance0<ReturnType, InstanceType>(MakeFunctor(functionPointer, instance));
+}
+
 template <typename ReturnType, typename InstanceType>
 class FunctorInstanceConst0 : public Functor
 {
@@ -73,16 +89,23 @@ public:
 };
 
 template <typename ReturnType, typename InstanceType>
-Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)() const, InstanceType* instance)
+FunctorInstanceConst0<ReturnType, InstanceType> MakeFunctor(
+    ReturnType (InstanceType::*functionPointer)() const, InstanceType* instance)
 {
   ErrorIf(instance == nullptr);
 
-  auto functor = new FunctorInstanceConst0<ReturnType, InstanceType>();
-  functor->mFunctionPointer = functionPointer;
-  functor->mInstance = instance;
+  FunctorInstanceConst0<ReturnType, InstanceType> functor;
+  functor.mFunctionPointer = functionPointer;
+  functor.mInstance = instance;
   return functor;
 }
 
+template <typename ReturnType, typename InstanceType>
+Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)() const, InstanceType* instance)
+{
+  return new FunctorInstanceConst0<ReturnType, InstanceType>(MakeFunctor(functionPointer, instance));
+}
+
 template <typename ReturnType, typename P0>
 class FunctorStatic1 : public Functor
 {
@@ -98,16 +121,22 @@ public:
 };
 
 template <typename ReturnType, typename P0>
-Functor* CreateFunctor(ReturnType (*functionPointer)(P0), P0 p0)
+FunctorStatic1<ReturnType, P0> MakeFunctor(ReturnType (*functionPointer)(P0), P0 p0)
 {
   ErrorIf(functionPointer == nullptr);
 
-  auto functor = new FunctorStatic1<ReturnType, P0>();
-  functor->mFunctionPointer = functionPointer;
-  functor->mP0 = p0;
+  FunctorStatic1<ReturnType, P0> functor;
+  functor.mFunctionPointer = functionPointer;
+  functor.mP0 = p0;
   return functor;
 }
 
+template <typename ReturnType, typename P0>
+Functor* CreateFunctor(ReturnType (*functionPointer)(P0), P0 p0)
+{
+  return new FunctorStatic1<ReturnType, P0>(MakeFunctor(functionPointer, p0));
+}
+
 template <typename ReturnType, typename InstanceType, typename P0>
 class FunctorInstance1 : public Functor
 {
@@ -124,17 +153,24 @@ public:
 };
 
 template <typename ReturnType, typename InstanceType, typename P0>
-Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)(P0), InstanceType* instance, P0 p0)
+FunctorInstance1<ReturnType, InstanceType, P0> MakeFunctor(
+    ReturnType (InstanceType::*functionPointer)(P0), InstanceType* instance, P0 p0)
 {
   ErrorIf(instance == nullptr);
 
-  auto functor = new FunctorInstance1<ReturnType, InstanceType, P0>();
-  functor->mFunctionPointer = functionPointer;
-  functor->mInstance = instance;
-  functor->mP0 = p0;
+  FunctorInstance1<ReturnType, InstanceType, P0> functor;
+  functor.mFunctionPointer = functionPointer;
+  functor.mInstance = instance;
+  functor.mP0 = p0;
   return functor;
 }
 
+template <typename ReturnType, typename InstanceType, typename P0>
+Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)(P0), InstanceType* instance, P0 p0)
+{
+  return new FunctorInstance1<ReturnType, InstanceType, P0>(MakeFunctor(functionPointer, instance, p0));
+}
+
 template <typename ReturnType, typename InstanceType, typename P0>
 class FunctorInstanceConst1 : public Functor
 {
@@ -151,17 +187,24 @@ public:
 };
 
 template <typename ReturnType, typename InstanceType, typename P0>
-Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)(P0) const, InstanceType* instance, P0 p0)
+FunctorInstanceConst1<ReturnType, InstanceType, P0> MakeFunctor(
+    ReturnType (InstanceType::*functionPointer)(P0) const, InstanceType* instance, P0 p0)
 {
   ErrorIf(instance == nullptr);
 
-  auto functor = new FunctorInstanceConst1<ReturnType, InstanceType, P0>();
-  functor->mFunctionPointer = functionPointer;
-  functor->mInstance = instance;
-  functor->mP0 = p0;
+  FunctorInstanceConst1<ReturnType, InstanceType, P0> functor;
+  functor.mFunctionPointer = functionPointer;
+  functor.mInstance = instance;
+  functor.mP0 = p0;
   return functor;
 }
 
+template <typename ReturnType, typename InstanceType, typename P0>
+Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)(P0) const, InstanceType* instance, P0 p0)
+{
+  return new FunctorInstanceConst1<ReturnType, InstanceType, P0>(MakeFunctor(functionPointer, instance, p0));
+}
+
 template <typename ReturnType, typename P0, typename P1>
 class FunctorStatic2 : public Functor
 {
@@ -178,17 +221,23 @@ public:
 };
 
 template <typename ReturnType, typename P0, typename P1>
-Functor* CreateFunctor(ReturnType (*functionPointer)(P0, P1), P0 p0, P1 p1)
+FunctorStatic2<ReturnType, P0, P1> MakeFunctor(ReturnType (*functionPointer)(P0, P1), P0 p0, P1 p1)
 {
   ErrorIf(functionPointer == nullptr);
 
-  auto functor = new FunctorStatic2<ReturnType, P0, P1>();
-  functor->mFunctionPointer = functionPointer;
-  functor->mP0 = p0;
-  functor->mP1 = p1;
+  FunctorStatic2<ReturnType, P0, P1> functor;
+  functor.mFunctionPointer = functionPointer;
+  functor.mP0 = p0;
+  functor.mP1 = p1;
   return functor;
 }
 
+template <typename ReturnType, typename P0, typename P1>
+Functor* CreateFunctor(ReturnType (*functionPointer)(P0, P1), P0 p0, P1 p1)
+{
+  return new FunctorStatic2<ReturnType, P0, P1>(MakeFunctor(functionPointer, p0, p1));
+}
+
 template <typename ReturnType, typename InstanceType, typename P0, typename P1>
 class FunctorInstance2 : public Functor
 {
@@ -206,18 +255,25 @@ public:
 };
 
 template <typename ReturnType, typename InstanceType, typename P0, typename P1>
-Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)(P0, P1), InstanceType* instance, P0 p0, P1 p1)
+FunctorInstance2<ReturnType, InstanceType, P0, P1> MakeFunctor(
+    ReturnType (InstanceType::*functionPointer)(P0, P1), InstanceType* instance, P0 p0, P1 p1)
 {
   ErrorIf(instance == nullptr);
 
-  auto functor = new FunctorInstance2<ReturnType, InstanceType, P0, P1>();
-  functor->mFunctionPointer = functionPointer;
-  functor->mInstance = instance;
-  functor->mP0 = p0;
-  functor->mP1 = p1;
+  FunctorInstance2<ReturnType, InstanceType, P0, P1> functor;
+  functor.mFunctionPointer = functionPointer;
+  functor.mInstance = instance;
+  functor.mP0 = p0;
+  functor.mP1 = p1;
   return functor;
 }
 
+template <typename ReturnType, typename InstanceType, typename P0, typename P1>
+Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)(P0, P1), InstanceType* instance, P0 p0, P1 p1)
+{
+  return new FunctorInstance2<ReturnType, InstanceType, P0, P1>(MakeFunctor(functionPointer, instance, p0, p1));
+}
+
 template <typename ReturnType, typename InstanceType, typename P0, typename P1>
 class FunctorInstanceConst2 : public Functor
 {
@@ -235,18 +291,25 @@ public:
 };
 
 template <typename ReturnType, typename InstanceType, typename P0, typename P1>
-Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)(P0, P1) const, InstanceType* instance, P0 p0, P1 p1)
+FunctorInstanceConst2<ReturnType, InstanceType, P0, P1> MakeFunctor(
+    ReturnType (InstanceType::*functionPointer)(P0, P1) const, InstanceType* instance, P0 p0, P1 p1)
 {
   ErrorIf(instance == nullptr);
 
-  auto functor = new FunctorInstanceConst2<ReturnType, InstanceType, P0, P1>();
-  functor->mFunctionPointer = functionPointer;
-  functor->mInstance = instance;
-  functor->mP0 = p0;
-  functor->mP1 = p1;
+  FunctorInstanceConst2<ReturnType, InstanceType, P0, P1> functor;
+  functor.mFunctionPointer = functionPointer;
+  functor.mInstance = instance;
+  functor.mP0 = p0;
+  functor.mP1 = p1;
   return functor;
 }
 
+template <typename ReturnType, typename InstanceType, typename P0, typename P1>
+Functor* CreateFunctor(ReturnType (InstanceType::*functionPointer)(P0, P1) const, InstanceType* instance, P0 p0, P1 p1)
+{
+  return new FunctorInstanceConst2<ReturnType, InstanceType, P0, P1>(MakeFunctor(functionPointer, instance, p0, p1));
+}
+
 template <typename ReturnType, typename P0, typename P1, typename P2>
 class FunctorStatic3 : public Functor
 {
@@ -264,18 +327,24 @@ public:
 };
 
 template <typename ReturnType, typename P0, typename P1, typename P2>
-Functor* CreateFunctor(ReturnType (*functionPointer)(P0, P1, P2), P0 p0, P1 p1, P2 p2)
+FunctorStatic3<ReturnType, P0, P1, P2> MakeFunctor(ReturnType (*functionPointer)(P0, P1, P2), P0 p0, P1 p1, P2 p2)
 {
   ErrorIf(functionPointer == nullptr);
 
-  auto functor = new FunctorStatic3<ReturnType, P0, P1, P2>();
-  functor->mFunctionPointer = functionPointer;
-  functor->mP0 = p0;
-  functor->mP1 = p1;
-  functor->mP2 = p2;
+  FunctorStatic3<ReturnType, P0, P1, P2> functor;
+  functor.mFunctionPointer = functionPointer;
+  functor.mP0 = p0;
+  functor.mP1 = p1;
+  functor.mP2 = p2;
   return functor;
 }
 
+template <typename ReturnType, typename P0, typename P1, typename P2>
+Functor* CreateFunctor(ReturnType (*functionPointer)(P0, P1, P2), P0 p0, P1 p1, P2 p2)
+{
+  return new FunctorStatic3<ReturnType, P0, P1, P2>(MakeFunctor(functionPointer, p0, p1, p2));
+}
+
 template <typename ReturnType, typename InstanceType, typename P0, typename P1, typename P2>
 class FunctorInstance3 : public Functor
 {
@@ -294,20 +363,27 @@ public:
 };
 
 template <typename ReturnType, typename InstanceType, typename P0, typename P1, typename P2>
-Functor*
-CreateFunctor(ReturnType (InstanceType::*functionPointer)(P0, P1, P2), InstanceType* instance, P0 p0, P1 p1, P2 p2)
+FunctorInstance3<ReturnType, InstanceType, P0, P1, P2> MakeFunctor(
+    ReturnType (InstanceType::*functionPointer)(P0, P1, P2), InstanceType* instance, P0 p0, P1 p1, P2 p2)
 {
   ErrorIf(instance == nullptr);
 
-  auto functor = new FunctorInstance3<ReturnType, InstanceType, P0, P1, P2>();
-  functor->mFunctionPointer = functionPointer;
-  functor->mInstance = instance;
-  functor->mP0 = p0;
-  functor->mP1 = p1;
-  functor->mP2 = p2;
+  FunctorInstance3<ReturnType, InstanceType, P0, P1, P2> functor;
+  functor.mFunctionPointer = functionPointer;
+  functor.mInstance = instance;
+  functor.mP0 = p0;
+  functor.mP1 = p1;
+  functor.mP2 = p2;
   return functor;
 }
 
+template <typename ReturnType, typename InstanceType, typename P0, typename P1, typename P2>
+Functor* CreateFunctor(
+    ReturnType (InstanceType::*functionPointer)(P0, P1, P2), InstanceType* instance, P0 p0, P1 p1, P2 p2)
+{
+  return new FunctorInstance3<ReturnType, InstanceType, P0, P1, P2>(MakeFunctor(functionPointer, instance, p0, p1, p2));
+}
+
 template <typename ReturnType, typename InstanceType, typename P0, typename P1, typename P2>
 class FunctorInstanceConst3 : public Functor
 {
@@ -326,20 +402,28 @@ public:
 };
 
 template <typename ReturnType, typename InstanceType, typename P0, typename P1, typename P2>
-Functor* CreateFunctor(
+FunctorInstanceConst3<ReturnType, InstanceType, P0, P1, P2> MakeFunctor(
     ReturnType (InstanceType::*functionPointer)(P0, P1, P2) const, InstanceType* instance, P0 p0, P1 p1, P2 p2)
 {
   ErrorIf(instance == nullptr);
 
-  auto functor = new FunctorInstanceConst3<ReturnType, InstanceType, P0, P1, P2>();
-  functor->mFunctionPointer = functionPointer;
-  functor->mInstance = instance;
-  functor->mP0 = p0;
-  functor->mP1 = p1;
-  functor->mP2 = p2;
+  FunctorInstanceConst3<ReturnType, InstanceType, P0, P1, P2> functor;
+  functor.mFunctionPointer = functionPointer;
+  functor.mInstance = instance;
+  functor.mP0 = p0;
+  functor.mP1 = p1;
+  functor.mP2 = p2;
   return functor;
 }
 
+template <typename ReturnType, typename InstanceType, typename P0, typename P1, typename P2>
+Functor* CreateFunctor(
+    ReturnType (InstanceType::*functionPointer)(P0, P1, P2) const, InstanceType* instance, P0 p0, P1 p1, P2 p2)
+{
+  return new FunctorInstanceConst3<ReturnType, InstanceType, P0, P1, P2>(
+      MakeFunctor(functionPointer, instance, p0, p1, p2));
+}
+
 template <typename InstanceType, typename MemberType>
 class FunctorInstanceMember : public Functor
 {
@@ -356,17 +440,24 @@ public:
 };
 
 template <typename InstanceType, typename MemberType>
-Functor* CreateFunctor(MemberType InstanceType::*memberPointer, InstanceType* instance, MemberType value)
+FunctorInstanceMember<InstanceType, MemberType> MakeFunctor(
+    MemberType InstanceType::*memberPointer, InstanceType* instance, MemberType value)
 {
   ErrorIf(instance == nullptr);
 
-  auto functor = new FunctorInstanceMember<InstanceType, MemberType>();
-  functor->mMemberPointer = memberPointer;
-  functor->mInstance = instance;
-  functor->mValue = value;
+  FunctorInstanceMember<InstanceType, MemberType> functor;
+  functor.mMemberPointer = memberPointer;
+  functor.mInstance = instance;
+  functor.mValue = value;
   return functor;
 }
 
+template <typename InstanceType, typename MemberType>
+Functor* CreateFunctor(MemberType InstanceType::*memberPointer, InstanceType* instance, MemberType value)
+{
+  return new FunctorInstanceMember<InstanceType, MemberType>(MakeFunctor(memberPointer, instance, value));
+}
+
 template <typename PointerType, typename ValueType>
 class FunctorSetPointer : public Functor
 {
@@ -382,24 +473,36 @@ public:
 };
 
 template <typename PointerType, typename ValueType>
-Functor* CreateFunctor(PointerType* pointer, ValueType value)
+FunctorSetPointer<PointerType, ValueType> MakeFunctor(PointerType* pointer, ValueType value)
 {
   ErrorIf(pointer == nullptr);
 
-  auto functor = new FunctorSetPointer<PointerType, ValueType>();
-  functor->mPointer = pointer;
-  functor->mValue = value;
+  FunctorSetPointer<PointerType, ValueType> functor;
+  functor.mPointer = pointer;
+  functor.mValue = value;
   return functor;
 }
 
+template <typename PointerType, typename ValueType>
+Functor* CreateFunctor(PointerType* pointer, ValueType value)
+{
+  return new FunctorSetPointer<PointerType, ValueType>(MakeFunctor(pointer, value));
+}
+
 template <typename ReferenceType, typename ValueType>
-Functor* CreateFunctor(ReferenceType& reference, ValueType value)
+FunctorSetPointer<ReferenceType, ValueType> MakeFunctor(ReferenceType& reference, ValueType value)
 {
   ErrorIf(&reference == nullptr);
 
-  auto functor = new FunctorSetPointer<ReferenceType, ValueType>();
-  functor->mPointer = &reference;
-  functor->mValue = value;
+  FunctorSetPointer<ReferenceType, ValueType> functor;
+  functor.mPointer = &reference;
+  functor.mValue = value;
   return functor;
 }
+
+template <typename ReferenceType, typename ValueType>
+Functor* CreateFunctor(ReferenceType& reference, ValueType value)
+{
+  return new FunctorSetPointer<ReferenceType, ValueType>(MakeFunctor(reference, value));
+}
 } // namespace Zero
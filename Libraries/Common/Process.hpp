@@ -72,6 +72,9 @@ public:
   bool IsStandardErrorRedirected();
   bool IsStandardInRedirected();
 
+  // Returns the id of the process running this code.
+  static OsInt GetCurrentProcessId();
+
 protected:
   ZeroDeclarePrivateData(Process, 48);
 };
@@ -1594,6 +1594,21 @@ void RenderQueues::AddStreamedQuadView(ViewNode& viewNode, Vec3 pos[4], Vec2 uv0
   viewNode.mStreamedVertexCount = mStreamedVertices.Size() - viewNode.mStreamedVertexStart;
 }
 
+void RenderQueues::SetStreamedQuadView(uint vertexIndex, Vec3 pos[4], Vec2 uv0, Vec2 uv1, Vec4 color)
+{
+  StreamedVertex v0(pos[0], uv0, color, Vec2(0, 0));
+  StreamedVertex v1(pos[1], Vec2(uv0.x, uv1.y), color, Vec2(0, 1));
+  StreamedVertex v2(pos[2], uv1, color, Vec2(1, 1));
+  StreamedVertex v3(pos[3], Vec2(uv1.x, uv0.y), color, Vec2(1, 0));
+
+  mStreamedVertices[vertexIndex + 0] = v0;
+  mStreamedVertices[vertexIndex + 1] = v1;
+  mStreamedVertices[vertexIndex + 2] = v2;
+  mStreamedVertices[vertexIndex + 3] = v2;
+  mStreamedVertices[vertexIndex + 4] = v3;
+  mStreamedVertices[vertexIndex + 5] = v0;
+}
+
 RenderTaskBuffer::RenderTaskBuffer() : mTaskCount(0), mCurrentIndex(0)
 {
   mRenderTaskData.Resize(128);
@@ -815,6 +815,10 @@ public:
                                  Vec2 uvAux1 = Vec2(1, 1));
 
   void AddStreamedQuadView(ViewNode& viewNode, Vec3 pos[4], Vec2 uv0, Vec2 uv1, Vec4 color);
+  // Writes the same vertices as AddStreamedQuadView starting at the given
+  // index, the vertices must already be allocated. Can be called from multiple
+  // threads at once as long as each writes to different vertices.
+  void SetStreamedQuadView(uint vertexIndex, Vec3 pos[4], Vec2 uv0, Vec2 uv1, Vec4 color);
 
   Array<FrameBlock> mFrameBlocks;
   Array<ViewBlock> mViewBlocks;
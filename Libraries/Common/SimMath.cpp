@@ -0,0 +1,38 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+#if defined(ZeroSimdSse2)
+
+namespace Math
+{
+
+namespace Simd
+{
+
+// Every bit set (or clear) in each component, for masking with AndVec
+static SimVec MaskVec(bool x, bool y, bool z, bool w)
+{
+  return _mm_castsi128_ps(_mm_set_epi32(w ? -1 : 0, z ? -1 : 0, y ? -1 : 0, x ? -1 : 0));
+}
+
+const SimVec gSimOne = _mm_set_ps1(1.0f);
+const SimVec gSimOneVec3 = _mm_set_ps(0.0f, 1.0f, 1.0f, 1.0f);
+const SimVec gSimZero = _mm_setzero_ps();
+const SimVec gSimNegativeOne = _mm_set_ps1(-1.0f);
+const SimVec gSimOneHalf = _mm_set_ps1(0.5f);
+const SimVec gSimVec3Mask = MaskVec(true, true, true, false);
+const SimVec gSimFullMask = MaskVec(true, true, true, true);
+const SimVec gSimBasisX = _mm_set_ps(0.0f, 0.0f, 0.0f, 1.0f);
+const SimVec gSimBasisY = _mm_set_ps(0.0f, 0.0f, 1.0f, 0.0f);
+const SimVec gSimBasisZ = _mm_set_ps(0.0f, 1.0f, 0.0f, 0.0f);
+const SimVec gSimBasisW = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+const SimVec gSimMaskX = MaskVec(true, false, false, false);
+const SimVec gSimMaskY = MaskVec(false, true, false, false);
+const SimVec gSimMaskZ = MaskVec(false, false, true, false);
+const SimVec gSimMaskW = MaskVec(false, false, false, true);
+
+} // namespace Simd
+
+} // namespace Math
+
+#endif
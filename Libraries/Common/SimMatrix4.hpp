@@ -84,4 +84,4 @@ SimMat4 operator/(SimMat4Param lhs, scalar rhs);
 
 } // namespace Math
 
-#include "Math/SimMatrix4.inl"
+#include "SimMatrix4.inl"
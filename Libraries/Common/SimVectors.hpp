@@ -118,5 +118,5 @@ SimVec Refract4(SimVecParam incident, SimVecParam normal, SimVecParam refraction
 
 } // namespace Math
 
-#include "Math/SimVectorSpecific.inl"
-#include "Math/SimVectors.inl"
+#include "SimVectorSpecific.inl"
+#include "SimVectors.inl"
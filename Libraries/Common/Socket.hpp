@@ -221,6 +221,23 @@ ZeroShared SocketAddress StringToIpv4Address(StringParam address, ushort port);
 ZeroShared SocketAddress StringToIpv6Address(StringParam address);
 ZeroShared SocketAddress StringToIpv6Address(StringParam address, ushort port);
 
+//                               SocketDatagram //
+
+/// Single datagram of a batched send or receive
+struct ZeroShared SocketDatagram
+{
+  /// Constructor
+  SocketDatagram() : mData(nullptr), mDataLength(0), mBytesTransferred(0), mAddress()
+  {
+  }
+
+  /// Data
+  byte* mData;              /// Datagram data (buffer to receive into)
+  size_t mDataLength;       /// Bytes to send (buffer capacity when receiving)
+  size_t mBytesTransferred; /// Bytes sent or received
+  SocketAddress mAddress;   /// Remote address sent to or received from
+};
+
 //                                    Socket //
 
 /// Network host endpoint
@@ -251,6 +268,11 @@ public:
   /// asserts
   static bool IsCommonConnectError(int extendedErrorCode);
 
+  /// Returns true if the platform can send and receive multiple datagrams in a
+  /// single socket library call (see SendToBatch and ReceiveFromBatch), else
+  /// false (the batched calls are emulated with single datagram calls)
+  static bool SupportsDatagramBatching();
+
   /// Returns true if the platform's underlying socket library is initialized
   /// (reference count greater than zero), else false
   static bool IsSocketLibraryInitialized();
@@ -424,6 +446,27 @@ public:
                      SocketAddress& from,
                      SocketFlags::Enum flags = SocketFlags::None);
 
+  /// Sends each datagram on the open socket to its remote address, in order
+  /// Will block if the send buffer is full (unless the socket is set to
+  /// non-blocking) Returns the number of datagrams sent (a datagram that could
+  /// not be sent is skipped with mBytesTransferred set to 0, status will contain
+  /// the last error)
+  /// (Named sendmmsg on some platforms)
+  size_t SendToBatch(Status& status,
+                     SocketDatagram* datagrams,
+                     size_t datagramCount,
+                     SocketFlags::Enum flags = SocketFlags::None);
+
+  /// Receives datagrams on the open socket from any remote address
+  /// Will block until at least one datagram is received (unless the socket is
+  /// set to non-blocking), then only receives the datagrams already available
+  /// Returns the number of datagrams received (0 if an error occurs, status
+  /// will contain the error) (Named recvmmsg on some platforms)
+  size_t ReceiveFromBatch(Status& status,
+                          SocketDatagram* datagrams,
+                          size_t datagramCount,
+                          SocketFlags::Enum flags = SocketFlags::None);
+
   /// Returns true if the specified socket capability is ready for use, else
   /// false In a high efficiency situation, mechanisms other than select should
   /// be used
@@ -50,9 +50,7 @@ void SoundBuilder::Serialize(Serializer& stream)
 {
   SerializeName(Name);
   SerializeName(mResourceId);
-  SerializeEnumNameDefault(AudioFileLoadType, mFileLoadType, AudioFileLoadType::Auto);
-  SerializeNameDefault(mNormalize, false);
-  SerializeNameDefault(mMaxVolume, 0.9f);
+  SerializeBuildSettings(stream);
 
   // This should be removed at the next major version (makes sure that we keep
   // the streaming setting for existing sounds)
@@ -67,6 +65,13 @@ void SoundBuilder::Serialize(Serializer& stream)
   }
 }
 
+void SoundBuilder::SerializeBuildSettings(Serializer& stream)
+{
+  SerializeEnumNameDefault(AudioFileLoadType, mFileLoadType, AudioFileLoadType::Auto);
+  SerializeNameDefault(mNormalize, false);
+  SerializeNameDefault(mMaxVolume, 0.9f);
+}
+
 void SoundBuilder::BuildContent(BuildOptions& options)
 {
   Status status;
@@ -80,12 +85,15 @@ void SoundBuilder::BuildContent(BuildOptions& options)
   {
     // Encode the file and write it out to disk
     AudioFileEncoder::WriteFile(status, destFile, audioFile, mNormalize, mMaxVolume);
+  }
 
-    if (status.Failed())
-      DoNotifyWarning("Error Processing Audio File", status.Message);
+  // Reported through the build options as this may be building on a job thread
+  if (status.Failed())
+  {
+    options.Failure = true;
+    options.Message =
+        String::Format("Error Processing Audio File '%s': %s", sourceFile.c_str(), status.Message.c_str());
   }
-  else
-    DoNotifyWarning("Error Processing Audio File", status.Message);
 }
 
 bool SoundBuilder::NeedsBuilding(BuildOptions& options)
@@ -106,6 +114,12 @@ void SoundBuilder::BuildListing(ResourceListing& listing)
   DirectBuilderComponent::BuildListing(listing);
 }
 
+void SoundBuilder::GetCacheableOutputs(Array<String>& outputs)
+{
+  // Encoding is slow enough to be worth caching
+  outputs.PushBack(GetOutputFile());
+}
+
 void CreateAudioContent(ContentSystem* system)
 {
   AddContent<AudioContent>(system);
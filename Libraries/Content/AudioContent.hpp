@@ -57,6 +57,8 @@ public:
   void BuildContent(BuildOptions& options) override;
   bool NeedsBuilding(BuildOptions& options) override;
   void BuildListing(ResourceListing& listing) override;
+  void SerializeBuildSettings(Serializer& stream) override;
+  void GetCacheableOutputs(Array<String>& outputs) override;
 
   // This should be removed at the next major version
   bool mStreamed;
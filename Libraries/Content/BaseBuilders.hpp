@@ -36,6 +36,12 @@ public:
   void BuildListing(ResourceListing& listing) override;
   void Generate(ContentInitializer& initializer) override;
 
+  // Copying the content file is safe on a job thread
+  bool CanBuildOnJobThread() override
+  {
+    return true;
+  }
+
   String GetResourceOwner() override
   {
     return ResourceOwner;
@@ -13,6 +13,7 @@ BuildOptions::BuildOptions(ContentLibrary* library)
   }
 
   ToolPath = Z::gContentSystem->ToolPath;
+  CachePath = Z::gContentSystem->BuildCachePath;
 
   SourcePath = library->SourcePath;
   OutputPath = library->GetOutputPath();
@@ -4,9 +4,6 @@
 namespace Zero
 {
 
-// Options
-typedef Array<ContentItem*> ContentItemArray;
-
 // Options used to control content building
 // Treat this as an immutable object once we pass it to the
 // content items to be processed, it's used my multiple threads!
@@ -26,8 +23,15 @@ public:
   String OutputPath;
   String SourcePath;
   String ToolPath;
+  // Content build cache directory (empty if the cache is disabled).
+  String CachePath;
   // The error message if the build fails.
   String Message;
+  // Did any builder build the content item or restore it from the content
+  // build cache? Job threads can't print, so these are printed once the
+  // content item is finished on the main thread.
+  bool Built = false;
+  bool RestoredFromCache = false;
 };
 
 } // namespace Zero
@@ -0,0 +1,158 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+// Changing this invalidates every entry in the cache (bump it if the key or
+// the layout of the cache changes)
+static const uint cContentBuildCacheVersion = 3;
+
+void ContentBuildCache::BuildContent(BuilderComponent* builder, BuildOptions& options)
+{
+  Array<String> outputs;
+  if (!options.CachePath.Empty())
+    builder->GetCacheableOutputs(outputs);
+
+  // Nothing to cache?
+  if (outputs.Empty())
+  {
+    builder->BuildContent(options);
+    return;
+  }
+
+  String key = GetKey(builder, options);
+  if (key.Empty())
+  {
+    builder->BuildContent(options);
+    return;
+  }
+
+  // Built before (by any project or checkout)?
+  if (Restore(builder, options, key, outputs))
+  {
+    options.RestoredFromCache = true;
+    return;
+  }
+
+  bool failedBefore = options.Failure;
+  builder->BuildContent(options);
+
+  // Only cache successful builds
+  if (!failedBefore && !options.Failure)
+    Store(builder, options, key, outputs);
+}
+
+String ContentBuildCache::GetKey(BuilderComponent* builder, BuildOptions& options)
+{
+  String sourceFile = FilePath::Combine(options.SourcePath, builder->mOwner->Filename);
+
+  File file;
+  if (!file.Open(sourceFile, FileMode::Read, FileAccessPattern::Sequential))
+    return String();
+
+  Zilch::Sha1Builder sha1;
+
+  // Cache, engine and builder versions. Every engine on the machine shares the
+  // cache, and the engine's version covers the libraries builders process with
+  // (such as the texture compressor and the audio encoder).
+  String version = String::Format(
+      "%u:%s:%u:", cContentBuildCacheVersion, GetBuildVersionName().c_str(), builder->GetBuildVersion());
+  sha1.Append(version);
+
+  // Builder settings (the resource name and id are left out so the entry is
+  // shared by every content item with the same source file and settings)
+  TextSaver saver;
+  saver.OpenBuffer();
+  saver.StartPolymorphic(ZilchVirtualTypeId(builder));
+  builder->SerializeBuildSettings(saver);
+  saver.EndPolymorphic();
+  sha1.Append(saver.GetString());
+
+  // Source file bytes
+  if (!sha1.Append(file))
+    return String();
+
+  return sha1.OutputHashString();
+}
+
+bool ContentBuildCache::Restore(BuilderComponent* builder,
+                                BuildOptions& options,
+                                StringParam key,
+                                Array<String>& outputs)
+{
+  String entryDirectory = GetEntryDirectory(options, key);
+  if (!DirectoryExists(entryDirectory))
+    return false;
+
+  for (uint i = 0; i < outputs.Size(); ++i)
+  {
+    if (!FileExists(GetEntryFile(entryDirectory, i)))
+      return false;
+  }
+
+  String metaFile = GetEntryMetaFile(entryDirectory);
+  String meta = ReadFileIntoString(metaFile);
+
+  for (uint i = 0; i < outputs.Size(); ++i)
+  {
+    String cachedFile = GetEntryFile(entryDirectory, i);
+    String destFile = FilePath::Combine(options.OutputPath, outputs[i]);
+    if (!CopyFile(destFile, cachedFile))
+    {
+      CreateDirectoryAndParents(FilePath::GetDirectoryPath(destFile));
+      if (!CopyFile(destFile, cachedFile))
+        return false;
+    }
+
+    // The output has to be newer than the source and meta file so that the
+    // builder doesn't need building again
+    SetFileToCurrentTime(destFile);
+
+    // Mark the entry as recently used so trimming keeps it
+    SetFileToCurrentTime(cachedFile);
+  }
+
+  // Anything building would have written into the meta file
+  return builder->RestoreCachedMeta(options, meta);
+}
+
+void ContentBuildCache::Store(BuilderComponent* builder, BuildOptions& options, StringParam key, Array<String>& outputs)
+{
+  String entryDirectory = GetEntryDirectory(options, key);
+  for (uint i = 0; i < outputs.Size(); ++i)
+  {
+    String sourceFile = FilePath::Combine(options.OutputPath, outputs[i]);
+    String cachedFile = GetEntryFile(entryDirectory, i);
+    if (!FileExists(sourceFile) || FileExists(cachedFile))
+      continue;
+
+    // Other builds (possibly in other processes) never see a partially
+    // written output
+    FileCache::StoreFileCopy(cachedFile, sourceFile);
+  }
+
+  String metaFile = GetEntryMetaFile(entryDirectory);
+  String meta;
+  if (!FileExists(metaFile) && builder->SaveCachedMeta(options, meta))
+    FileCache::StoreFile(metaFile, (const byte*)meta.Data(), meta.SizeInBytes());
+}
+
+String ContentBuildCache::GetEntryDirectory(BuildOptions& options, StringParam key)
+{
+  return FileCache::GetEntryPath(options.CachePath, key);
+}
+
+String ContentBuildCache::GetEntryFile(StringParam entryDirectory, uint outputIndex)
+{
+  // Outputs are stored by index rather than by name since the outputs are
+  // named after the content item that stored them
+  return FilePath::Combine(entryDirectory, String::Format("Output%u", outputIndex));
+}
+
+String ContentBuildCache::GetEntryMetaFile(StringParam entryDirectory)
+{
+  return FilePath::Combine(entryDirectory, "Meta");
+}
+
+} // namespace Zero
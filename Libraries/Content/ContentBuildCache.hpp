@@ -0,0 +1,46 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+// Content addressed cache of builder outputs, shared by every project and
+// checkout on the machine. Outputs are keyed on a hash of the source file's
+// bytes, the builder's settings and the engine and builder versions (never file
+// times or resource names) so touching a file, switching branches, cloning
+// fresh or importing the same file into another project restores the
+// previously built outputs instead of processing the source file again. What
+// building writes into the meta file is cached with the outputs. The cache is
+// laid out and trimmed with FileCache.
+// Safe to use from job threads (multiple processes may share the cache).
+class ContentBuildCache
+{
+public:
+  // Builds the builder's content, restoring its outputs from the cache when
+  // possible and storing them in the cache otherwise. Builders without any
+  // cacheable outputs (or with the cache disabled) are always built.
+  static void BuildContent(BuilderComponent* builder, BuildOptions& options);
+
+  // Returns the cache key for the builder's outputs (empty if the source file
+  // can't be read).
+  static String GetKey(BuilderComponent* builder, BuildOptions& options);
+
+  // Copies every cached output to the output path and restores what building
+  // wrote into the meta file. Returns false if any output is missing from the
+  // cache or the meta couldn't be restored.
+  static bool Restore(BuilderComponent* builder, BuildOptions& options, StringParam key, Array<String>& outputs);
+
+  // Copies every output from the output path, and what building wrote into the
+  // meta file, into the cache.
+  static void Store(BuilderComponent* builder, BuildOptions& options, StringParam key, Array<String>& outputs);
+
+private:
+  // Directory holding the cached outputs for the key.
+  static String GetEntryDirectory(BuildOptions& options, StringParam key);
+  // File holding the cached output at the index in the entry directory.
+  static String GetEntryFile(StringParam entryDirectory, uint outputIndex);
+  // File holding the builder's cached meta in the entry directory.
+  static String GetEntryMetaFile(StringParam entryDirectory);
+};
+
+} // namespace Zero
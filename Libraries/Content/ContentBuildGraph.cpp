@@ -0,0 +1,160 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+// Number of slowest content items printed when not verbose
+static const uint cSlowestBuildPrintCount = 5;
+// Content items that build faster than this are not worth printing when not
+// verbose (in seconds)
+static const double cSlowBuildTime = 0.25;
+
+struct SortBySlowestBuild
+{
+  bool operator()(ContentBuildNode* left, ContentBuildNode* right)
+  {
+    return left->mBuildTime > right->mBuildTime;
+  }
+};
+
+// Content Build Node
+
+ContentBuildNode::ContentBuildNode(ContentItem* contentItem, BuildOptions& buildOptions) :
+    mContentItem(contentItem),
+    mBuildOptions(buildOptions),
+    mOnJobThread(false),
+    mBuildTime(0.0)
+{
+}
+
+// Content Build Graph
+
+ContentBuildGraph::ContentBuildGraph(ContentItemArray& contentItems, BuildOptions& buildOptions)
+{
+  mNodes.Reserve(contentItems.Size());
+  forRange (ContentItem* contentItem, contentItems.All())
+  {
+    ContentBuildNode* node = new ContentBuildNode(contentItem, buildOptions);
+    node->mOnJobThread = contentItem->CanBuildOnJobThread();
+    mNodes.PushBack(node);
+  }
+}
+
+ContentBuildGraph::~ContentBuildGraph()
+{
+  DeleteObjectsInContainer(mNodes);
+}
+
+void ContentBuildGraph::Build(bool useJobs, StringParam libraryName)
+{
+  // No job system?
+  if (!useJobs || Z::gJobs == nullptr)
+  {
+    // Build every content item on the main thread
+    for (uint i = 0; i < mNodes.Size(); ++i)
+    {
+      ContentBuildNode* node = mNodes[i];
+      UpdateProgress(libraryName, node, i + 1);
+      BuildNode(node);
+      FinishNode(node);
+    }
+    return;
+  }
+
+  // Start every job thread build
+  forRange (ContentBuildNode* node, mNodes.All())
+  {
+    if (!node->mOnJobThread)
+      continue;
+
+    node->mTask.mFunction = &BuildNodeTask;
+    node->mTask.mUserData = node;
+    Z::gJobs->Submit(&node->mTask);
+  }
+
+  // Build the main thread content items while the job threads build the rest
+  forRange (ContentBuildNode* node, mNodes.All())
+  {
+    if (!node->mOnJobThread)
+      BuildNode(node);
+  }
+
+  // Finish every content item in the order they were given
+  for (uint i = 0; i < mNodes.Size(); ++i)
+  {
+    ContentBuildNode* node = mNodes[i];
+    if (node->mOnJobThread)
+      Z::gJobs->Wait(&node->mTask);
+    UpdateProgress(libraryName, node, i + 1);
+    FinishNode(node);
+  }
+}
+
+uint ContentBuildGraph::GetNodeCount()
+{
+  return mNodes.Size();
+}
+
+ContentBuildNode* ContentBuildGraph::GetNode(uint index)
+{
+  return mNodes[index];
+}
+
+void ContentBuildGraph::PrintBuildTimes(StringParam libraryName, bool verbose)
+{
+  if (mNodes.Empty())
+    return;
+
+  Array<ContentBuildNode*> slowest(mNodes);
+  Sort(slowest.All(), SortBySlowestBuild());
+
+  if (verbose)
+  {
+    ZPrint("Content build times for '%s':\n", libraryName.c_str());
+    forRange (ContentBuildNode* node, slowest.All())
+    {
+      cstr thread = node->mOnJobThread ? "job" : "main";
+      ZPrint("  %.3fs %s (%s thread)\n", node->mBuildTime, node->mContentItem->Filename.c_str(), thread);
+    }
+    return;
+  }
+
+  // Nothing slow enough to mention?
+  if (slowest.Front()->mBuildTime < cSlowBuildTime)
+    return;
+
+  ZPrint("Slowest content builds for '%s':\n", libraryName.c_str());
+  uint printCount = Math::Min(uint(slowest.Size()), cSlowestBuildPrintCount);
+  for (uint i = 0; i < printCount && slowest[i]->mBuildTime >= cSlowBuildTime; ++i)
+    ZPrint("  %.3fs %s\n", slowest[i]->mBuildTime, slowest[i]->mContentItem->Filename.c_str());
+}
+
+void ContentBuildGraph::BuildNode(ContentBuildNode* node)
+{
+  Timer timer;
+  node->mContentItem->BuildContentItem(node->mBuildOptions);
+  node->mBuildTime = timer.UpdateAndGetTime();
+}
+
+void ContentBuildGraph::BuildNodeTask(JobTask* task)
+{
+  BuildNode((ContentBuildNode*)task->mUserData);
+}
+
+void ContentBuildGraph::FinishNode(ContentBuildNode* node)
+{
+  node->mContentItem->OnBuildFinished(node->mBuildOptions);
+}
+
+void ContentBuildGraph::UpdateProgress(StringParam libraryName, ContentBuildNode* node, uint finishedCount)
+{
+  static const String cProcessing("Processing");
+  Z::gEngine->LoadingUpdate(cProcessing,
+                            libraryName,
+                            node->mContentItem->Filename,
+                            ProgressType::Normal,
+                            (float)finishedCount / mNodes.Size());
+}
+
+} // namespace Zero
@@ -0,0 +1,70 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+// A content item being built by a content build graph
+class ContentBuildNode
+{
+public:
+  ContentBuildNode(ContentItem* contentItem, BuildOptions& buildOptions);
+
+  ContentItem* mContentItem;
+  // Each node is built with its own copy of the build options so that
+  // failures are reported per content item (and never written concurrently).
+  BuildOptions mBuildOptions;
+  // Completed once the content item is built (job thread builds only).
+  JobTask mTask;
+  // Built on a job thread rather than the main thread?
+  bool mOnJobThread;
+  // Time it took to build the content item (in seconds).
+  double mBuildTime;
+
+private:
+  // No Copy Constructor (the job task can't be copied)
+  ContentBuildNode(const ContentBuildNode&);
+  // No Copy Assignment Operator
+  ContentBuildNode& operator=(const ContentBuildNode&);
+};
+
+// Builds a set of content items concurrently on the job system. No builder reads
+// the output of another content item, so content items are independent of each
+// other. Content items that can't be built on a job thread are built on the
+// main thread. Everything that isn't safe to do on a job thread (finishing
+// builds, progress updates) is done on the main thread, in the order the
+// content items were given, so the results don't depend on the order the builds
+// happened to complete in.
+class ContentBuildGraph
+{
+public:
+  ContentBuildGraph(ContentItemArray& contentItems, BuildOptions& buildOptions);
+  ~ContentBuildGraph();
+
+  // Builds every content item (must be called on the main thread). If useJobs
+  // is false (or there is no job system) every content item is built on the
+  // main thread, in the order they were given.
+  void Build(bool useJobs, StringParam libraryName);
+
+  // Nodes in the order the content items were given.
+  uint GetNodeCount();
+  ContentBuildNode* GetNode(uint index);
+
+  // Prints the build time of every content item if verbose, otherwise
+  // the build time of the slowest content items.
+  void PrintBuildTimes(StringParam libraryName, bool verbose);
+
+private:
+  // Builds the node's content item on the calling thread.
+  static void BuildNode(ContentBuildNode* node);
+  // Job task function.
+  static void BuildNodeTask(JobTask* task);
+
+  // Calls OnBuildFinished on the content item (main thread only).
+  void FinishNode(ContentBuildNode* node);
+  void UpdateProgress(StringParam libraryName, ContentBuildNode* node, uint finishedCount);
+
+  Array<ContentBuildNode*> mNodes;
+};
+
+} // namespace Zero
@@ -164,17 +164,22 @@ bool ContentComposition::AnyNeedsBuilding(BuildOptions& options)
 
 void ContentComposition::BuildContentItem(BuildOptions& options)
 {
-  bool anyBuilt = false;
   forRange (BuilderComponent* bc, Builders.All())
   {
     if (bc->NeedsBuilding(options))
     {
-      anyBuilt = true;
-      bc->BuildContent(options);
+      options.Built = true;
+      ContentBuildCache::BuildContent(bc, options);
     }
   }
+}
+
+void ContentComposition::OnBuildFinished(BuildOptions& options)
+{
+  if (options.RestoredFromCache && options.Verbosity == Verbosity::Detailed)
+    ZPrint("Restored '%s' from the content build cache\n", Filename.c_str());
 
-  if (anyBuilt)
+  if (options.Built)
     ZPrint("Built %s\n", Filename.c_str());
 }
 
@@ -191,6 +196,16 @@ void ContentComposition::BuildListing(ResourceListing& listing)
   }
 }
 
+bool ContentComposition::CanBuildOnJobThread()
+{
+  forRange (BuilderComponent* bc, Builders.All())
+  {
+    if (!bc->CanBuildOnJobThread())
+      return false;
+  }
+  return true;
+}
+
 ContentComponent* ContentComposition::QueryComponentId(BoundType* typeId)
 {
   return mComponentMap.FindValue(typeId, nullptr);
@@ -74,8 +74,10 @@ public:
   void BuildContentItem(BuildOptions& options) override;
   void Serialize(Serializer& stream) override;
   void BuildListing(ResourceListing& listing) override;
+  bool CanBuildOnJobThread() override;
   void OnInitialize() override;
   ContentComponent* QueryComponentId(BoundType* typeId) override;
+  void OnBuildFinished(BuildOptions& options) override;
 
   void RemoveComponent(BoundType* componentType);
 
@@ -117,6 +119,51 @@ public:
   // Add built resources to listing.
   virtual void BuildListing(ResourceListing& listing);
 
+  // Can this builder build on a job thread? Builders that touch engine state
+  // (resources, notifications, the config) must build on the main thread.
+  virtual bool CanBuildOnJobThread()
+  {
+    return false;
+  }
+
+  // Adds the files this builder outputs (relative to the output path) that
+  // can be restored from the content build cache. Builders without any are
+  // always built (worth it for builders that do expensive processing).
+  virtual void GetCacheableOutputs(Array<String>& outputs)
+  {
+  }
+
+  // Saves what building wrote into the content item's meta file (such as
+  // TextureInfo) so that the content build cache can store it with the outputs,
+  // since meta files aren't shared between projects. Returns false if building
+  // doesn't write anything into the meta file.
+  virtual bool SaveCachedMeta(BuildOptions& options, String& meta)
+  {
+    return false;
+  }
+
+  // Writes meta saved by SaveCachedMeta back into the content item's meta file
+  // after the outputs are restored from the content build cache. Returns false
+  // if it couldn't be restored (the builder is built instead).
+  virtual bool RestoreCachedMeta(BuildOptions& options, StringParam meta)
+  {
+    return true;
+  }
+
+  // Serializes only the settings that change this builder's cacheable outputs
+  // (never the resource name or id, so that identical source files share
+  // content build cache entries across projects).
+  virtual void SerializeBuildSettings(Serializer& stream)
+  {
+  }
+
+  // Version of the builder's processing. Bump it when the output changes for
+  // the same source and settings so cached outputs aren't reused.
+  virtual uint GetBuildVersion()
+  {
+    return 0;
+  }
+
   // Rename resource generated from builder.
   virtual void Rename(StringParam newName);
 
@@ -197,12 +197,22 @@ void ContentItem::BuildContentItem(bool useJob)
 {
   BuildOptions options(mLibrary);
   BuildContentItem(options);
+  OnBuildFinished(options);
 }
 
 void ContentItem::BuildListing(ResourceListing& listing)
 {
 }
 
+bool ContentItem::CanBuildOnJobThread()
+{
+  return false;
+}
+
+void ContentItem::OnBuildFinished(BuildOptions& buildOptions)
+{
+}
+
 void ContentItem::Serialize(Serializer& stream)
 {
 }
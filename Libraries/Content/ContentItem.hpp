@@ -16,6 +16,7 @@ public:
 };
 
 typedef uint ContentItemId;
+typedef Array<ContentItem*> ContentItemArray;
 
 // A content item is an object that represents a content generating
 // item in the library. This is usually a single file and is generated
@@ -97,6 +98,11 @@ public:
   // Build the resource listing that this content item makes
   virtual void BuildListing(ResourceListing& listing);
 
+  // Can this content item be built on a job thread at the same time as other
+  // content items? Content items that touch engine state while building must
+  // be built on the main thread.
+  virtual bool CanBuildOnJobThread();
+
   // Serialize this content item.
   virtual void Serialize(Serializer& stream);
 
@@ -117,8 +123,14 @@ public:
   virtual void OnInitialize();
 
 protected:
+  friend class ContentBuildGraph;
+
   // Build the content item
   virtual void BuildContentItem(BuildOptions& buildOptions) = 0;
+
+  // Called on the main thread after the content item is built, for work
+  // that isn't safe to do on a job thread (such as reloading components).
+  virtual void OnBuildFinished(BuildOptions& buildOptions);
 };
 
 // Resource Meta Operations
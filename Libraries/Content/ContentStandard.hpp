@@ -33,8 +33,10 @@ public:
 #include "ContentLibrary.hpp"
 #include "BuildOptions.hpp"
 #include "ContentSystem.hpp"
+#include "ContentBuildGraph.hpp"
 #include "ContentUtility.hpp"
 #include "ContentComposition.hpp"
+#include "ContentBuildCache.hpp"
 #include "DataContent.hpp"
 #include "TagsContent.hpp"
 #include "BaseBuilders.hpp"
@@ -32,8 +32,15 @@ struct SortByLoadOrder
 {
   bool operator()(ResourceEntry& left, ResourceEntry& right)
   {
-    // First sort by load order, then name for determinism.
-    return left.LoadOrder < right.LoadOrder || (left.LoadOrder == right.LoadOrder && left.Name < right.Name);
+    // First sort by load order, then name, type and id for determinism
+    // (content items may finish building in any order).
+    if (left.LoadOrder != right.LoadOrder)
+      return left.LoadOrder < right.LoadOrder;
+    if (left.Name != right.Name)
+      return left.Name < right.Name;
+    if (left.Type != right.Type)
+      return left.Type < right.Type;
+    return left.mResourceId < right.mResourceId;
   }
 };
 
@@ -227,7 +234,7 @@ HandleOf<ResourcePackage> ContentSystem::BuildLibrary(Status& status, ContentLib
   Array<ContentItem*> items;
   items.Reserve(library->ContentItems.Size());
   items.Append(library->ContentItems.Values());
-  HandleOf<ResourcePackage> package = Z::gContentSystem->BuildContentItems(status, items, library, false);
+  HandleOf<ResourcePackage> package = Z::gContentSystem->BuildContentItems(status, items, library, true);
 
   String libraryPackageFile = FilePath::CombineWithExtension(outputPath, library->Name, ".pack");
   package->Save(libraryPackageFile);
@@ -715,23 +722,21 @@ ContentSystem::BuildContentItems(Status& status, ContentItemArray& toBuild, Cont
 
   BuildOptions buildOptions(library);
 
+  // Build independent content items concurrently
+  ContentBuildGraph buildGraph(toBuild, buildOptions);
+  buildGraph.Build(useJobs, library->Name);
+
   bool allBuilt = true;
 
-  for (uint i = 0; i < toBuild.Size(); ++i)
+  // Gather the results in the order the content items were given
+  for (uint i = 0; i < buildGraph.GetNodeCount(); ++i)
   {
-    // Process from this contentItem down.
-    ContentItem* contentItem = toBuild[i];
-    static const String cProcessing("Processing");
-    Z::gEngine->LoadingUpdate(
-        cProcessing, library->Name, contentItem->Filename, ProgressType::Normal, (float)(i + 1) / toBuild.Size());
-
-    contentItem->BuildContentItem(useJobs);
+    ContentBuildNode* node = buildGraph.GetNode(i);
+    ContentItem* contentItem = node->mContentItem;
 
-    if (buildOptions.Failure)
+    if (node->mBuildOptions.Failure)
     {
-      ZPrint("Content Build Failed, %s\n", buildOptions.Message.c_str());
-      buildOptions.Failure = false;
-      buildOptions.Message = String();
+      ZPrint("Content Build Failed, %s\n", node->mBuildOptions.Message.c_str());
       allBuilt = false;
     }
 
@@ -744,6 +749,8 @@ ContentSystem::BuildContentItems(Status& status, ContentItemArray& toBuild, Cont
 
   Sort(package->Resources.All(), SortByLoadOrder());
 
+  buildGraph.PrintBuildTimes(library->Name, buildOptions.Verbosity == Verbosity::Detailed);
+
   if (!allBuilt)
     status.SetFailed(String::Format("Failed to build content library '%s'", library->Name.c_str()));
 
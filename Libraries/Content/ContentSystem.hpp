@@ -195,6 +195,8 @@ public:
   String ContentOutputPath;
   /// Where the tools (curl, crash handler, etc) are located
   String ToolPath;
+  /// Content build cache shared by every project (empty if disabled)
+  String BuildCachePath;
 
   HashSet<ContentItemId> mModifiedContentItems;
 
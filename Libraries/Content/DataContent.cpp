@@ -112,6 +112,12 @@ void DataBuilder::BuildContent(BuildOptions& buildOptions)
   SetFileToCurrentTime(destFile);
 }
 
+bool DataBuilder::CanBuildOnJobThread()
+{
+  // Only copies the data file
+  return true;
+}
+
 void DataBuilder::BuildListing(ResourceListing& listing)
 {
   String destFile = GetOutputFile();
@@ -39,6 +39,7 @@ public:
   bool NeedsBuilding(BuildOptions& options) override;
   void BuildContent(BuildOptions& buildOptions) override;
   void BuildListing(ResourceListing& listing) override;
+  bool CanBuildOnJobThread() override;
 };
 
 } // namespace Zero
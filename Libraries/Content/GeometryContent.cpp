@@ -588,6 +588,12 @@ void GeometryContent::BuildContentItem(BuildOptions& options)
   }
 }
 
+bool GeometryContent::CanBuildOnJobThread()
+{
+  // Imports through Assimp and may delete the source files on failure
+  return false;
+}
+
 ZilchDefineType(GeneratedArchetype, builder, type)
 {
   ZeroBindComponent();
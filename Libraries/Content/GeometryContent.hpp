@@ -140,6 +140,7 @@ public:
   String GetName();
   // Content Item Interface
   void BuildContentItem(BuildOptions& options) override;
+  bool CanBuildOnJobThread() override;
   GeometryContent(ContentInitializer& initializer);
 };
 
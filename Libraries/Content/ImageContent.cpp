@@ -19,9 +19,16 @@ void ImageContent::BuildContentItem(BuildOptions& options)
   forRange (BuilderComponent* bc, Builders.All())
   {
     if (bc->NeedsBuilding(options))
-      bc->BuildContent(options);
+      ContentBuildCache::BuildContent(bc, options);
   }
+}
+
+void ImageContent::OnBuildFinished(BuildOptions& options)
+{
+  ContentComposition::OnBuildFinished(options);
 
+  // Reloading components isn't safe on a job thread so it waits for the build
+  // to finish
   if (mReload)
   {
     ClearComponents();
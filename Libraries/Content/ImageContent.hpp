@@ -13,6 +13,7 @@ public:
   ImageContent();
 
   void BuildContentItem(BuildOptions& options) override;
+  void OnBuildFinished(BuildOptions& options) override;
 
   bool mReload;
 };
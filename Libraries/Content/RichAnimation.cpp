@@ -1694,6 +1694,12 @@ void RichAnimationBuilder::BuildContent(BuildOptions& buildOptions)
   SetFileToCurrentTime(destFile);
 }
 
+bool RichAnimationBuilder::CanBuildOnJobThread()
+{
+  // Bakes to a runtime animation resource
+  return false;
+}
+
 RichAnimation::range::range(TrackNode* root) : mCurrent(root)
 {
 }
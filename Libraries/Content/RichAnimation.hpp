@@ -406,6 +406,7 @@ public:
   void Initialize(ContentComposition* item) override;
   void Serialize(Serializer& stream) override;
   void BuildContent(BuildOptions& buildOptions) override;
+  bool CanBuildOnJobThread() override;
 
   Archetype* GetPreviewArchetype();
   void SetPreviewArchetype(Archetype* archetype);
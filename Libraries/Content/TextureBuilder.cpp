@@ -107,6 +107,11 @@ void TextureBuilder::Serialize(Serializer& stream)
   SerializeName(Name);
   SerializeName(mResourceId);
 
+  SerializeBuildSettings(stream);
+}
+
+void TextureBuilder::SerializeBuildSettings(Serializer& stream)
+{
   SerializeEnumNameDefault(TextureType, mType, TextureType::Texture2D);
   SerializeEnumNameDefault(TextureCompression, mCompression, TextureCompression::None);
   SerializeEnumNameDefault(TextureAddressing, mAddressingX, TextureAddressing::Repeat);
@@ -200,6 +205,60 @@ void TextureBuilder::BuildContent(BuildOptions& buildOptions)
   }
 }
 
+void TextureBuilder::GetCacheableOutputs(Array<String>& outputs)
+{
+  // Mipmapping and compression are slow enough to be worth caching
+  outputs.PushBack(GetOutputFile());
+}
+
+bool TextureBuilder::SaveCachedMeta(BuildOptions& options, String& meta)
+{
+  // Processing the texture writes its TextureInfo into the meta file
+  String metaFile = BuildString(FilePath::Combine(options.SourcePath, mOwner->Filename), ".meta");
+  ImageContent* imageContent = new ImageContent();
+
+  bool saved = false;
+  if (LoadFromDataFile(*imageContent, metaFile))
+  {
+    if (TextureInfo* info = imageContent->has(TextureInfo))
+    {
+      TextSaver saver;
+      saver.OpenBuffer();
+      saver.SerializePolymorphic(*info);
+      meta = saver.GetString();
+      saved = true;
+    }
+  }
+
+  delete imageContent;
+  return saved;
+}
+
+bool TextureBuilder::RestoreCachedMeta(BuildOptions& options, StringParam meta)
+{
+  // Without the TextureInfo the meta file would be left without it
+  if (meta.Empty())
+    return false;
+
+  TextureInfo info;
+  DataBlock block((byte*)meta.Data(), meta.SizeInBytes());
+  if (!LoadFromDataBlock(info, block, DataFileFormat::Text))
+    return false;
+
+  String inputFile = FilePath::Combine(options.SourcePath, mOwner->Filename);
+  String outputFile = FilePath::Combine(options.OutputPath, GetOutputFile());
+  TextureImporter importer(inputFile, outputFile, String());
+
+  Status status;
+  ImageProcessorCodes::Enum result = importer.RestoreTextureInfo(info, status);
+  if (result == ImageProcessorCodes::Failed)
+    return false;
+
+  if (result == ImageProcessorCodes::Reload)
+    ((ImageContent*)mOwner)->mReload = true;
+  return true;
+}
+
 void TextureBuilder::Rename(StringParam newName)
 {
   Name = newName;
@@ -82,6 +82,10 @@ public:
   bool NeedsBuilding(BuildOptions& options) override;
   void BuildListing(ResourceListing& listing) override;
   void BuildContent(BuildOptions& buildOptions) override;
+  void SerializeBuildSettings(Serializer& stream) override;
+  void GetCacheableOutputs(Array<String>& outputs) override;
+  bool SaveCachedMeta(BuildOptions& options, String& meta) override;
+  bool RestoreCachedMeta(BuildOptions& options, StringParam meta) override;
   void Rename(StringParam newName) override;
 
   // Properties
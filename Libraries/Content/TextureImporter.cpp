@@ -375,23 +375,8 @@ ImageProcessorCodes::Enum TextureImporter::ProcessTexture(Status& status)
     return ImageProcessorCodes::Failed;
   }
 
-  if (!FileExists(mMetaFile))
-  {
-    ZPrint("Missing meta file '%s'\n", mMetaFile.c_str());
+  if (!LoadMeta(status))
     return ImageProcessorCodes::Failed;
-  }
-
-  mImageContent = new ImageContent();
-  bool metaLoaded = LoadFromDataFile(*mImageContent, mMetaFile);
-  mBuilder = mImageContent->has(TextureBuilder);
-
-  if (metaLoaded == false || mBuilder == nullptr)
-  {
-    mBuilder = nullptr;
-    delete mImageContent;
-    status.SetFailed(String::Format("Failed to load meta file '%s'", mMetaFile.c_str()));
-    return ImageProcessorCodes::Failed;
-  }
 
   String extension = FilePath::GetExtension(mInputFile);
 
@@ -673,6 +658,66 @@ ImageProcessorCodes::Enum TextureImporter::ProcessTexture(Status& status)
   float fixedSize = Math::Floor(dataSize * 1000.0f) / 1000.0f;
   String size = String::Format("%.3f MB", fixedSize);
 
+  UpdateTextureInfo(fileType, loadFormat, dimensions, size);
+
+  // Write output
+  WriteTextureFile(status);
+
+  mBuilder = nullptr;
+  delete mImageContent;
+
+  if (status.Failed())
+    return ImageProcessorCodes::Failed;
+  else if (mMetaChanged)
+    return ImageProcessorCodes::Reload;
+  else
+    return ImageProcessorCodes::Success;
+}
+
+ImageProcessorCodes::Enum TextureImporter::RestoreTextureInfo(TextureInfo& cachedInfo, Status& status)
+{
+  if (!LoadMeta(status))
+    return ImageProcessorCodes::Failed;
+
+  UpdateTextureInfo(cachedInfo.mFileType, cachedInfo.mLoadFormat, cachedInfo.mDimensions, cachedInfo.mSize);
+
+  mBuilder = nullptr;
+  delete mImageContent;
+
+  if (mMetaChanged)
+    return ImageProcessorCodes::Reload;
+  else
+    return ImageProcessorCodes::Success;
+}
+
+bool TextureImporter::LoadMeta(Status& status)
+{
+  if (!FileExists(mMetaFile))
+  {
+    ZPrint("Missing meta file '%s'\n", mMetaFile.c_str());
+    return false;
+  }
+
+  mImageContent = new ImageContent();
+  bool metaLoaded = LoadFromDataFile(*mImageContent, mMetaFile);
+  mBuilder = mImageContent->has(TextureBuilder);
+
+  if (metaLoaded == false || mBuilder == nullptr)
+  {
+    mBuilder = nullptr;
+    delete mImageContent;
+    status.SetFailed(String::Format("Failed to load meta file '%s'", mMetaFile.c_str()));
+    return false;
+  }
+
+  return true;
+}
+
+void TextureImporter::UpdateTextureInfo(StringParam fileType,
+                                        StringParam loadFormat,
+                                        StringParam dimensions,
+                                        StringParam size)
+{
   // Check for meta update
   TextureInfo* info = mImageContent->has(TextureInfo);
   if (info == nullptr)
@@ -691,19 +736,6 @@ ImageProcessorCodes::Enum TextureImporter::ProcessTexture(Status& status)
     SaveToDataFile(*mImageContent, mMetaFile);
     mMetaChanged = true;
   }
-
-  // Write output
-  WriteTextureFile(status);
-
-  mBuilder = nullptr;
-  delete mImageContent;
-
-  if (status.Failed())
-    return ImageProcessorCodes::Failed;
-  else if (mMetaChanged)
-    return ImageProcessorCodes::Reload;
-  else
-    return ImageProcessorCodes::Success;
 }
 
 void TextureImporter::LoadImageData(Status& status, StringParam extension)
@@ -24,6 +24,16 @@ public:
 
   ImageProcessorCodes::Enum ProcessTexture(Status& status);
 
+  // Writes texture info restored from the content build cache into the meta
+  // file (ProcessTexture writes it when the texture is processed).
+  ImageProcessorCodes::Enum RestoreTextureInfo(TextureInfo& cachedInfo, Status& status);
+
+  // Loads the image content and texture builder from the meta file.
+  bool LoadMeta(Status& status);
+
+  // Saves the texture info into the meta file if it changed.
+  void UpdateTextureInfo(StringParam fileType, StringParam loadFormat, StringParam dimensions, StringParam size);
+
   void LoadImageData(Status& status, StringParam extension);
 
   void WriteTextureFile(Status& status);
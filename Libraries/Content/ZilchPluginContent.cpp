@@ -145,6 +145,12 @@ void ZilchPluginBuilder::BuildContent(BuildOptions& buildOptions)
   }
 }
 
+bool ZilchPluginBuilder::CanBuildOnJobThread()
+{
+  // Notifies the runtime resource that it was modified
+  return false;
+}
+
 void ZilchPluginBuilder::BuildListing(ResourceListing& listing)
 {
   DataBuilder::BuildListing(listing);
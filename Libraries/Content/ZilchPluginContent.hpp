@@ -26,6 +26,7 @@ public:
   void Serialize(Serializer& stream) override;
   void Generate(ContentInitializer& initializer) override;
   void BuildContent(BuildOptions& buildOptions) override;
+  bool CanBuildOnJobThread() override;
   void BuildListing(ResourceListing& listing) override;
 };
 
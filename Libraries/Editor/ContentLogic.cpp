@@ -31,6 +31,14 @@ void LoadContentConfig()
 
   contentSystem->mHistoryEnabled = contentConfig->HistoryEnabled;
 
+  // The build cache is keyed on file contents so it is shared by every
+  // project and version
+  if (contentConfig->BuildCacheEnabled)
+  {
+    contentSystem->BuildCachePath = FilePath::Combine(appCacheDirectory, "ZeroContentCache");
+    FileCache::Trim(contentSystem->BuildCachePath, u64(contentConfig->BuildCacheMaxSizeMb) * 1024 * 1024);
+  }
+
   // To avoid conflicts of assets of different versions(especially when the
   // version selector goes live) set the content folder to a unique directory
   // based upon the version number
@@ -858,6 +858,32 @@ void OnResaveAllResources(Editor* editor)
   }
 }
 
+void OnClearContentBuildCache(Editor* editor)
+{
+  FileCache::Clear(Z::gContentSystem->BuildCachePath);
+  ZPrint("Cleared the content build cache\n");
+}
+
+void OnPhysicsSolverBenchmark(Editor* editor)
+{
+  RunPhysicsSolverBenchmarks();
+}
+
+void OnBroadPhaseBenchmark(Editor* editor)
+{
+  RunBroadPhaseBenchmarks();
+}
+
+void OnReplicationBenchmark(Editor* editor)
+{
+  RunReplicationBenchmarks();
+}
+
+void OnGraphicsBenchmark(Editor* editor)
+{
+  RunGraphicsBenchmarks();
+}
+
 void EditorRescueCall(void* userData)
 {
   // Get the error context printed
@@ -1023,6 +1049,7 @@ void CreateEditor(OsWindow* mainWindow, StringParam projectFile, StringParam new
     Connect(Z::gEngine, Events::BlockingTaskFinish, editorMain, &EditorMain::OnBlockingTaskFinish);
 
     BindCommand("StressTest", StressTest);
+    commands->AddCommand("ClearContentBuildCache", BindCommandFunction(OnClearContentBuildCache));
     // Add a command to write out all bound types in the engine
     DeveloperConfig* devConfig = config->has(DeveloperConfig);
     if (devConfig != nullptr)
@@ -1030,6 +1057,10 @@ void CreateEditor(OsWindow* mainWindow, StringParam projectFile, StringParam new
       commands->AddCommand("ExportTypeList", BindCommandFunction(OnExportTypeList));
       commands->AddCommand("ResaveAllResources", BindCommandFunction(OnResaveAllResources));
       commands->AddCommand("OnExportCommandsList", BindCommandFunction(OnExportCommandsList));
+      commands->AddCommand("PhysicsSolverBenchmark", BindCommandFunction(OnPhysicsSolverBenchmark));
+      commands->AddCommand("BroadPhaseBenchmark", BindCommandFunction(OnBroadPhaseBenchmark));
+      commands->AddCommand("ReplicationBenchmark", BindCommandFunction(OnReplicationBenchmark));
+      commands->AddCommand("GraphicsBenchmark", BindCommandFunction(OnGraphicsBenchmark));
     }
 
     //-------------------------------------------------------- Tool Bar Creation
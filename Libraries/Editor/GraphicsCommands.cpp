@@ -9,9 +9,16 @@ void ForceCompileAllShaders(Editor* editor)
   Z::gEngine->has(GraphicsEngine)->ForceCompileAllShaders();
 }
 
+void ClearShaderCache(Editor* editor)
+{
+  Z::gEngine->has(GraphicsEngine)->ClearShaderCache();
+  ZPrint("Cleared the shader cache\n");
+}
+
 void BindGraphicsCommands(Cog* config, CommandManager* commands)
 {
   commands->AddCommand("ForceCompileAllShaders", BindCommandFunction(ForceCompileAllShaders));
+  commands->AddCommand("ClearShaderCache", BindCommandFunction(ClearShaderCache));
 }
 
 } // namespace Zero
@@ -101,7 +101,7 @@ void RunGroupImport(ImportOptions& options)
 
   Status status;
   HandleOf<ResourcePackage> packageHandle =
-      Z::gContentSystem->BuildContentItems(status, contentToBuild, library, false);
+      Z::gContentSystem->BuildContentItems(status, contentToBuild, library, true);
   ResourcePackage* package = packageHandle;
   DoNotifyStatus(status);
 
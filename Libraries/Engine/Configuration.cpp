@@ -69,6 +69,8 @@ void ContentConfig::Serialize(Serializer& stream)
   SerializeNameDefault(LibraryDirectories, LibraryDirectories);
   SerializeEnumNameDefault(Verbosity, ContentVerbosity, Verbosity::Minimal);
   SerializeNameDefault(HistoryEnabled, true);
+  SerializeNameDefault(BuildCacheEnabled, true);
+  SerializeNameDefault(BuildCacheMaxSizeMb, 2048u);
 }
 
 ZilchDefineType(UserConfig, builder, type)
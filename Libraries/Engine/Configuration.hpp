@@ -102,6 +102,13 @@ public:
   Array<String> LibraryDirectories;
   /// History stores files instead of deleting them
   bool HistoryEnabled;
+  /// Restore built content and translated shaders from a cache shared by
+  /// every project instead of processing unchanged files again.
+  bool BuildCacheEnabled;
+  /// Maximum size of the content and shader build caches (each) in megabytes.
+  /// The least recently used entries are removed on startup once a cache grows
+  /// past it.
+  uint BuildCacheMaxSizeMb;
 };
 
 /// Configuration component that Contains developer settings. Used to indicate a
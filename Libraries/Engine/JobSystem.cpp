@@ -21,75 +21,216 @@ namespace Z
 JobSystem* gJobs = nullptr;
 }
 
-JobSystem::JobSystem()
+// The worker that is running on the current thread (null on non-worker threads).
+ZeroThreadLocal JobWorker* gCurrentJobWorker = nullptr;
+
+const uint cJobWorkerCount = 10;
+
+// The most tasks a single ParallelFor will hand out to workers.
+const uint cMaxParallelForTasks = 32;
+
+JobTask::JobTask() :
+    mFunction(nullptr),
+    mUserData(nullptr),
+    mBlockers(1),
+    mComplete(false),
+    mDependentsReleased(false)
 {
-  if (ThreadingEnabled)
+}
+
+JobTask::JobTask(TaskFunction function, void* userData) :
+    mFunction(function),
+    mUserData(userData),
+    mBlockers(1),
+    mComplete(false),
+    mDependentsReleased(false)
+{
+}
+
+void JobTask::DependsOn(JobTask* dependency)
+{
+  dependency->mDependentsLock.Lock();
+  // If the dependency already finished there is nothing to wait on.
+  if (!dependency->mDependentsReleased)
   {
-    mWorkers.Resize(10);
+    ++mBlockers;
+    dependency->mDependents.PushBack(this);
+  }
+  dependency->mDependentsLock.Unlock();
+}
 
-    for (uint i = 0; i < mWorkers.Size(); ++i)
+bool JobTask::IsComplete()
+{
+  return mComplete;
+}
+
+JobEntry::JobEntry() : mTask(nullptr), mParallelFor(nullptr)
+{
+}
+
+JobEntry::JobEntry(const HandleOf<Job>& job) : mJob(job), mTask(nullptr), mParallelFor(nullptr)
+{
+}
+
+JobEntry::JobEntry(JobTask* task) : mTask(task), mParallelFor(nullptr)
+{
+}
+
+JobEntry::JobEntry(ParallelForContext* parallelFor) : mTask(nullptr), mParallelFor(parallelFor)
+{
+}
+
+bool JobEntry::IsTask() const
+{
+  return mTask != nullptr || mParallelFor != nullptr;
+}
+
+void JobEntry::Clear()
+{
+  mJob.Clear();
+  mTask = nullptr;
+  mParallelFor = nullptr;
+}
+
+JobWorkerStats::JobWorkerStats() : mJobsExecuted(0), mJobsStolen(0), mIdleTime(0.0)
+{
+}
+
+JobDeque::JobDeque() : mHead(0)
+{
+}
+
+void JobDeque::PushBack(const JobEntry& entry)
+{
+  mLock.Lock();
+  mJobs.PushBack(entry);
+  mLock.Unlock();
+}
+
+bool JobDeque::PopBack(JobEntry& entryOut)
+{
+  mLock.Lock();
+  bool found = mHead < mJobs.Size();
+  if (found)
+  {
+    entryOut = mJobs.Back();
+    mJobs.PopBack();
+
+    if (mHead == mJobs.Size())
     {
-      mWorkers[i] = new Thread();
-      Thread& thread = *mWorkers[i];
-      thread.Initialize(&Thread::ObjectEntryCreator<JobSystem, &JobSystem::WorkerThreadEntry>, this, "Background");
+      mJobs.Clear();
+      mHead = 0;
     }
   }
+  mLock.Unlock();
+  return found;
 }
 
-JobSystem::~JobSystem()
+bool JobDeque::PopFront(JobEntry& entryOut)
 {
-  // Cancel all active Jobs.
   mLock.Lock();
-  // Active job range is safe because of the lock.
-  forRange (Job& job, mActiveJobs.All())
-    job.Cancel();
+  bool found = mHead < mJobs.Size();
+  if (found)
+  {
+    entryOut = mJobs[mHead];
+    mJobs[mHead].Clear();
+    ++mHead;
 
-  // Release all active and pending job references that we own (this may delete
-  // the jobs).
-  mPendingJobs.Clear();
+    if (mHead == mJobs.Size())
+    {
+      mJobs.Clear();
+      mHead = 0;
+    }
+  }
   mLock.Unlock();
+  return found;
+}
 
-  // Increment the counter but push no jobs
-  // allowing each background thread to unblock.
-  for (uint i = 0; i < mWorkers.Size(); ++i)
-    mJobCounter.Increment();
+void JobDeque::Clear()
+{
+  mLock.Lock();
+  mJobs.Clear();
+  mHead = 0;
+  mLock.Unlock();
+}
 
-  // Wait for each thread to shutdown.
-  for (uint i = 0; i < mWorkers.Size(); ++i)
+JobWorker::JobWorker(JobSystem* system, uint index) : mSystem(system), mIndex(index)
+{
+}
+
+OsInt JobWorker::WorkerThreadEntry()
+{
+  gCurrentJobWorker = this;
+
+  for (;;)
   {
-    Thread& thread = *mWorkers[i];
-    thread.WaitForCompletion();
+    if (!mSystem->RunOneJob(this))
+      return 0;
   }
+}
 
-  // Clear all active jobs now that all threads have stopped (may release the
-  // memory for jobs). There should be no more threads running, but we lock just
-  // to be safe.
-  mLock.Lock();
-  mActiveJobs.Clear();
-  mLock.Unlock();
+JobSystem::JobSystem() : mOutstandingJobs(0), mShuttingDown(false)
+{
+  if (ThreadingEnabled)
+  {
+    mWorkers.Resize(cJobWorkerCount);
 
-  // Delete all threads.
-  DeleteObjectsInContainer(mWorkers);
+    // Create all the workers before starting any threads so that
+    // stealing never sees a partially constructed worker list.
+    for (uint i = 0; i < mWorkers.Size(); ++i)
+      mWorkers[i] = new JobWorker(this, i);
+
+    for (uint i = 0; i < mWorkers.Size(); ++i)
+    {
+      Thread& thread = mWorkers[i]->mThread;
+      thread.Initialize(
+          &Thread::ObjectEntryCreator<JobWorker, &JobWorker::WorkerThreadEntry>, mWorkers[i], "Background");
+    }
+  }
 }
 
-Job* JobSystem::GetNextJob()
+JobSystem::~JobSystem()
 {
-  Job* job = nullptr;
+  mShuttingDown = true;
 
-  // Locked pop front
-  mLock.Lock();
-  if (!mPendingJobs.Empty())
+  // Cancel all active Jobs.
+  forRange (JobWorker* worker, mWorkers.All())
   {
-    HandleOf<Job> jobHandle = mPendingJobs.Back();
-    job = jobHandle;
-    mPendingJobs.PopBack();
-    mActiveJobs.PushBack(jobHandle);
+    worker->mCurrentJobLock.Lock();
+    if (Job* job = worker->mCurrentJob)
+      job->Cancel();
+    worker->mCurrentJobLock.Unlock();
   }
-  mLock.Unlock();
 
-  // We don't need to return a handle because the job will
-  // be kept alive by being inside of mActiveJobs.
-  return job;
+  // Release all pending job references that we own (this may delete the jobs).
+  // Tasks are kept, something may still be waiting on them.
+  mInjectedJobs.Clear();
+  forRange (JobWorker* worker, mWorkers.All())
+    worker->mJobs.Clear();
+
+  // Increment the counter but push no jobs
+  // allowing each background thread to unblock.
+  for (uint i = 0; i < mWorkers.Size(); ++i)
+    mJobCounter.Increment();
+
+  // Wait for each thread to shutdown.
+  forRange (JobWorker* worker, mWorkers.All())
+    worker->mThread.WaitForCompletion();
+
+  // Run every task that is still queued so that they all complete (running
+  // a task may queue its dependents, which are run here as well).
+  JobEntry entry;
+  while (FindTask(nullptr, entry))
+    RunEntry(nullptr, entry);
+
+  // Clear any jobs that were added by jobs that finished during shutdown
+  // (may release the memory for jobs).
+  mInjectedJobs.Clear();
+  forRange (JobWorker* worker, mWorkers.All())
+    worker->mJobs.Clear();
+
+  // Delete all workers (and their threads).
+  DeleteObjectsInContainer(mWorkers);
 }
 
 void JobSystem::RunJobsTimeSliced(double seconds)
@@ -100,78 +241,394 @@ void JobSystem::RunJobsTimeSliced(double seconds)
   Timer timer;
   do
   {
-    if (!RunOneJob())
+    // Without threads there are no workers, so everything is in the injection queue.
+    if (!TryRunOneJob(nullptr))
       return;
   } while (timer.UpdateAndGetTime() < seconds);
 }
 
 bool JobSystem::AreAllJobsCompleted()
 {
-  mLock.Lock();
-  bool completed = mPendingJobs.Empty() && mActiveJobs.Empty();
-  mLock.Unlock();
-  return completed;
+  return mOutstandingJobs == 0;
 }
 
-OsInt JobSystem::WorkerThreadEntry()
+uint JobSystem::GetWorkerCount()
 {
-  for (;;)
-  {
-    if (!RunOneJob())
-      return 0;
-  }
+  return mWorkers.Size();
+}
+
+void JobSystem::GetWorkerStats(Array<JobWorkerStats>& statsOut)
+{
+  statsOut.Resize(mWorkers.Size());
+  for (uint i = 0; i < mWorkers.Size(); ++i)
+    statsOut[i] = mWorkers[i]->mStats;
+}
+
+JobWorker* JobSystem::GetCurrentWorker()
+{
+  JobWorker* worker = gCurrentJobWorker;
+  if (worker != nullptr && worker->mSystem == this)
+    return worker;
+  return nullptr;
 }
 
 void JobSystem::AddJob(Job* job)
 {
+  // If the job is already queued or running then the runner
+  // will see the incremented count and execute it again.
+  if (job->mRunCount++ != 0)
+    return;
+
+  ++mOutstandingJobs;
+
   if (!ThreadingEnabled && job->mRunImmediateWhenThreadingDisabled)
   {
-    ++job->mRunCount;
     RunJob(job);
     return;
   }
 
-  mLock.Lock();
-  if (job->mRunCount == 0)
-    mPendingJobs.PushBack(job);
-  ++job->mRunCount;
-  mLock.Unlock();
+  Enqueue(JobEntry(HandleOf<Job>(job)));
+}
 
-  // Signal that a job has been added, which will unblock the waiting workers.
+void JobSystem::Submit(JobTask* task)
+{
+  // Release the blocker held until submission. Whoever
+  // releases the last blocker is responsible for queuing it.
+  if (--task->mBlockers != 0)
+    return;
+
+  ++mOutstandingJobs;
+  Enqueue(JobEntry(task));
+}
+
+void JobSystem::Wait(JobTask* task)
+{
+  JobWorker* worker = GetCurrentWorker();
+  while (!task->IsComplete())
+  {
+    // Help out rather than block so that waiting inside a job (or with
+    // threading disabled) can't deadlock. Only tasks are run, jobs can take a
+    // long time and aren't written to run on whatever thread is waiting.
+    if (!TryRunOneTask(worker))
+      Os::Sleep(0);
+  }
+}
+
+// State shared by the calling thread and every helper of one ParallelFor.
+// Helpers that haven't started by the time the range is finished still hold a
+// reference, so the context is reference counted rather than on the stack.
+class ParallelForContext
+{
+public:
+  ParallelForContext(uint begin, uint end, uint minChunkSize, uint participants) :
+      mNext(begin),
+      mEnd(end),
+      mCount(end - begin),
+      mMinChunkSize(Math::Max(minChunkSize, 1u)),
+      mParticipants(participants),
+      mFinished(0),
+      mReferences(1)
+  {
+  }
+
+  void AddReference()
+  {
+    ++mReferences;
+  }
+
+  void Release()
+  {
+    if (--mReferences == 0)
+      delete this;
+  }
+
+  // Claims the next chunk of the range. Chunks are a fraction of what remains
+  // so early chunks are big (low overhead) and late chunks are small (balance).
+  bool ClaimChunk(uint& startOut, uint& endOut)
+  {
+    for (;;)
+    {
+      s32 start = mNext;
+      if (start >= mEnd)
+        return false;
+
+      s32 remaining = mEnd - start;
+      s32 size = Math::Max(remaining / s32(mParticipants * 2), s32(mMinChunkSize));
+      size = Math::Min(size, remaining);
+
+      if (mNext.CompareExchange(start + size, start))
+      {
+        startOut = uint(start);
+        endOut = uint(start + size);
+        return true;
+      }
+    }
+  }
+
+  void Run()
+  {
+    uint start, end;
+    while (ClaimChunk(start, end))
+    {
+      mFunction(mUserData, start, end);
+      mFinished += s32(end - start);
+    }
+  }
+
+  // Has every claimed chunk been run?
+  bool IsFinished()
+  {
+    return mFinished == mCount;
+  }
+
+  Atomic<s32> mNext;
+  s32 mEnd;
+  s32 mCount;
+  uint mMinChunkSize;
+  uint mParticipants;
+  JobSystem::ParallelForFunction mFunction;
+  void* mUserData;
+  // Number of indices that have been processed.
+  Atomic<s32> mFinished;
+  Atomic<s32> mReferences;
+};
+
+void JobSystem::ParallelFor(uint begin, uint end, ParallelForFunction function, void* userData, uint minChunkSize)
+{
+  if (begin >= end)
+    return;
+
+  uint count = end - begin;
+  minChunkSize = Math::Max(minChunkSize, 1u);
+  uint chunkCount = (count + minChunkSize - 1) / minChunkSize;
+
+  // The calling thread always participates, so only hand out extra tasks
+  // when there is more than one chunk and someone to run them.
+  uint taskCount = Math::Min(GetWorkerCount(), chunkCount - 1);
+  taskCount = Math::Min(taskCount, cMaxParallelForTasks);
+
+  if (taskCount == 0)
+  {
+    function(userData, begin, end);
+    return;
+  }
+
+  ParallelForContext* context = new ParallelForContext(begin, end, minChunkSize, taskCount + 1);
+  context->mFunction = function;
+  context->mUserData = userData;
+
+  // Each helper holds a reference to the context until it has run
+  for (uint i = 0; i < taskCount; ++i)
+  {
+    context->AddReference();
+    ++mOutstandingJobs;
+    Enqueue(JobEntry(context));
+  }
+
+  context->Run();
+
+  // Every chunk has been claimed, so only the chunks other threads are in the
+  // middle of running are left. Helpers that haven't started yet have nothing
+  // left to do, there's no need to wait for them (or run anything else).
+  while (!context->IsFinished())
+    Os::Sleep(0);
+
+  context->Release();
+}
+
+void JobSystem::Enqueue(const JobEntry& entry)
+{
+  // Workers keep the jobs they spawn local (good for cache and no contention),
+  // everyone else feeds the injection queue.
+  JobWorker* worker = GetCurrentWorker();
+  if (worker)
+    (entry.IsTask() ? worker->mTasks : worker->mJobs).PushBack(entry);
+  else
+    (entry.IsTask() ? mInjectedTasks : mInjectedJobs).PushBack(entry);
+
+  // Signal that a job has been added, which will unblock a waiting worker.
   mJobCounter.Increment();
 }
 
-bool JobSystem::RunOneJob()
+bool JobSystem::RunOneJob(JobWorker* worker)
 {
+  Timer idleTimer;
   mJobCounter.WaitAndDecrement();
-  Job* job = GetNextJob();
 
-  // No jobs and Semaphore release
-  // that means we are shutting down.
-  if (job == nullptr)
+  if (mShuttingDown)
+    return false;
+
+  // A thread helping in Wait may have taken the job we were woken up for.
+  JobEntry entry;
+  bool found = FindJob(worker, entry);
+
+  idleTimer.Update();
+  worker->mStats.mIdleTime += idleTimer.Time();
+
+  if (found)
+    RunEntry(worker, entry);
+  return true;
+}
+
+bool JobSystem::TryRunOneJob(JobWorker* worker)
+{
+  JobEntry entry;
+  if (!FindJob(worker, entry))
+    return false;
+
+  RunEntry(worker, entry);
+  return true;
+}
+
+bool JobSystem::TryRunOneTask(JobWorker* worker)
+{
+  JobEntry entry;
+  if (!FindTask(worker, entry))
     return false;
 
-  RunJob(job);
+  RunEntry(worker, entry);
   return true;
 }
 
+bool JobSystem::FindJob(JobWorker* worker, JobEntry& entryOut)
+{
+  // Tasks first, they're short and someone may be waiting on them
+  if (FindTask(worker, entryOut))
+    return true;
+
+  if (worker && worker->mJobs.PopBack(entryOut))
+    return true;
+
+  if (mInjectedJobs.PopFront(entryOut))
+    return true;
+
+  if (StealJob(worker, false, entryOut))
+  {
+    if (worker)
+      ++worker->mStats.mJobsStolen;
+    return true;
+  }
+  return false;
+}
+
+bool JobSystem::FindTask(JobWorker* worker, JobEntry& entryOut)
+{
+  if (worker && worker->mTasks.PopBack(entryOut))
+    return true;
+
+  if (mInjectedTasks.PopFront(entryOut))
+    return true;
+
+  if (StealJob(worker, true, entryOut))
+  {
+    if (worker)
+      ++worker->mStats.mJobsStolen;
+    return true;
+  }
+  return false;
+}
+
+bool JobSystem::StealJob(JobWorker* thief, bool task, JobEntry& entryOut)
+{
+  // Start with our neighbor so that thieves spread out over the victims.
+  uint workerCount = mWorkers.Size();
+  uint startIndex = thief ? thief->mIndex + 1 : 0;
+  for (uint i = 0; i < workerCount; ++i)
+  {
+    JobWorker* victim = mWorkers[(startIndex + i) % workerCount];
+    if (victim == thief)
+      continue;
+
+    JobDeque& victimQueue = task ? victim->mTasks : victim->mJobs;
+    if (victimQueue.PopFront(entryOut))
+      return true;
+  }
+  return false;
+}
+
+void JobSystem::RunEntry(JobWorker* worker, JobEntry& entry)
+{
+  if (entry.mTask)
+  {
+    RunTask(entry.mTask);
+    return;
+  }
+
+  if (entry.mParallelFor)
+  {
+    RunParallelFor(entry.mParallelFor);
+    return;
+  }
+
+  if (worker == nullptr)
+  {
+    RunJob(entry.mJob);
+    return;
+  }
+
+  // Keep the job alive (and cancelable) while it runs. A worker helping in
+  // Wait may already be running a job, so restore that one afterwards.
+  worker->mCurrentJobLock.Lock();
+  HandleOf<Job> previousJob = worker->mCurrentJob;
+  worker->mCurrentJob = entry.mJob;
+  worker->mCurrentJobLock.Unlock();
+
+  RunJob(entry.mJob);
+
+  worker->mCurrentJobLock.Lock();
+  worker->mCurrentJob = previousJob;
+  worker->mCurrentJobLock.Unlock();
+}
+
 void JobSystem::RunJob(Job* job)
 {
-  bool completed = false;
+  JobWorker* worker = GetCurrentWorker();
+
   do
   {
     job->Execute();
 
-    mLock.Lock();
-    --job->mRunCount;
-    completed = (job->mRunCount == 0);
-    if (completed)
-    {
-      HandleOf<Job> jobHandle = job;
-      mActiveJobs.EraseValue(jobHandle);
-    }
-    mLock.Unlock();
-  } while (!completed);
+    if (worker)
+      ++worker->mStats.mJobsExecuted;
+  } while (--job->mRunCount != 0);
+
+  --mOutstandingJobs;
+}
+
+void JobSystem::RunTask(JobTask* task)
+{
+  task->mFunction(task);
+
+  if (JobWorker* worker = GetCurrentWorker())
+    ++worker->mStats.mJobsExecuted;
+
+  // Take the dependents under the lock so that DependsOn
+  // can never add a dependent after we've released them.
+  Array<JobTask*> dependents;
+  task->mDependentsLock.Lock();
+  dependents.Swap(task->mDependents);
+  task->mDependentsReleased = true;
+  task->mDependentsLock.Unlock();
+
+  forRange (JobTask* dependent, dependents.All())
+    Submit(dependent);
+
+  --mOutstandingJobs;
+
+  // This must be the last time we touch the task since
+  // the owner is free to destroy it once it's complete.
+  task->mComplete = true;
+}
+
+void JobSystem::RunParallelFor(ParallelForContext* context)
+{
+  context->Run();
+  context->Release();
+
+  if (JobWorker* worker = GetCurrentWorker())
+    ++worker->mStats.mJobsExecuted;
+
+  --mOutstandingJobs;
 }
 
 } // namespace Zero
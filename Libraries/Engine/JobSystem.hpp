@@ -7,6 +7,9 @@
 namespace Zero
 {
 
+class JobSystem;
+class ParallelForContext;
+
 class Job : public ReferenceCountedEventObject
 {
 public:
@@ -34,8 +37,116 @@ public:
 private:
   // This value is incremented by the job system every time we add the job.
   // If the value is greater than 1, the thread will run it multiple times.
-  // Must be locked by the JobSystem.
-  size_t mRunCount;
+  // Only the add that moves this from 0 to 1 actually queues the job.
+  Atomic<s32> mRunCount;
+};
+
+// A lightweight unit of work that can be run by the JobSystem without allocating
+// a reference counted Job. The caller owns the memory of the task and must keep
+// it alive until it has completed (typically by calling JobSystem::Wait).
+class JobTask
+{
+public:
+  typedef void (*TaskFunction)(JobTask* task);
+
+  JobTask();
+  JobTask(TaskFunction function, void* userData);
+
+  // This task will not run until the given task has completed.
+  // Must be called before this task is submitted to the JobSystem.
+  void DependsOn(JobTask* dependency);
+
+  bool IsComplete();
+
+  TaskFunction mFunction;
+  void* mUserData;
+
+private:
+  friend class JobSystem;
+
+  // Incomplete dependencies plus one until the task is submitted.
+  Atomic<s32> mBlockers;
+  Atomic<bool> mComplete;
+  // Guards mDependents and mDependentsReleased.
+  SpinLock mDependentsLock;
+  Array<JobTask*> mDependents;
+  bool mDependentsReleased;
+};
+
+// Either a reference counted Job, a caller owned JobTask or a helper running
+// the chunks of a ParallelFor (which holds a reference to its context).
+class JobEntry
+{
+public:
+  JobEntry();
+  JobEntry(const HandleOf<Job>& job);
+  JobEntry(JobTask* task);
+  JobEntry(ParallelForContext* parallelFor);
+
+  // Tasks and ParallelFor helpers are short and may be waited on, jobs aren't.
+  bool IsTask() const;
+
+  void Clear();
+
+  HandleOf<Job> mJob;
+  JobTask* mTask;
+  ParallelForContext* mParallelFor;
+};
+
+// Statistics gathered by a single worker thread of the JobSystem.
+// These are only written by the worker, so reading them is an approximate snapshot.
+class JobWorkerStats
+{
+public:
+  JobWorkerStats();
+
+  // How many times this worker executed a job (including re-runs).
+  size_t mJobsExecuted;
+  // How many of the jobs this worker ran were stolen from another worker.
+  size_t mJobsStolen;
+  // Time in seconds the worker spent waiting on or searching for work.
+  double mIdleTime;
+};
+
+// A double ended queue of jobs. The owning worker pushes and pops from the back
+// (the most recently added job, which is likely still hot in the cache) while
+// other workers steal from the front (the oldest job).
+class JobDeque
+{
+public:
+  JobDeque();
+
+  void PushBack(const JobEntry& entry);
+  bool PopBack(JobEntry& entryOut);
+  bool PopFront(JobEntry& entryOut);
+  void Clear();
+
+private:
+  SpinLock mLock;
+  Array<JobEntry> mJobs;
+  // Stolen jobs are consumed from here rather than erased from the front.
+  size_t mHead;
+};
+
+class JobWorker
+{
+public:
+  JobWorker(JobSystem* system, uint index);
+  OsInt WorkerThreadEntry();
+
+  JobSystem* mSystem;
+  uint mIndex;
+  Thread mThread;
+  JobDeque mJobs;
+  // Tasks are kept apart from jobs so that threads waiting on tasks
+  // only ever help with other tasks.
+  JobDeque mTasks;
+  JobWorkerStats mStats;
+
+  // The job currently being run by this worker (kept alive by this handle).
+  // Guarded by mCurrentJobLock so the job can be cancelled on shutdown.
+  SpinLock mCurrentJobLock;
+  HandleOf<Job> mCurrentJob;
 };
 
 class JobSystem : public EventObject
@@ -47,8 +158,9 @@ public:
 
   // Add's a job to be worked on (can be called from any thread).
   // Note that a job can be queued up again after it completes.
+  // Jobs added from a worker go onto that worker's own deque, otherwise
+  // they go onto the global injection queue.
   void AddJob(Job* job);
-  OsInt WorkerThreadEntry();
 
   // Runs until a slice of time is taken (only when ThreadingEnabled is false).
   // Returns false if there is no work to be done.
@@ -57,19 +169,80 @@ public:
 
   bool AreAllJobsCompleted();
 
+  // Queues the task once all of its dependencies have completed (can be called from any thread).
+  void Submit(JobTask* task);
+
+  // Blocks until the task has completed. While waiting, the calling thread
+  // helps by running other queued tasks (so it is safe to call from a job).
+  // Jobs are never run by a waiting thread, they are left to the workers.
+  void Wait(JobTask* task);
+
+  typedef void (*ParallelForFunction)(void* userData, uint start, uint end);
+
+  // Splits the range [begin, end) into chunks and runs them across the workers
+  // and the calling thread, returning once every index has been processed.
+  // Chunks start large and shrink as the range is consumed so that uneven work
+  // still balances out, but a chunk is never smaller than minChunkSize.
+  // The calling thread only ever runs chunks of this range.
+  void ParallelFor(uint begin, uint end, ParallelForFunction function, void* userData, uint minChunkSize = 1);
+
+  // Calls functor(start, end) for each chunk (see above).
+  template <typename FunctorType>
+  void ParallelFor(uint begin, uint end, FunctorType& functor, uint minChunkSize = 1)
+  {
+    ParallelFor(begin, end, &ParallelForThunk<FunctorType>, &functor, minChunkSize);
+  }
+
+  uint GetWorkerCount();
+  // Fills out a snapshot of each worker's statistics (indexed by worker).
+  void GetWorkerStats(Array<JobWorkerStats>& statsOut);
+
 private:
-  // Takes a job from the job queue and runs it.
-  // If no jobs are available, this will return false.
-  bool RunOneJob();
+  friend class JobWorker;
 
-  void RunJob(Job* job);
+  template <typename FunctorType>
+  static void ParallelForThunk(void* userData, uint start, uint end)
+  {
+    (*(FunctorType*)userData)(start, end);
+  }
+
+  // Blocks until a job is available and runs it.
+  // Returns false if we are shutting down.
+  bool RunOneJob(JobWorker* worker);
+
+  // Runs a queued job if there is one, without blocking.
+  bool TryRunOneJob(JobWorker* worker);
+  // Runs a queued task if there is one, without blocking.
+  bool TryRunOneTask(JobWorker* worker);
 
-  ThreadLock mLock;
-  Array<HandleOf<Job>> mPendingJobs;
-  Array<HandleOf<Job>> mActiveJobs;
-  Array<Thread*> mWorkers;
+  // Makes one pass for a task and then a job, trying the worker's own deque
+  // (if any), then the injection queue, then stealing from the other workers.
+  bool FindJob(JobWorker* worker, JobEntry& entryOut);
+  // Same as FindJob, but only looks for tasks.
+  bool FindTask(JobWorker* worker, JobEntry& entryOut);
+  bool StealJob(JobWorker* thief, bool task, JobEntry& entryOut);
+
+  // Pushes onto the current worker's deque or the injection queue.
+  void Enqueue(const JobEntry& entry);
+
+  void RunEntry(JobWorker* worker, JobEntry& entry);
+  void RunJob(Job* job);
+  void RunTask(JobTask* task);
+  void RunParallelFor(ParallelForContext* context);
+
+  // Returns the worker that belongs to this job system running on the calling thread.
+  JobWorker* GetCurrentWorker();
+
+  // Jobs and tasks added from any thread that isn't one of our workers.
+  JobDeque mInjectedJobs;
+  JobDeque mInjectedTasks;
+  Array<JobWorker*> mWorkers;
+  // Incremented for every job queued to wake a worker. Threads helping in Wait
+  // take jobs without decrementing, so a worker may wake up to find nothing.
   Semaphore mJobCounter;
-  Job* GetNextJob();
+  // Counts jobs and tasks that have been queued but have not finished running.
+  Atomic<s32> mOutstandingJobs;
+  Atomic<bool> mShuttingDown;
   friend class Job;
 };
 
@@ -4,11 +4,6 @@
 namespace Zero
 {
 
-namespace
-{
-Math::Random gRandom;
-}
-
 void GenerateSplineBasis(Vec3* normal, Vec3Param splineTangent, Mat4* mat)
 {
   Vec3 crossA = Cross(splineTangent, *normal);
@@ -114,10 +109,10 @@ int SplineParticleEmitter::EmitParticles(
   for (int p = 0; p < particlesToEmit; ++p)
   {
     // Create a new particle
-    Particle* newParticle = particleList->AllocateParticle();
+    ParticleData newParticle;
 
     // Generate a normalized time to sample the curve and clamp if specified
-    float t = gRandom.FloatVariance(mSpawnT, mSpawnTVariance);
+    float t = mRandom.FloatVariance(mSpawnT, mSpawnTVariance);
     if (mClampT)
       t = Math::Clamp(t, 0.0f, 1.0f);
 
@@ -130,7 +125,7 @@ int SplineParticleEmitter::EmitParticles(
     Vec3 startingPoint = trans->TransformPointInverse(sample.mPoint);
 
     // Random velocity
-    Vec3 velocity = mStartVelocity + gRandom.PointOnUnitSphere() * mRandomVelocity;
+    Vec3 velocity = mStartVelocity + mRandom.PointOnUnitSphere() * mRandomVelocity;
 
     // No need to generate an orthonormal basis if it won't be used
     if (mTangentVelocity.LengthSq() > 0.0f || mEmitRadius > 0.0f)
@@ -143,39 +138,39 @@ int SplineParticleEmitter::EmitParticles(
       GenerateOrthonormalBasis(tangent, &crossA, &normal);
 
       // Generate a random direction normal to the curve to offset the position
-      float randomRotation = gRandom.FloatRange(0, Math::cTwoPi);
+      float randomRotation = mRandom.FloatRange(0, Math::cTwoPi);
       Vec3 dir = GetSplineNormal(randomRotation, &normal, tangent);
-      float fill = gRandom.FloatRange(mFill, 1.0f);
+      float fill = mRandom.FloatRange(mFill, 1.0f);
       startingPoint += dir * mEmitRadius * fill;
 
       // Add tangent velocity
       velocity += tangent * mTangentVelocity.z + crossA * mTangentVelocity.y + normal * mTangentVelocity.x;
     }
 
-    newParticle->Time = 0;
-    newParticle->Size = gRandom.FloatVariance(mSize, mSizeVariance);
+    newParticle.Time = 0;
+    newParticle.Size = mRandom.FloatVariance(mSize, mSizeVariance);
 
-    newParticle->Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
+    newParticle.Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
 
-    newParticle->Position = Math::TransformPoint(transform, startingPoint);
+    newParticle.Position = Math::TransformPoint(transform, startingPoint);
 
     if (mFastMovingEmitter)
     {
-      newParticle->Position += offsetDelta * (float)p;
+      newParticle.Position += offsetDelta * (float)p;
     }
 
-    newParticle->Lifetime = gRandom.FloatVariance(mLifetime, mLifetimeVariance);
+    newParticle.Lifetime = mRandom.FloatVariance(mLifetime, mLifetimeVariance);
 
-    newParticle->Color = Vec4(1, 1, 1, 1);
+    newParticle.Color = Vec4(1, 1, 1, 1);
 
-    newParticle->WanderAngle = gRandom.FloatRange(0.0f, 2 * Math::cTwoPi);
+    newParticle.WanderAngle = mRandom.FloatRange(0.0f, 2 * Math::cTwoPi);
 
     if (mRandomSpin)
-      newParticle->Rotation = gRandom.FloatRange(0.0f, 2 * Math::cTwoPi);
+      newParticle.Rotation = mRandom.FloatRange(0.0f, 2 * Math::cTwoPi);
     else
-      newParticle->Rotation = 0;
+      newParticle.Rotation = 0;
 
-    newParticle->RotationalVelocity = gRandom.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
+    newParticle.RotationalVelocity = mRandom.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
 
     particleList->AddParticle(newParticle);
   }
@@ -285,10 +280,11 @@ void SplineParticleAnimator::Animate(ParticleList* particleList, float dt, Mat4R
   Vec3 crossA, previousNormal;
   GenerateOrthonormalBasis(startTangent, &crossA, &previousNormal);
 
-  forRange (Particle* p, particleList->All())
+  uint count = particleList->Size();
+  for (uint i = 0; i < count; ++i)
   {
     // How far (in meters) the particle has traveled
-    float distanceTraveled = p->Time * mSpeed;
+    float distanceTraveled = particleList->mTime[i] * mSpeed;
 
     // The percentage of the spline the particle has traveled
     float percentTraveled = distanceTraveled / curveLength;
@@ -327,18 +323,20 @@ void SplineParticleAnimator::Animate(ParticleList* particleList, float dt, Mat4R
     // In world / local space
     splineSample = Math::TransformPoint(transform, splineSample);
 
+    Vec3 position = particleList->GetPosition(i);
+    Vec3 velocity = particleList->GetVelocity(i);
     if (mMode == SplineAnimatorMode::Exact)
     {
       // Update the velocity so that Beam rendering still works
-      p->Velocity = (splineSample - p->Position);
-      p->Position = splineSample;
+      particleList->SetVelocity(i, splineSample - position);
+      particleList->SetPosition(i, splineSample);
     }
     else // mMode == SplineAnimatorMode::Spring
     {
-      Vec3 detX = f * p->Position + dt * p->Velocity + hhoo * splineSample;
-      Vec3 detV = p->Velocity + hoo * (splineSample - p->Position);
-      p->Position = detX * detInv;
-      p->Velocity = detV * detInv;
+      Vec3 detX = f * position + dt * velocity + hhoo * splineSample;
+      Vec3 detV = velocity + hoo * (splineSample - position);
+      particleList->SetPosition(i, detX * detInv);
+      particleList->SetVelocity(i, detV * detInv);
     }
   }
 }
@@ -364,12 +362,13 @@ void SplineParticleAnimator::SetSpeed(float speed)
   float timeToFinish = curveLength / speed;
 
   // Re-base each particles lifetime so that
-  forRange (Particle* p, data->AllParticles())
+  ParticleList& particleList = data->mParticleList;
+  for (uint i = 0; i < particleList.Size(); ++i)
   {
-    float percentAlive = p->Time / p->Lifetime;
+    float percentAlive = particleList.mTime[i] / particleList.mLifetime[i];
 
-    p->Time = percentAlive * timeToFinish;
-    p->Lifetime = timeToFinish;
+    particleList.mTime[i] = percentAlive * timeToFinish;
+    particleList.mLifetime[i] = timeToFinish;
   }
 }
 
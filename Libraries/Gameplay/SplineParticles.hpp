@@ -20,6 +20,11 @@ public:
   /// ParticleEmitter Interface.
   int EmitParticles(
       ParticleList* particleList, float dt, Mat4Ref transform, Vec3Param velocity, float timeAlive) override;
+  /// Sampling the spline rebuilds it if it was modified.
+  bool CanEmitOnJobThread() override
+  {
+    return false;
+  }
 
   /// The current spline being emitted along
   Spline* GetSpline() const;
@@ -51,6 +56,11 @@ public:
 
   /// ParticleAnimator Interface.
   void Animate(ParticleList* particleList, float dt, Mat4Ref transform) override;
+  /// Sampling the spline rebuilds it if it was modified.
+  bool CanAnimateOnJobThread() override
+  {
+    return false;
+  }
 
   /// Speed setter / getter.
   void SetSpeed(float speed);
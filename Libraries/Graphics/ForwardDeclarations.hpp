@@ -40,6 +40,7 @@ class MultiSprite;
 class Particle;
 class ParticleAnimator;
 class ParticleEmitter;
+class ParticleList;
 class ParticleSystem;
 class RemoveMaterialJob;
 class RemoveMeshJob;
@@ -168,6 +168,12 @@ String Graphical::GetDefaultMaterialName()
   return MaterialManager::GetInstance()->DefaultResourceName;
 }
 
+bool Graphical::CanExtractOnJobThread()
+{
+  // Most graphicals add to the shared render queues while extracting
+  return false;
+}
+
 bool Graphical::GetVisible()
 {
   return mVisible;
@@ -65,6 +65,9 @@ public:
   virtual bool TestFrustum(const Frustum& frustum, CastInfo& castInfo);
   virtual void AddToSpace();
   virtual String GetDefaultMaterialName();
+  // If ExtractFrameData and ExtractViewData only write to the given nodes (and
+  // only read this graphical) so that they can be called on a job thread.
+  virtual bool CanExtractOnJobThread();
 
   // Properties
 
@@ -41,6 +41,20 @@ void GraphicalEntry::SetRenderGroupSortValue(s32 sortValue)
   mSort |= (u64)sortValue << 32;
 }
 
+// Radix sort key for GraphicalEntries
+struct GraphicalEntrySortKey
+{
+  u64 operator()(const GraphicalEntry& entry) const
+  {
+    return entry.mSort;
+  }
+};
+
+void SortGraphicalEntries(GraphicalEntryRange entries, Array<GraphicalEntry>& scratch)
+{
+  RadixSort(entries, scratch, GraphicalEntrySortKey());
+}
+
 ZilchDefineType(GraphicalSortEvent, builder, type)
 {
   ZilchBindGetterProperty(GraphicalEntries);
@@ -59,6 +59,10 @@ public:
 
 typedef Array<GraphicalEntry>::range GraphicalEntryRange;
 
+// Sorts entries by their sort values (same order as operator<) with a stable
+// radix sort. Keep the scratch array around to avoid allocating every sort.
+void SortGraphicalEntries(GraphicalEntryRange entries, Array<GraphicalEntry>& scratch);
+
 /// Sent for RenderGroups that require custom logic for sort values.
 class GraphicalSortEvent : public Event
 {
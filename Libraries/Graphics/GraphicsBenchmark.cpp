@@ -0,0 +1,154 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+namespace
+{
+// Roughly how many render groups a project uses
+const int cRenderGroupCount = 8;
+const uint cSortSeed = 1337;
+// The first frames compile shaders and upload resources
+const uint cWarmUpFrames = 10;
+
+DeclareEnum2(GraphicalEntrySortMode, Comparison, Radix);
+
+void CreateBenchmarkEntries(uint entryCount, Array<GraphicalEntry>& entriesOut)
+{
+  Math::Random random(cSortSeed);
+
+  entriesOut.Resize(entryCount);
+  forRange (GraphicalEntry& entry, entriesOut.All())
+  {
+    entry.mData = nullptr;
+    entry.mSort = 0;
+    entry.mRenderGroupId = random.IntRangeInEx(0, cRenderGroupCount);
+    entry.SetRenderGroupSortValue(entry.mRenderGroupId);
+    // Depth sort values are spread over the whole range
+    entry.SetGraphicalSortValue((s32)random.Uint32());
+  }
+}
+
+double TimeGraphicalEntrySort(GraphicalEntrySortMode::Enum mode, uint entryCount, uint iterations, bool& sorted)
+{
+  Array<GraphicalEntry> source;
+  CreateBenchmarkEntries(entryCount, source);
+
+  Array<GraphicalEntry> entries;
+  Array<GraphicalEntry> scratch;
+
+  sorted = true;
+  BenchmarkTimer timer;
+  for (uint i = 0; i < iterations; ++i)
+  {
+    entries.Assign(source.All());
+
+    timer.Start();
+    if (mode == GraphicalEntrySortMode::Radix)
+      SortGraphicalEntries(entries.All(), scratch);
+    else
+      Sort(entries.All());
+    timer.Stop();
+
+    sorted = sorted && IsSorted(entries.All());
+  }
+
+  return timer.GetMsPerRun(iterations);
+}
+
+void AddFrameTimes(GraphicsFrameTimes& totals, GraphicsFrameTimes& times)
+{
+  totals.mFrameUpdate += times.mFrameUpdate;
+  totals.mRenderTasksUpdate += times.mRenderTasksUpdate;
+  totals.mRenderQueuesUpdate += times.mRenderQueuesUpdate;
+  totals.mUiRenderUpdate += times.mUiRenderUpdate;
+  totals.mWaitOnRenderer += times.mWaitOnRenderer;
+}
+} // namespace
+
+void RunGraphicalEntrySortBenchmark(uint entryCount, uint iterations)
+{
+  for (uint mode = 0; mode < GraphicalEntrySortMode::Size; ++mode)
+  {
+    bool sorted = false;
+    double msPerSort = TimeGraphicalEntrySort((GraphicalEntrySortMode::Enum)mode, entryCount, iterations, sorted);
+    PrintBenchmarkResult("GraphicalEntrySortBenchmark",
+                         "%s sort, %u entries, %.3f ms per sort%s",
+                         GraphicalEntrySortMode::Names[mode],
+                         entryCount,
+                         msPerSort,
+                         sorted ? "" : " (NOT SORTED)");
+  }
+}
+
+void RunGraphicsFrameBenchmark(Level* level, uint frameCount)
+{
+  ReturnIf(level == nullptr, , "No level to benchmark");
+  GraphicsEngine* graphics = Z::gEngine->has(GraphicsEngine);
+
+  Space* space = Z::gFactory->CreateSpace(CoreArchetypes::DefaultSpace, CreationFlags::Default, nullptr);
+  space->LoadLevel(level);
+
+  for (uint i = 0; i < cWarmUpFrames; ++i)
+    Z::gEngine->Update();
+
+  EmptyRenderer* emptyRenderer = graphics->mEmptyRenderer ? (EmptyRenderer*)Z::gRenderer : nullptr;
+  if (emptyRenderer != nullptr)
+    emptyRenderer->ResetStats();
+
+  GraphicsFrameTimes totals;
+  BenchmarkTimer timer;
+  timer.Start();
+  for (uint i = 0; i < frameCount; ++i)
+  {
+    Z::gEngine->Update();
+    AddFrameTimes(totals, graphics->mFrameTimes);
+  }
+  timer.Stop();
+
+  // Converts a total in seconds over every frame into milliseconds per frame
+  double msPerFrameScale = 1000.0 / double(Math::Max(frameCount, 1u));
+  PrintBenchmarkResult("GraphicsFrameBenchmark",
+                       "'%s', %u frames, %.3f ms per frame",
+                       level->Name.c_str(),
+                       frameCount,
+                       timer.GetMsPerRun(frameCount));
+  ZPrint("  FrameUpdate %.3f ms, RenderTasksUpdate %.3f ms, RenderQueuesUpdate %.3f ms\n",
+         totals.mFrameUpdate * msPerFrameScale,
+         totals.mRenderTasksUpdate * msPerFrameScale,
+         totals.mRenderQueuesUpdate * msPerFrameScale);
+  ZPrint("  UiRenderUpdate %.3f ms, WaitOnRenderer %.3f ms\n",
+         totals.mUiRenderUpdate * msPerFrameScale,
+         totals.mWaitOnRenderer * msPerFrameScale);
+
+  if (emptyRenderer != nullptr)
+  {
+    // Wait for the renderer to finish the last frame before reading its stats.
+    // The wait consumes the job's signal, so signal it again for the next
+    // frame's wait.
+    graphics->mDoRenderTasksJob->WaitOnThisJob();
+    graphics->mDoRenderTasksJob->mWaitEvent.Signal();
+    EmptyRendererStats stats = emptyRenderer->GetStats();
+    double perFrame = 1.0 / double(Math::Max(stats.mFrames, 1u));
+    ZPrint("  Per rendered frame: %.1f draw calls, %.1f state changes, %.1f material changes, %.1f render tasks\n",
+           stats.mDrawCalls * perFrame,
+           stats.mStateChanges * perFrame,
+           stats.mMaterialChanges * perFrame,
+           stats.mRenderTasks * perFrame);
+    ZPrint("  %llu bytes uploaded, %u invalid commands\n",
+           (unsigned long long)stats.mBytesUploaded,
+           stats.mInvalidCommands);
+  }
+
+  space->Destroy();
+}
+
+void RunGraphicsBenchmarks()
+{
+  RunGraphicalEntrySortBenchmark(1000);
+  RunGraphicalEntrySortBenchmark(10000);
+  RunGraphicalEntrySortBenchmark(50000);
+}
+
+} // namespace Zero
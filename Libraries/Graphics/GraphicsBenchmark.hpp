@@ -0,0 +1,22 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+/// Fills a camera's worth of graphical entries with random render group and
+/// depth sort values, then prints the average time the comparison sort and the
+/// radix sort take to sort them.
+void RunGraphicalEntrySortBenchmark(uint entryCount, uint iterations = 20);
+
+/// Loads the level into a new space and updates the engine for the given number
+/// of frames, printing the average frame time, the main thread time of each
+/// graphics stage and the renderer's command statistics when running on the
+/// EmptyRenderer. This runs its own frames so it must be called from outside of
+/// an engine update (see the GraphicsBenchmark executable).
+void RunGraphicsFrameBenchmark(Level* level, uint frameCount = 300);
+
+/// Runs the graphical entry sort benchmark at 1k, 10k and 50k entries.
+void RunGraphicsBenchmarks();
+
+} // namespace Zero
@@ -33,13 +33,29 @@ System* CreateGraphicsSystem()
 
 Memory::Pool* gShaderPool = nullptr;
 
+// Translated shaders are cached next to the content build cache
+static String GetShaderCachePath()
+{
+  return FilePath::Combine(GetUserLocalDirectory(), "ZeroShaderCache");
+}
+
 ZilchDefineType(GraphicsEngine, builder, type)
 {
 }
 
+GraphicsFrameTimes::GraphicsFrameTimes() :
+    mFrameUpdate(0.0),
+    mRenderTasksUpdate(0.0),
+    mRenderQueuesUpdate(0.0),
+    mUiRenderUpdate(0.0),
+    mWaitOnRenderer(0.0)
+{
+}
+
 GraphicsEngine::GraphicsEngine() : mNewLibrariesCommitted(false), mRenderGroupCount(0), mUpdateRenderGroupCount(false)
 {
   mEngineShutdown = false;
+  mEmptyRenderer = false;
 }
 
 GraphicsEngine::~GraphicsEngine()
@@ -79,6 +95,16 @@ void GraphicsEngine::Initialize(SystemInitializer& initializer)
   // Need to get translator or mode from Renderer
   mShaderGenerator = CreateZilchShaderGenerator();
 
+  // Translated shaders are cached across runs along with the built content
+  Cog* configCog = Z::gEngine->GetConfigCog();
+  ContentConfig* contentConfig = configCog ? configCog->has(ContentConfig) : nullptr;
+  if (contentConfig != nullptr && contentConfig->BuildCacheEnabled)
+  {
+    mShaderGenerator->mCachePath = GetShaderCachePath();
+    // Entries for changed fragments are never looked up again
+    FileCache::Trim(mShaderGenerator->mCachePath, u64(contentConfig->BuildCacheMaxSizeMb) * 1024 * 1024);
+  }
+
   ConnectThisTo(Z::gEngine, Events::EngineShutdown, OnEngineShutdown);
 
   ConnectThisTo(Z::gEngine, Events::LoadingStart, StartProgress);
@@ -117,7 +143,6 @@ void GraphicsEngine::Initialize(SystemInitializer& initializer)
   ConnectThisTo(ZilchManager::GetInstance(), Events::ScriptsCompiledPostPatch, OnScriptsCompiledPostPatch);
   ConnectThisTo(ZilchManager::GetInstance(), Events::ScriptCompilationFailed, OnScriptCompilationFailed);
 
-  ParticleList::Memory = new Memory::Pool("Particles", Memory::GetRoot(), sizeof(Particle), 1024);
   gShaderPool = new Memory::Pool("Shaders", Memory::GetRoot(), sizeof(Shader), 1024);
 
   mFrameCounter = 0;
@@ -292,18 +317,24 @@ void GraphicsEngine::Update(bool debugger)
   // done within this update function
   UpdateRenderGroups();
 
+  Timer stageTimer;
+
   {
     ProfileScopeTree("FrameUpdate", "Graphics", Color::SpringGreen);
     float frameDt = Z::gEngine->has(TimeSystem)->mEngineDt;
     forRange (GraphicsSpace& space, mSpaces.All())
       space.OnFrameUpdate(frameDt);
   }
+  stageTimer.Update();
+  mFrameTimes.mFrameUpdate = stageTimer.TimeDelta();
 
   {
     ProfileScopeTree("RenderTasksUpdate", "Graphics", Color::LimeGreen);
     forRange (GraphicsSpace& space, mSpaces.All())
       space.RenderTasksUpdate(*mRenderTasksBack);
   }
+  stageTimer.Update();
+  mFrameTimes.mRenderTasksUpdate = stageTimer.TimeDelta();
 
   {
     ProfileScopeTree("RenderQueuesUpdate", "Graphics", Color::LawnGreen);
@@ -312,6 +343,8 @@ void GraphicsEngine::Update(bool debugger)
 
     Sort(mRenderTasksBack->mRenderTaskRanges.All());
   }
+  stageTimer.Update();
+  mFrameTimes.mRenderQueuesUpdate = stageTimer.TimeDelta();
 
   {
     ProfileScopeTree("UiRenderUpdate", "Graphics", Color::DarkOliveGreen);
@@ -320,12 +353,16 @@ void GraphicsEngine::Update(bool debugger)
     Event event;
     DispatchEvent("UiRenderUpdate", &event);
   }
+  stageTimer.Update();
+  mFrameTimes.mUiRenderUpdate = stageTimer.TimeDelta();
 
   {
     ProfileScopeTree("WaitOnRenderer", "Graphics", Color::Bisque);
     // cannot run another RenderTasks job unless the last one is done
     mDoRenderTasksJob->WaitOnThisJob();
   }
+  stageTimer.Update();
+  mFrameTimes.mWaitOnRenderer = stageTimer.TimeDelta();
 
   Swap(mRenderTasksBack, mRenderTasksFront);
   Swap(mRenderQueuesBack, mRenderQueuesFront);
@@ -666,10 +703,13 @@ void GraphicsEngine::AddRendererJob(RendererJob* rendererJob)
 
 void GraphicsEngine::CreateRenderer(OsWindow* mainWindow)
 {
-  OsHandle mainWindowHandle = mainWindow->GetWindowHandle();
+  // The empty renderer lets the rendering pipeline run without a gpu (and
+  // without a window to present to)
+  mEmptyRenderer = mainWindow == nullptr || Environment::GetValue<bool>("nullrenderer", false);
 
   CreateRendererJob* rendererJob = new CreateRendererJob();
-  rendererJob->mMainWindowHandle = mainWindowHandle;
+  rendererJob->mMainWindowHandle = mainWindow ? mainWindow->GetWindowHandle() : nullptr;
+  rendererJob->mEmptyRenderer = mEmptyRenderer;
   AddRendererJob(rendererJob);
   rendererJob->WaitOnThisJob();
 
@@ -680,6 +720,9 @@ void GraphicsEngine::CreateRenderer(OsWindow* mainWindow)
 
   gIntelGraphics = Z::gRenderer->mDriverSupport.mIntel;
 
+  if (mainWindow == nullptr)
+    return;
+
   ConnectThisTo(mainWindow, Events::OsWindowMinimized, OnOsWindowMinimized);
   ConnectThisTo(mainWindow, Events::OsWindowRestored, OnOsWindowRestored);
 }
@@ -1246,6 +1289,12 @@ void GraphicsEngine::ClearRenderTargets()
   mRenderTargetManager.ClearRenderTargets();
 }
 
+void GraphicsEngine::ClearShaderCache()
+{
+  // Cleared even when the cache is disabled so that old entries can be removed
+  FileCache::Clear(GetShaderCachePath());
+}
+
 void GraphicsEngine::ForceCompileAllShaders()
 {
   BlockingTaskEvent event("Compiling");
@@ -50,6 +50,20 @@ public:
   String mFilename;
 };
 
+/// Main thread time (in seconds) spent in each stage of a graphics update.
+class GraphicsFrameTimes
+{
+public:
+  GraphicsFrameTimes();
+
+  double mFrameUpdate;
+  double mRenderTasksUpdate;
+  double mRenderQueuesUpdate;
+  double mUiRenderUpdate;
+  // Time spent waiting for the renderer to finish the previous frame.
+  double mWaitOnRenderer;
+};
+
 /// System object for graphics.
 class GraphicsEngine : public System
 {
@@ -142,6 +156,9 @@ public:
 
   void ForceCompileAllShaders();
 
+  // Removes every translated shader from the shader cache.
+  void ClearShaderCache();
+
   void ProcessModifiedScripts(LibraryRef library);
 
   ZilchFragmentType::Enum GetFragmentType(MaterialBlock* materialBlock);
@@ -194,6 +211,11 @@ public:
 
   bool mEngineShutdown;
 
+  // If the EmptyRenderer was created instead of the platform's renderer.
+  bool mEmptyRenderer;
+  // Stage times of the last update.
+  GraphicsFrameTimes mFrameTimes;
+
   RenderTargetManager mRenderTargetManager;
 
   ZilchShaderGenerator* mShaderGenerator;
@@ -48,6 +48,8 @@ void GraphicsSpace::Initialize(CogInitializer& initializer)
 
   ConnectThisTo(this, Events::SpaceDestroyed, OnSpaceDestroyed);
   ConnectThisTo(this, Events::SystemLogicUpdate, OnLogicUpdate);
+  ConnectThisTo(this, Events::LogicUpdate, OnParticleLogicUpdate);
+  ConnectThisTo(this, Events::FrameUpdate, OnParticleFrameUpdate);
   // ConnectThisTo(GetOwner(), Events::GraphicsFrameUpdate, OnFrameUpdate);
 }
 
@@ -91,11 +93,132 @@ void GraphicsSpace::RemoveCamera(Camera* camera)
   UnregisterVisibility(camera);
 }
 
+void GraphicsSpace::AddParticleSystem(ParticleSystem* particleSystem)
+{
+  mParticleSystems.PushBack(particleSystem);
+}
+
+void GraphicsSpace::RemoveParticleSystem(ParticleSystem* particleSystem)
+{
+  ParticleSystem::UpdateList::Unlink(particleSystem);
+}
+
 void GraphicsSpace::OnLogicUpdate(UpdateEvent* event)
 {
   mLogicTime += event->Dt;
 }
 
+void GraphicsSpace::OnParticleLogicUpdate(UpdateEvent* event)
+{
+  UpdateParticleSystems(event->Dt, false);
+}
+
+void GraphicsSpace::OnParticleFrameUpdate(UpdateEvent* event)
+{
+  UpdateParticleSystems(event->Dt, true);
+}
+
+// Updates a range of the particle systems on a job thread
+struct ParticleSystemUpdater
+{
+  ParticleSystemUpdater(Array<ParticleSystem*>& particleSystems, float dt) : mParticleSystems(particleSystems), mDt(dt)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    for (uint i = start; i < end; ++i)
+      mParticleSystems[i]->UpdateParticles(mDt);
+  }
+
+  Array<ParticleSystem*>& mParticleSystems;
+  float mDt;
+};
+
+void GraphicsSpace::UpdateParticleSystems(float dt, bool frameUpdate)
+{
+  ProfileScopeFunction();
+
+  // Gather the systems first, the main thread updates send events that could
+  // add or remove particle systems
+  mMainThreadParticleSystems.Clear();
+  mJobParticleSystems.Clear();
+  forRange (ParticleSystem& particleSystem, mParticleSystems.All())
+  {
+    // Child systems are updated by their parent
+    if (particleSystem.mChildSystem || particleSystem.mFrameUpdate != frameUpdate)
+      continue;
+
+    if (Z::gJobs != nullptr && particleSystem.CanUpdateOnJobThread())
+      mJobParticleSystems.PushBack(&particleSystem);
+    else
+      mMainThreadParticleSystems.PushBack(&particleSystem);
+  }
+
+  forRange (ParticleSystem* particleSystem, mMainThreadParticleSystems.All())
+    particleSystem->SystemUpdate(dt);
+
+  if (mJobParticleSystems.Empty())
+    return;
+
+  forRange (ParticleSystem* particleSystem, mJobParticleSystems.All())
+    particleSystem->PrepareUpdate();
+
+  // Each system (and its children) is independent of every other system
+  ParticleSystemUpdater updater(mJobParticleSystems, dt);
+  Z::gJobs->ParallelFor(0, mJobParticleSystems.Size(), updater);
+
+  forRange (ParticleSystem* particleSystem, mJobParticleSystems.All())
+    particleSystem->SendQueuedEvents();
+}
+
+// Queries the broadphase with the frustum of a range of cameras on a job thread
+struct CameraFrustumQuery
+{
+  typedef GraphicsBroadPhase::BaseTreeRange<Frustum, GraphicsBroadPhase::NodeArray> FrustumRange;
+
+  CameraFrustumQuery(GraphicsBroadPhase& broadPhase, Array<CameraCullData>& cullData) :
+      mBroadPhase(broadPhase),
+      mCullData(cullData)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    for (uint i = start; i < end; ++i)
+    {
+      CameraCullData& cullData = mCullData[i];
+      cullData.mGraphicalsInFrustum.Clear();
+
+      FrustumRange range = mBroadPhase.Query(cullData.mFrustum, cullData.mQueryNodes);
+      for (; !range.Empty(); range.PopFront())
+        cullData.mGraphicalsInFrustum.PushBack(range.Front());
+    }
+  }
+
+  GraphicsBroadPhase& mBroadPhase;
+  Array<CameraCullData>& mCullData;
+};
+
+// Sorts the entries of a range of cameras on a job thread
+struct CameraEntrySorter
+{
+  CameraEntrySorter(Array<CameraCullData>& cullData) : mCullData(cullData)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    for (uint i = start; i < end; ++i)
+    {
+      CameraCullData& cullData = mCullData[i];
+      SortGraphicalEntries(cullData.mEntries.All(), cullData.mSortScratch);
+    }
+  }
+
+  Array<CameraCullData>& mCullData;
+};
+
 // currently considering keeping this as a part of graphics update and not frame
 // update
 void GraphicsSpace::OnFrameUpdate(float frameDt)
@@ -129,12 +252,12 @@ void GraphicsSpace::OnFrameUpdate(float frameDt)
   CreateDebugGraphicals();
 
   mVisibleGraphicals.Clear();
-  uint lastIndex = 0;
 
   uint renderGroupCount = mGraphicsEngine->GetRenderGroupCount();
   ErrorIf(renderGroupCount == 0, "No render groups, core resources must be missing.");
 
-  // for each view object in use
+  // Setup the culling data for each view object in use
+  uint cameraCount = 0;
   forRange (Camera& camera, mCameras.All())
   {
     // Ranges must be cleared from the last this camera was used
@@ -147,19 +270,43 @@ void GraphicsSpace::OnFrameUpdate(float frameDt)
     for (uint i = 0; i < camera.mRenderGroupCounts.Size(); ++i)
       camera.mRenderGroupCounts[i] = 0;
 
-    Vec3 cameraPos = camera.mTransform->GetWorldTranslation();
+    if (cameraCount == mCameraCullData.Size())
+      mCameraCullData.PushBack();
+
+    CameraCullData& cullData = mCameraCullData[cameraCount++];
+    cullData.mCamera = &camera;
+    cullData.mCameraPos = camera.mTransform->GetWorldTranslation();
     Mat3 rotation = Math::ToMatrix3(camera.mTransform->GetWorldRotation());
-    Vec3 cameraDir = -rotation.BasisZ();
+    cullData.mCameraDir = -rotation.BasisZ();
+    cullData.mFrustum = camera.GetFrustum(camera.mViewportInterface->GetAspectRatio());
+    cullData.mEntries.Clear();
+  }
 
-    Frustum frustum = camera.GetFrustum(camera.mViewportInterface->GetAspectRatio());
+  // Visibility culling only reads the broadphase, so every camera is culled
+  // at the same time
+  CameraFrustumQuery frustumQuery(mBroadPhase, mCameraCullData);
+  if (Z::gJobs != nullptr)
+    Z::gJobs->ParallelFor(0, cameraCount, frustumQuery);
+  else
+    frustumQuery(0, cameraCount);
+
+  // Midphase queries write to the graphicals, so entries are made on the main
+  // thread (into each camera's own entries)
+  for (uint i = 0; i < cameraCount; ++i)
+  {
+    CameraCullData& cullData = mCameraCullData[i];
+    Camera& camera = *cullData.mCamera;
+    Vec3 cameraPos = cullData.mCameraPos;
+    Vec3 cameraDir = cullData.mCameraDir;
+    Array<GraphicalEntry>& entries = cullData.mEntries;
 
     // Visibility culled graphicals
-    forRangeBroadphaseTree(GraphicsBroadPhase, mBroadPhase, Frustum, frustum)
-        AddToVisibleGraphicals(*range.Front(), camera, cameraPos, cameraDir, &frustum);
+    forRange (Graphical* graphical, cullData.mGraphicalsInFrustum.All())
+      AddToVisibleGraphicals(*graphical, camera, cameraPos, cameraDir, entries, &cullData.mFrustum);
 
     // Not culled
     forRange (Graphical& graphical, mGraphicalsNeverCulled.All())
-      AddToVisibleGraphicals(graphical, camera, cameraPos, cameraDir);
+      AddToVisibleGraphicals(graphical, camera, cameraPos, cameraDir, entries);
 
     // Get DebugGraphical entries, not broadphased
     // DebugGraphicals exist for one frame and are not placed in broadphase
@@ -169,42 +316,55 @@ void GraphicsSpace::OnFrameUpdate(float frameDt)
       if (debugGraphical->mDebugObjects.Size() == 0)
         continue;
 
-      AddToVisibleGraphicals(graphical, camera, cameraPos, cameraDir);
+      AddToVisibleGraphicals(graphical, camera, cameraPos, cameraDir, entries);
     }
+  }
 
-    uint index = mVisibleGraphicals.Size();
-    IndexRange indexRange(lastIndex, index);
-    lastIndex = index;
-
-    uint start = indexRange.start;
-    uint size = indexRange.end - indexRange.start;
-
-    camera.mGraphicalIndexRanges.PushBack(indexRange);
-
-    // Sort entries of this camera
-    // This sort will have all entries correctly organized by RenderGroup
-    // If a custom sort is enabled, it can then be re-sorted within that
-    // RenderGroup
-    Sort(mVisibleGraphicals.SubRange(start, size));
+  // Sort entries of each camera
+  // This sort will have all entries correctly organized by RenderGroup
+  // If a custom sort is enabled, it can then be re-sorted within that
+  // RenderGroup
+  CameraEntrySorter entrySorter(mCameraCullData);
+  if (Z::gJobs != nullptr)
+    Z::gJobs->ParallelFor(0, cameraCount, entrySorter);
+  else
+    entrySorter(0, cameraCount);
+
+  uint totalEntryCount = 0;
+  for (uint i = 0; i < cameraCount; ++i)
+    totalEntryCount += mCameraCullData[i].mEntries.Size();
+  mVisibleGraphicals.Reserve(totalEntryCount);
+
+  // Gather the entries in camera order so that the results do not depend on
+  // which thread culled which camera
+  for (uint i = 0; i < cameraCount; ++i)
+  {
+    CameraCullData& cullData = mCameraCullData[i];
+    Camera& camera = *cullData.mCamera;
+    Array<GraphicalEntry>& entries = cullData.mEntries;
 
     // Check for any RenderGroup with a custom sort and find its range of
     // elements
-    for (uint i = 0, rangeStart = 0; i < camera.mRenderGroupCounts.Size(); ++i)
+    for (uint j = 0, rangeStart = 0; j < camera.mRenderGroupCounts.Size(); ++j)
     {
-      uint rangeEnd = rangeStart + camera.mRenderGroupCounts[i];
+      uint rangeEnd = rangeStart + camera.mRenderGroupCounts[j];
 
-      RenderGroup* renderGroup = (RenderGroup*)mGraphicsEngine->mRenderGroups[i];
+      RenderGroup* renderGroup = (RenderGroup*)mGraphicsEngine->mRenderGroups[j];
       if (renderGroup->mGraphicalSortMethod == GraphicalSortMethod::SortEvent)
       {
         GraphicalSortEvent sortEvent;
-        sortEvent.mGraphicalEntries = mVisibleGraphicals.SubRange(rangeStart, rangeEnd - rangeStart);
+        sortEvent.mGraphicalEntries = entries.SubRange(rangeStart, rangeEnd - rangeStart);
         sortEvent.mRenderGroup = renderGroup;
         camera.mViewportInterface->SendSortEvent(&sortEvent);
-        Sort(mVisibleGraphicals.SubRange(rangeStart, rangeEnd - rangeStart));
+        SortGraphicalEntries(entries.SubRange(rangeStart, rangeEnd - rangeStart), cullData.mSortScratch);
       }
 
       rangeStart = rangeEnd;
     }
+
+    uint start = mVisibleGraphicals.Size();
+    mVisibleGraphicals.Append(entries.All());
+    camera.mGraphicalIndexRanges.PushBack(IndexRange(start, mVisibleGraphicals.Size()));
   }
 }
 
@@ -216,6 +376,55 @@ void GraphicsSpace::RenderTasksUpdate(RenderTasks& renderTasks)
   DispatchEvent(Events::RenderTasksUpdateInternal, &event);
 }
 
+// Nodes extracted per chunk on job threads, extracting a single node is too
+// little work to be worth scheduling on its own
+static const uint cMinExtractChunkSize = 64;
+
+// Extracts the frame data of a range of frame nodes on a job thread (nodes of
+// graphicals that must be extracted on the main thread are skipped)
+struct FrameDataExtractor
+{
+  FrameDataExtractor(FrameBlock& frameBlock) : mFrameBlock(frameBlock)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    for (uint i = start; i < end; ++i)
+    {
+      FrameNode& node = mFrameBlock.mFrameNodes[i];
+      Graphical* graphical = ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical;
+      if (graphical->CanExtractOnJobThread())
+        graphical->ExtractFrameData(node, mFrameBlock);
+    }
+  }
+
+  FrameBlock& mFrameBlock;
+};
+
+// Extracts the view data of a range of view nodes on a job thread (nodes of
+// graphicals that must be extracted on the main thread are skipped)
+struct ViewDataExtractor
+{
+  ViewDataExtractor(ViewBlock& viewBlock, FrameBlock& frameBlock) : mViewBlock(viewBlock), mFrameBlock(frameBlock)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    for (uint i = start; i < end; ++i)
+    {
+      ViewNode& node = mViewBlock.mViewNodes[i];
+      Graphical* graphical = ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical;
+      if (graphical->CanExtractOnJobThread())
+        graphical->ExtractViewData(node, mViewBlock, mFrameBlock);
+    }
+  }
+
+  ViewBlock& mViewBlock;
+  FrameBlock& mFrameBlock;
+};
+
 void GraphicsSpace::RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& renderQueues)
 {
   if (mRenderTaskRangeIndices.Size() == 0)
@@ -237,6 +446,8 @@ void GraphicsSpace::RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& r
 
   uint viewBlockStartIndex = renderQueues.mViewBlocks.Size();
 
+  bool extractOnJobs = Z::gJobs != nullptr;
+
   // for each view object
   forRange (Camera& camera, mCameras.All())
   {
@@ -350,6 +561,11 @@ void GraphicsSpace::RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& r
             renderTasks.mShaderInputs.Append(shaderInputs->mShaderInputs.Values());
 
           frameNode.mShaderInputRange.end = renderTasks.mShaderInputs.Size();
+
+          // The world matrix is cached the first time it's requested, which
+          // can't happen on a job thread
+          if (extractOnJobs && graphical->CanExtractOnJobThread())
+            graphical->mTransform->GetWorldMatrix();
         }
 
         // assign references to frame nodes in view nodes
@@ -359,19 +575,41 @@ void GraphicsSpace::RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& r
   }
 
   // extract frame node data
+  // Graphicals that add to the shared render queues are extracted on the main
+  // thread, the rest only write to their own nodes and are extracted on job
+  // threads afterwards (the nodes are already allocated so the results do not
+  // depend on which thread extracted which node)
   forRange (FrameNode& node, frameNodes.All())
   {
-    ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical->ExtractFrameData(node, frameBlock);
+    Graphical* graphical = ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical;
+    if (!extractOnJobs || !graphical->CanExtractOnJobThread())
+      graphical->ExtractFrameData(node, frameBlock);
+  }
+
+  if (extractOnJobs)
+  {
+    FrameDataExtractor frameExtractor(frameBlock);
+    Z::gJobs->ParallelFor(0, frameNodes.Size(), frameExtractor, cMinExtractChunkSize);
   }
 
   // only process view blocks from this graphics space
+  // View data depends on frame data, so every frame node must be extracted
+  // before any view node
   for (uint i = viewBlockStartIndex; i < renderQueues.mViewBlocks.Size(); ++i)
   {
     // extract view node data
     ViewBlock& viewBlock = renderQueues.mViewBlocks[i];
     forRange (ViewNode& node, viewBlock.mViewNodes.All())
     {
-      ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical->ExtractViewData(node, viewBlock, frameBlock);
+      Graphical* graphical = ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical;
+      if (!extractOnJobs || !graphical->CanExtractOnJobThread())
+        graphical->ExtractViewData(node, viewBlock, frameBlock);
+    }
+
+    if (extractOnJobs)
+    {
+      ViewDataExtractor viewExtractor(viewBlock, frameBlock);
+      Z::gJobs->ParallelFor(0, viewBlock.mViewNodes.Size(), viewExtractor, cMinExtractChunkSize);
     }
   }
 
@@ -385,8 +623,12 @@ void GraphicsSpace::RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& r
   SendVisibilityEvents();
 }
 
-void GraphicsSpace::AddToVisibleGraphicals(
-    Graphical& graphical, Camera& camera, Vec3 cameraPos, Vec3 cameraDir, Frustum* frustum)
+void GraphicsSpace::AddToVisibleGraphicals(Graphical& graphical,
+                                           Camera& camera,
+                                           Vec3 cameraPos,
+                                           Vec3 cameraDir,
+                                           Array<GraphicalEntry>& visibleEntries,
+                                           Frustum* frustum)
 {
   if (GetOwner()->IsEditorMode() && graphical.GetOwner()->GetEditorViewportHidden())
     return;
@@ -396,7 +638,8 @@ void GraphicsSpace::AddToVisibleGraphicals(
 
   graphical.mVisibleFlags.SetFlag(camera.mVisibilityId);
 
-  Array<GraphicalEntry> entries;
+  Array<GraphicalEntry>& entries = mMidPhaseEntries;
+  entries.Clear();
   graphical.MidPhaseQuery(entries, camera, frustum);
   forRange (GraphicalEntry& entry, entries.All())
   {
@@ -427,7 +670,7 @@ void GraphicsSpace::AddToVisibleGraphicals(
 
         // Materials will not refer to RenderGroups that have not been given an
         // id.
-        mVisibleGraphicals.PushBack(entry);
+        visibleEntries.PushBack(entry);
         // Add to RenderGroup counters so they can be accessed by index later.
         ++camera.mRenderGroupCounts[renderGroup->mSortId];
 
@@ -27,6 +27,25 @@ class RaycastResultList;
 
 typedef AvlDynamicAabbTree<Graphical*> GraphicsBroadPhase;
 
+// Culling data for one camera. Each camera's broadphase query and sort only
+// touch its own data so that cameras can be culled on separate job threads.
+struct CameraCullData
+{
+  Camera* mCamera;
+  Frustum mFrustum;
+  Vec3 mCameraPos;
+  Vec3 mCameraDir;
+
+  // Scratch space for querying the broadphase
+  GraphicsBroadPhase::NodeArray mQueryNodes;
+  // Graphicals from the broadphase overlapping the frustum
+  Array<Graphical*> mGraphicalsInFrustum;
+  // Entries for this camera, copied to mVisibleGraphicals once sorted
+  Array<GraphicalEntry> mEntries;
+  // Scratch space for sorting the entries
+  Array<GraphicalEntry> mSortScratch;
+};
+
 /// Core space component that manages all interactions between graphics related
 /// objects.
 class GraphicsSpace : public Component
@@ -47,15 +66,29 @@ public:
   void AddCamera(Camera* camera);
   void RemoveCamera(Camera* camera);
 
+  void AddParticleSystem(ParticleSystem* particleSystem);
+  void RemoveParticleSystem(ParticleSystem* particleSystem);
+
   void OnLogicUpdate(UpdateEvent* event);
+  void OnParticleLogicUpdate(UpdateEvent* event);
+  void OnParticleFrameUpdate(UpdateEvent* event);
+
+  // Updates every particle system that updates on frame update or logic
+  // update. Systems are updated concurrently on the job system when they can
+  // be, each system updating its own child systems.
+  void UpdateParticleSystems(float dt, bool frameUpdate);
   // void OnFrameUpdate(UpdateEvent* updateEvent);
   void OnFrameUpdate(float frameDt);
 
   void RenderTasksUpdate(RenderTasks& renderTasks);
   void RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& renderQueues);
 
-  void AddToVisibleGraphicals(
-      Graphical& graphical, Camera& camera, Vec3 cameraPos, Vec3 cameraDir, Frustum* frustum = nullptr);
+  void AddToVisibleGraphicals(Graphical& graphical,
+                              Camera& camera,
+                              Vec3 cameraPos,
+                              Vec3 cameraDir,
+                              Array<GraphicalEntry>& visibleEntries,
+                              Frustum* frustum = nullptr);
   void CreateDebugGraphicals();
 
   Link<GraphicsSpace> EngineLink;
@@ -71,6 +104,12 @@ public:
   typedef InList<Camera, &Camera::SpaceLink> CameraList;
   CameraList mCameras;
 
+  ParticleSystem::UpdateList mParticleSystems;
+  // Particle systems being updated on the main thread or job threads, kept
+  // around to avoid allocating every update.
+  Array<ParticleSystem*> mMainThreadParticleSystems;
+  Array<ParticleSystem*> mJobParticleSystems;
+
   /// If graphics for this Space should be running.
   bool mActive;
 
@@ -94,6 +133,11 @@ public:
 
   Array<GraphicalEntry> mVisibleGraphicals;
 
+  // Per camera culling data, kept around to avoid allocating every frame.
+  Array<CameraCullData> mCameraCullData;
+  // Scratch space for the entries of a single graphical's midphase query.
+  Array<GraphicalEntry> mMidPhaseEntries;
+
   Array<uint> mRenderTaskRangeIndices;
 
   float mFrameTime;
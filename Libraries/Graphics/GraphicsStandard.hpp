@@ -83,6 +83,7 @@ public:
 #include "GraphicsSpace.hpp"
 
 #include "GraphicsEngine.hpp"
+#include "GraphicsBenchmark.hpp"
 
 // Deprecate
 #include "Definition.hpp"
@@ -73,6 +73,12 @@ bool Model::TestFrustum(const Frustum& frustum, CastInfo& castInfo)
   return mMesh->TestFrustum(localFrustum);
 }
 
+bool Model::CanExtractOnJobThread()
+{
+  // The world matrix is cached on the main thread before extracting
+  return true;
+}
+
 Mesh* Model::GetMesh()
 {
   return mMesh;
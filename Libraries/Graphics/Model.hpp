@@ -23,6 +23,7 @@ public:
   void ExtractViewData(ViewNode& viewNode, ViewBlock& viewBlock, FrameBlock& frameBlock) override;
   bool TestRay(GraphicsRayCast& rayCast, CastInfo& castInfo) override;
   bool TestFrustum(const Frustum& frustum, CastInfo& castInfo) override;
+  bool CanExtractOnJobThread() override;
 
   /// Mesh that the graphical will render.
   Mesh* GetMesh();
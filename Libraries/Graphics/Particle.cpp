@@ -9,82 +9,323 @@ namespace Tags
 DefineTag(Particle);
 }
 
-//////////Helper functions///////////////
-void PushFront(Particle*& front, Particle* particle)
+ZilchDefineType(Particle, builder, type)
 {
-  particle->Next = front;
-  front = particle;
+  ZilchBindDefaultCopyDestructor();
+  ZilchBindGetterSetterProperty(Time);
+  ZilchBindGetterSetterProperty(Lifetime);
+  ZilchBindGetterSetterProperty(Size);
+  ZilchBindGetterSetterProperty(Rotation);
+  ZilchBindGetterSetterProperty(RotationalVelocity);
+  ZilchBindGetterSetterProperty(Position);
+  ZilchBindGetterSetterProperty(Velocity);
+  ZilchBindGetterSetterProperty(Color);
+  ZilchBindGetterSetterProperty(WanderAngle);
+  ZilchBindMethod(IsValid);
 }
 
-ZilchDefineType(Particle, builder, type)
+Particle::Particle() : mIndex(0), mGeneration(0)
 {
-  type->HandleManager = ZilchManagerId(PointerManager);
-  ZilchBindFieldProperty(Time);
-  ZilchBindFieldProperty(Lifetime);
-  ZilchBindFieldProperty(Size);
-  ZilchBindFieldProperty(Rotation);
-  ZilchBindFieldProperty(RotationalVelocity);
-  ZilchBindFieldProperty(Position);
-  ZilchBindFieldProperty(Velocity);
-  ZilchBindFieldProperty(Color);
-  ZilchBindFieldProperty(WanderAngle);
 }
 
-Memory::Pool* ParticleList::Memory = NULL;
+Particle::Particle(ParticleSystem* system, uint index) :
+    mSystem(system),
+    mIndex(index),
+    mGeneration(system->mParticleList.mGeneration)
+{
+}
 
-void ParticleList::Initialize()
+float Particle::GetTime()
+{
+  ParticleList* particleList = GetParticleList();
+  return particleList ? particleList->mTime[mIndex] : 0.0f;
+}
+
+void Particle::SetTime(float time)
+{
+  if (ParticleList* particleList = GetParticleList())
+    particleList->mTime[mIndex] = time;
+}
+
+float Particle::GetLifetime()
+{
+  ParticleList* particleList = GetParticleList();
+  return particleList ? particleList->mLifetime[mIndex] : 0.0f;
+}
+
+void Particle::SetLifetime(float lifetime)
+{
+  if (ParticleList* particleList = GetParticleList())
+    particleList->mLifetime[mIndex] = lifetime;
+}
+
+float Particle::GetSize()
+{
+  ParticleList* particleList = GetParticleList();
+  return particleList ? particleList->mSize[mIndex] : 0.0f;
+}
+
+void Particle::SetSize(float size)
+{
+  if (ParticleList* particleList = GetParticleList())
+    particleList->mSize[mIndex] = size;
+}
+
+float Particle::GetRotation()
+{
+  ParticleList* particleList = GetParticleList();
+  return particleList ? particleList->mRotation[mIndex] : 0.0f;
+}
+
+void Particle::SetRotation(float rotation)
+{
+  if (ParticleList* particleList = GetParticleList())
+    particleList->mRotation[mIndex] = rotation;
+}
+
+float Particle::GetRotationalVelocity()
+{
+  ParticleList* particleList = GetParticleList();
+  return particleList ? particleList->mRotationalVelocity[mIndex] : 0.0f;
+}
+
+void Particle::SetRotationalVelocity(float rotationalVelocity)
+{
+  if (ParticleList* particleList = GetParticleList())
+    particleList->mRotationalVelocity[mIndex] = rotationalVelocity;
+}
+
+Vec3 Particle::GetPosition()
+{
+  ParticleList* particleList = GetParticleList();
+  return particleList ? particleList->GetPosition(mIndex) : Vec3::cZero;
+}
+
+void Particle::SetPosition(Vec3Param position)
+{
+  if (ParticleList* particleList = GetParticleList())
+    particleList->SetPosition(mIndex, position);
+}
+
+Vec3 Particle::GetVelocity()
+{
+  ParticleList* particleList = GetParticleList();
+  return particleList ? particleList->GetVelocity(mIndex) : Vec3::cZero;
+}
+
+void Particle::SetVelocity(Vec3Param velocity)
+{
+  if (ParticleList* particleList = GetParticleList())
+    particleList->SetVelocity(mIndex, velocity);
+}
+
+Vec4 Particle::GetColor()
+{
+  ParticleList* particleList = GetParticleList();
+  return particleList ? particleList->mColor[mIndex] : Vec4::cZero;
+}
+
+void Particle::SetColor(Vec4Param color)
+{
+  if (ParticleList* particleList = GetParticleList())
+    particleList->mColor[mIndex] = color;
+}
+
+float Particle::GetWanderAngle()
 {
-  Particles = NULL;
-  Destroyed = NULL;
-  mActiveParticles = 0;
+  ParticleList* particleList = GetParticleList();
+  return particleList ? particleList->mWanderAngle[mIndex] : 0.0f;
 }
 
-void ParticleList::AddParticle(Particle* particle)
+void Particle::SetWanderAngle(float wanderAngle)
 {
-  ++mActiveParticles;
-  PushFront(Particles, particle);
+  if (ParticleList* particleList = GetParticleList())
+    particleList->mWanderAngle[mIndex] = wanderAngle;
 }
 
-Particle* ParticleList::AllocateParticle()
+bool Particle::IsValid()
 {
-  return (Particle*)Memory->Allocate(sizeof(Particle));
+  return GetParticleList() != nullptr;
 }
 
-void ParticleList::FreeParticle(Particle* particle)
+ParticleList* Particle::GetParticleList()
 {
-  --mActiveParticles;
-  Memory->Deallocate(particle, sizeof(Particle));
+  // The system was destroyed?
+  ParticleSystem* system = mSystem;
+  if (system == nullptr)
+    return nullptr;
+
+  // Particles were removed (so this index may now be another particle)?
+  ParticleList* particleList = &system->mParticleList;
+  if (particleList->mGeneration != mGeneration || mIndex >= particleList->Size())
+    return nullptr;
+
+  return particleList;
+}
+
+ParticleList::range::range() : mEnd(0)
+{
+}
+
+ParticleList::range::range(ParticleSystem* system, uint begin, uint end) : mCurrent(system, begin), mEnd(end)
+{
+}
+
+void ParticleList::range::PopFront()
+{
+  ++mCurrent.mIndex;
+}
+
+Particle ParticleList::range::Front()
+{
+  return mCurrent;
 }
 
-void ParticleList::DestroyParticle(Particle* particle)
+bool ParticleList::range::Empty()
 {
-  PushFront(Destroyed, particle);
+  return mCurrent.mIndex >= mEnd || !mCurrent.IsValid();
 }
 
-void ParticleList::ClearDestroyed()
+ParticleList::ParticleList() : mGeneration(0)
 {
-  Particle* curParticle = Destroyed;
-  while (curParticle != NULL)
+}
+
+void ParticleList::Initialize()
+{
+  FreeParticles();
+}
+
+uint ParticleList::AddParticle(const ParticleData& particle)
+{
+  uint index = Size();
+  mTime.PushBack(particle.Time);
+  mLifetime.PushBack(particle.Lifetime);
+  mSize.PushBack(particle.Size);
+  mRotation.PushBack(particle.Rotation);
+  mRotationalVelocity.PushBack(particle.RotationalVelocity);
+  mPositionX.PushBack(particle.Position.x);
+  mPositionY.PushBack(particle.Position.y);
+  mPositionZ.PushBack(particle.Position.z);
+  mVelocityX.PushBack(particle.Velocity.x);
+  mVelocityY.PushBack(particle.Velocity.y);
+  mVelocityZ.PushBack(particle.Velocity.z);
+  mColor.PushBack(particle.Color);
+  mWanderAngle.PushBack(particle.WanderAngle);
+  return index;
+}
+
+// Moves the values of the living particles after the first dead particle
+// down, keeping their order (branchless so the loop can be vectorized)
+template <typename T>
+void CompactParticleValues(Array<T>& values, const float* time, const float* lifetime, uint firstDead, uint count)
+{
+  T* data = values.Data();
+  uint alive = firstDead;
+  for (uint i = firstDead; i < count; ++i)
   {
-    Particle* nextParticle = curParticle->Next;
-    FreeParticle(curParticle);
-    curParticle = nextParticle;
+    data[alive] = data[i];
+    alive += (time[i] < lifetime[i]);
   }
-  Destroyed = NULL;
+  values.Resize(alive);
 }
 
-void ParticleList::FreeParticles()
+uint ParticleList::RemoveDeadParticles()
 {
-  Particle* curParticle = Particles;
-  while (curParticle != NULL)
+  uint count = Size();
+  float* time = mTime.Data();
+  float* lifetime = mLifetime.Data();
+
+  // Particles before the first dead particle stay where they are
+  uint firstDead = 0;
+  while (firstDead < count && time[firstDead] < lifetime[firstDead])
+    ++firstDead;
+
+  if (firstDead == count)
+    return 0;
+
+  CompactParticleValues(mSize, time, lifetime, firstDead, count);
+  CompactParticleValues(mRotation, time, lifetime, firstDead, count);
+  CompactParticleValues(mRotationalVelocity, time, lifetime, firstDead, count);
+  CompactParticleValues(mPositionX, time, lifetime, firstDead, count);
+  CompactParticleValues(mPositionY, time, lifetime, firstDead, count);
+  CompactParticleValues(mPositionZ, time, lifetime, firstDead, count);
+  CompactParticleValues(mVelocityX, time, lifetime, firstDead, count);
+  CompactParticleValues(mVelocityY, time, lifetime, firstDead, count);
+  CompactParticleValues(mVelocityZ, time, lifetime, firstDead, count);
+  CompactParticleValues(mColor, time, lifetime, firstDead, count);
+  CompactParticleValues(mWanderAngle, time, lifetime, firstDead, count);
+
+  // Time and lifetime decide which particles are alive, so they are compacted
+  // last (each value is read before anything is written over it)
+  uint alive = firstDead;
+  for (uint i = firstDead; i < count; ++i)
   {
-    Particle* nextParticle = curParticle->Next;
-    FreeParticle(curParticle);
-    curParticle = nextParticle;
+    bool isAlive = time[i] < lifetime[i];
+    time[alive] = time[i];
+    lifetime[alive] = lifetime[i];
+    alive += isAlive;
   }
-  Particles = NULL;
-  ErrorIf(Destroyed != 0, "Particle on destroy.");
-  ErrorIf(mActiveParticles != 0, "Particle system memory error.");
+  mTime.Resize(alive);
+  mLifetime.Resize(alive);
+
+  ++mGeneration;
+  return count - alive;
+}
+
+void ParticleList::FreeParticles()
+{
+  if (!Empty())
+    ++mGeneration;
+
+  // Keep the memory around, systems tend to emit a similar amount of particles
+  // again after being cleared
+  mTime.Clear();
+  mLifetime.Clear();
+  mSize.Clear();
+  mRotation.Clear();
+  mRotationalVelocity.Clear();
+  mPositionX.Clear();
+  mPositionY.Clear();
+  mPositionZ.Clear();
+  mVelocityX.Clear();
+  mVelocityY.Clear();
+  mVelocityZ.Clear();
+  mColor.Clear();
+  mWanderAngle.Clear();
+}
+
+uint ParticleList::Size()
+{
+  return mTime.Size();
+}
+
+bool ParticleList::Empty()
+{
+  return mTime.Empty();
+}
+
+Vec3 ParticleList::GetPosition(uint index)
+{
+  return Vec3(mPositionX[index], mPositionY[index], mPositionZ[index]);
+}
+
+void ParticleList::SetPosition(uint index, Vec3Param position)
+{
+  mPositionX[index] = position.x;
+  mPositionY[index] = position.y;
+  mPositionZ[index] = position.z;
+}
+
+Vec3 ParticleList::GetVelocity(uint index)
+{
+  return Vec3(mVelocityX[index], mVelocityY[index], mVelocityZ[index]);
+}
+
+void ParticleList::SetVelocity(uint index, Vec3Param velocity)
+{
+  mVelocityX[index] = velocity.x;
+  mVelocityY[index] = velocity.y;
+  mVelocityZ[index] = velocity.z;
 }
 
 } // namespace Zero
@@ -9,14 +9,9 @@ namespace Tags
 DeclareTag(Particle);
 }
 
-/// The particle Contains the position, size, color,
-/// and other properties of any individual particle.
-class Particle
+/// The values of a single particle, used by emitters to add new particles.
+struct ParticleData
 {
-public:
-  ZilchDeclareType(Particle, TypeCopyMode::ReferenceType);
-
-  Particle* Next;
   float Time;
   float Lifetime;
   float Size;
@@ -28,64 +23,119 @@ public:
   float WanderAngle;
 };
 
-/// This class manages a linked-list of particles.
+/// The particle Contains the position, size, color,
+/// and other properties of any individual particle.
+/// Particles are stored by their particle system in contiguous arrays, this is
+/// a view of a single particle in those arrays. Particles move down when other
+/// particles die, so a particle is only valid until its system next removes
+/// particles (it is then invalid rather than referring to another particle).
+class Particle
+{
+public:
+  ZilchDeclareType(Particle, TypeCopyMode::ValueType);
+
+  Particle();
+  Particle(ParticleSystem* system, uint index);
+
+  float GetTime();
+  void SetTime(float time);
+  float GetLifetime();
+  void SetLifetime(float lifetime);
+  float GetSize();
+  void SetSize(float size);
+  float GetRotation();
+  void SetRotation(float rotation);
+  float GetRotationalVelocity();
+  void SetRotationalVelocity(float rotationalVelocity);
+  Vec3 GetPosition();
+  void SetPosition(Vec3Param position);
+  Vec3 GetVelocity();
+  void SetVelocity(Vec3Param velocity);
+  Vec4 GetColor();
+  void SetColor(Vec4Param color);
+  float GetWanderAngle();
+  void SetWanderAngle(float wanderAngle);
+
+  /// Whether or not this still refers to the same particle.
+  bool IsValid();
+
+  /// The particle list of the system if this particle is still valid.
+  ParticleList* GetParticleList();
+
+  HandleOf<ParticleSystem> mSystem;
+  uint mIndex;
+  /// Generation of the system's particle list when this particle was given.
+  uint mGeneration;
+};
+
+/// This class manages the particles of a particle system as a structure of
+/// arrays, each property of every particle is stored contiguously so that
+/// animators can update all particles with tight (vectorizable) loops. Dead
+/// particles are removed by moving the remaining particles down in order, so
+/// particles keep their draw order.
 class ParticleList
 {
 public:
-  Particle* AllocateParticle();
-  void FreeParticle(Particle* particle);
+  ParticleList();
 
-  void DestroyParticle(Particle* particle);
-  void ClearDestroyed();
+  void Initialize();
 
-  void AddParticle(Particle* particle);
+  /// Adds a particle to the end of the arrays and returns its index.
+  uint AddParticle(const ParticleData& particle);
+  /// Removes every particle that has outlived its lifetime, keeping the order
+  /// of the remaining particles. Returns the number of particles removed.
+  uint RemoveDeadParticles();
   void FreeParticles();
 
+  /// Number of active particles.
+  uint Size();
+  bool Empty();
+
+  Vec3 GetPosition(uint index);
+  void SetPosition(uint index, Vec3Param position);
+  Vec3 GetVelocity(uint index);
+  void SetVelocity(uint index, Vec3Param velocity);
+
+  /// A range of particles on a particle system, the range ends early if the
+  /// system removes particles.
   struct range
   {
-    typedef Particle* value_type;
-    typedef Particle*& FrontResult;
+    typedef Particle value_type;
+    typedef Particle FrontResult;
 
-    range() : mCurrentParticle(nullptr), mEndParticle(nullptr)
-    {
-    }
-    range(Particle* curr, Particle* endParticle = nullptr)
-    {
-      mCurrentParticle = curr;
-      mEndParticle = endParticle;
-    }
+    range();
+    range(ParticleSystem* system, uint begin, uint end);
 
-    void PopFront()
-    {
-      mCurrentParticle = mCurrentParticle->Next;
-    }
-    FrontResult Front()
-    {
-      return mCurrentParticle;
-    }
-    bool Empty()
-    {
-      return mCurrentParticle == mEndParticle;
-    }
+    void PopFront();
+    FrontResult Front();
+    bool Empty();
     range& All()
     {
       return *this;
     }
-    Particle* mCurrentParticle;
-    Particle* mEndParticle;
-  };
 
-  range All()
-  {
-    return range(Particles);
-  }
+    Particle mCurrent;
+    uint mEnd;
+  };
 
-  static Memory::Pool* Memory;
-  Particle* Particles;
-  Particle* Destroyed;
+  // Particle properties, indexed by particle
+  Array<float> mTime;
+  Array<float> mLifetime;
+  Array<float> mSize;
+  Array<float> mRotation;
+  Array<float> mRotationalVelocity;
+  Array<float> mPositionX;
+  Array<float> mPositionY;
+  Array<float> mPositionZ;
+  Array<float> mVelocityX;
+  Array<float> mVelocityY;
+  Array<float> mVelocityZ;
+  Array<Vec4> mColor;
+  Array<float> mWanderAngle;
 
-  uint mActiveParticles;
-  void Initialize();
+  /// Incremented whenever particles are removed (moving the remaining
+  /// particles), which invalidates every particle given out before.
+  uint mGeneration;
 };
 
 typedef ParticleList::range ParticleListRange;
@@ -17,6 +17,7 @@ ParticleAnimator::ParticleAnimator() : mGraphicsSpace(nullptr)
 void ParticleAnimator::Initialize(CogInitializer& initializer)
 {
   mGraphicsSpace = GetSpace()->has(GraphicsSpace);
+  mRandom.SetSeed(mGraphicsSpace->mRandom.Uint32());
 }
 
 } // namespace Zero
@@ -18,8 +18,18 @@ public:
   // Particle Animator Interface
   virtual void Animate(ParticleList* particleList, float dt, Mat4Ref transform) = 0;
 
+  // If this animator can animate from a job thread. If any emitter or animator
+  // in a particle system can't, the system is updated on the main thread.
+  virtual bool CanAnimateOnJobThread()
+  {
+    return true;
+  }
+
   Link<ParticleAnimator> link;
   GraphicsSpace* mGraphicsSpace;
+  // Each animator has its own random generator (seeded from the graphics space)
+  // so that particle systems can be updated concurrently.
+  Math::Random mRandom;
 };
 
 typedef InList<ParticleAnimator> AnimatorList;
@@ -49,8 +49,7 @@ LinearParticleAnimator::~LinearParticleAnimator()
 
 void LinearParticleAnimator::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
 {
-  Particle* p = particleList->Particles;
-  Math::Random& random = mGraphicsSpace->mRandom;
+  Math::Random& random = mRandom;
 
   Vec3 center = GetTranslationFrom(transform);
 
@@ -62,58 +61,91 @@ void LinearParticleAnimator::Animate(ParticleList* particleList, float dt, Mat4R
   Vec3 twistVector = mTwist;
   float twistStrength = twistVector.AttemptNormalize();
 
-  uint i = 0;
-  i += random.IntRangeInIn(0, 5);
-
-  while (p != NULL)
+  // Each particle uses the next random force sample (starting at a random
+  // sample), so combine the constant and random forces into the acceleration
+  // applied to each particle of a block of particles
+  uint start = random.IntRangeInIn(0, 5);
+  float accelerationX[cNumberOfRandomSamples];
+  float accelerationY[cNumberOfRandomSamples];
+  float accelerationZ[cNumberOfRandomSamples];
+  for (uint i = 0; i < cNumberOfRandomSamples; ++i)
   {
+    Vec3 acceleration = (mForce + randomForces[(start + i + 1) % cNumberOfRandomSamples]) * dt;
+    accelerationX[i] = acceleration.x;
+    accelerationY[i] = acceleration.y;
+    accelerationZ[i] = acceleration.z;
+  }
 
-    float t = p->Time;
-
-    i = (i + 1) % cNumberOfRandomSamples;
-
-    Vec3 velocity = p->Velocity;
-
-    // Apply constant force
-    velocity += mForce * dt;
-
-    // Apply random force
-    velocity += randomForces[i] * dt;
-
-    // Integrate position
-    Vec3 position = p->Position;
-    position += velocity * dt;
-    p->Position = position;
-
-    // Expand size
-    p->Size += mGrowth * dt;
-    p->Size = Math::Max(p->Size, 0.0f);
+  uint count = particleList->Size();
+  float* positionX = particleList->mPositionX.Data();
+  float* positionY = particleList->mPositionY.Data();
+  float* positionZ = particleList->mPositionZ.Data();
+  float* velocityX = particleList->mVelocityX.Data();
+  float* velocityY = particleList->mVelocityY.Data();
+  float* velocityZ = particleList->mVelocityZ.Data();
+  float* size = particleList->mSize.Data();
+  float* rotation = particleList->mRotation.Data();
+  float* rotationalVelocity = particleList->mRotationalVelocity.Data();
+
+  // Apply forces and integrate position
+  for (uint block = 0; block < count; block += cNumberOfRandomSamples)
+  {
+    uint blockCount = Math::Min(count - block, cNumberOfRandomSamples);
+    float* blockPositionX = positionX + block;
+    float* blockPositionY = positionY + block;
+    float* blockPositionZ = positionZ + block;
+    float* blockVelocityX = velocityX + block;
+    float* blockVelocityY = velocityY + block;
+    float* blockVelocityZ = velocityZ + block;
+    for (uint i = 0; i < blockCount; ++i)
+    {
+      blockVelocityX[i] += accelerationX[i];
+      blockVelocityY[i] += accelerationY[i];
+      blockVelocityZ[i] += accelerationZ[i];
+      blockPositionX[i] += blockVelocityX[i] * dt;
+      blockPositionY[i] += blockVelocityY[i] * dt;
+      blockPositionZ[i] += blockVelocityZ[i] * dt;
+    }
+  }
 
-    // Integrate rotation of particle
-    p->Rotation += p->RotationalVelocity * dt;
-    p->RotationalVelocity = p->RotationalVelocity + mTorque * dt;
+  // Expand size and integrate rotation
+  float growth = mGrowth * dt;
+  float torque = mTorque * dt;
+  for (uint i = 0; i < count; ++i)
+  {
+    size[i] = Math::Max(size[i] + growth, 0.0f);
+    rotation[i] += rotationalVelocity[i] * dt;
+    rotationalVelocity[i] += torque;
+  }
 
-    // Twist effect
-    if (twistStrength != 0.0f)
+  // Twist effect
+  if (twistStrength != 0.0f)
+  {
+    float twist = dt * twistStrength;
+    for (uint i = 0; i < count; ++i)
     {
-      Vec3 toCenter = center - p->Position;
+      Vec3 toCenter(center.x - positionX[i], center.y - positionY[i], center.z - positionZ[i]);
       toCenter.AttemptNormalize();
 
       Vec3 twistMove = Cross(toCenter, twistVector);
       Vec3 inVector = Cross(twistVector, twistMove);
-      velocity += (twistMove + inVector) * dt * twistStrength;
+      Vec3 change = (twistMove + inVector) * twist;
+      velocityX[i] += change.x;
+      velocityY[i] += change.y;
+      velocityZ[i] += change.z;
     }
+  }
 
-    // Damping
+  // Damping
+  float damping = Math::Clamp(1.0f - dt * mDampening, 0.0f, 1.0f);
+  if (damping != 1.0f)
+  {
+    for (uint i = 0; i < count; ++i)
     {
-      velocity *= Math::Clamp(1.0f - dt * mDampening, 0.0f, 1.0f);
+      velocityX[i] *= damping;
+      velocityY[i] *= damping;
+      velocityZ[i] *= damping;
     }
-
-    // Store updated velocity
-    p->Velocity = velocity;
-
-    // Move to next particle.
-    p = p->Next;
   }
 }
 
@@ -152,12 +184,15 @@ ParticleWander::~ParticleWander()
 
 void ParticleWander::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
 {
-  Particle* p = particleList->Particles;
-  Vec3 center = GetTranslationFrom(transform);
+  Math::Random& random = mRandom;
+  float wanderChange = dt * mWanderStrength;
 
-  while (p != NULL)
+  // Sampling the random wander changes one at a time keeps this loop scalar
+  uint count = particleList->Size();
+  float* wanderAngle = particleList->mWanderAngle.Data();
+  for (uint i = 0; i < count; ++i)
   {
-    Vec3 velocity = p->Velocity;
+    Vec3 velocity = particleList->GetVelocity(i);
     Vec3 normalizedVel = velocity;
     float l = normalizedVel.AttemptNormalize();
 
@@ -166,24 +201,20 @@ void ParticleWander::Animate(ParticleList* particleList, float dt, Mat4Ref trans
       normalizedVel /= l;
 
       // Get the current wander value
-      float curAngle = p->WanderAngle;
-      curAngle += mGraphicsSpace->mRandom.FloatVariance(mWanderAngle, mWanderAngleVariance) * dt;
+      float curAngle = wanderAngle[i];
+      curAngle += random.FloatVariance(mWanderAngle, mWanderAngleVariance) * dt;
 
       // Get a basis(not consistent varies based on normal)
       Vec3 a, b;
       Math::GenerateOrthonormalBasis(normalizedVel, &a, &b);
 
-      float wanderChange = dt * mWanderStrength;
       Vec3 change = Math::Cos(curAngle) * wanderChange * a + Math::Sin(curAngle) * wanderChange * b;
       velocity += change;
 
       // Store updated wander velocity
-      p->WanderAngle = curAngle;
-      p->Velocity = velocity;
+      wanderAngle[i] = curAngle;
+      particleList->SetVelocity(i, velocity);
     }
-
-    // Move to next particle.
-    p = p->Next;
   }
 }
 
@@ -226,38 +257,39 @@ void ParticleColorAnimator::Animate(ParticleList* particleList, float dt, Mat4Re
   if (timeGradient == nullptr && velocityGradient == nullptr)
     return;
 
-  float maxSpeedSq = mMaxParticleSpeed * mMaxParticleSpeed;
+  uint count = particleList->Size();
+  Vec4* color = particleList->mColor.Data();
 
-  // Iterate over each particle
-  Particle* p = particleList->Particles;
-  while (p != NULL)
+  // Sample time gradient
+  if (timeGradient)
   {
-    Vec4 color = Vec4(1);
-
-    // Sample time gradient
-    if (timeGradient)
-    {
-      float normalizedT = p->Time / p->Lifetime;
-      color *= timeGradient->Sample(normalizedT);
-    }
+    float* time = particleList->mTime.Data();
+    float* lifetime = particleList->mLifetime.Data();
+    for (uint i = 0; i < count; ++i)
+      color[i] = timeGradient->Sample(time[i] / lifetime[i]);
+  }
+  else
+  {
+    for (uint i = 0; i < count; ++i)
+      color[i] = Vec4(1);
+  }
 
-    // Sample velocity gradient
-    if (velocityGradient)
+  // Sample velocity gradient
+  if (velocityGradient)
+  {
+    float invMaxSpeedSq = 1.0f / (mMaxParticleSpeed * mMaxParticleSpeed);
+    float* velocityX = particleList->mVelocityX.Data();
+    float* velocityY = particleList->mVelocityY.Data();
+    float* velocityZ = particleList->mVelocityZ.Data();
+    for (uint i = 0; i < count; ++i)
     {
-      float speedSq = Math::LengthSq(p->Velocity);
-      float normalizedT = speedSq / maxSpeedSq;
+      float speedSq = velocityX[i] * velocityX[i] + velocityY[i] * velocityY[i] + velocityZ[i] * velocityZ[i];
 
       // Don't let it go above 1
-      normalizedT = Math::Min(normalizedT, 1.0f);
+      float normalizedT = Math::Min(speedSq * invMaxSpeedSq, 1.0f);
 
-      color *= velocityGradient->Sample(normalizedT);
+      color[i] *= velocityGradient->Sample(normalizedT);
     }
-
-    // Set the final color
-    p->Color = color;
-
-    // Move to next particle.
-    p = p->Next;
   }
 }
 
@@ -297,7 +329,6 @@ void ParticleAttractor::Initialize(CogInitializer& initializer)
 
 void ParticleAttractor::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
 {
-  Vec3 center = GetTranslationFrom(transform);
   float range = mMaxDistance - mMinDistance;
   float invRange = (1.0f / range);
 
@@ -305,24 +336,35 @@ void ParticleAttractor::Animate(ParticleList* particleList, float dt, Mat4Ref tr
   if (mPositionSpace == SystemSpace::LocalSpace)
     attractPosition = Math::TransformPoint(transform, attractPosition);
 
-  Particle* particle = particleList->Particles;
-  while (particle != NULL)
+  float minDistance = mMinDistance;
+  float strength = mStrength * dt;
+
+  uint count = particleList->Size();
+  float* positionX = particleList->mPositionX.Data();
+  float* positionY = particleList->mPositionY.Data();
+  float* positionZ = particleList->mPositionZ.Data();
+  float* velocityX = particleList->mVelocityX.Data();
+  float* velocityY = particleList->mVelocityY.Data();
+  float* velocityZ = particleList->mVelocityZ.Data();
+  for (uint i = 0; i < count; ++i)
   {
-    Vec3 toAttractPoint = attractPosition - particle->Position;
-    float distance = toAttractPoint.AttemptNormalize();
+    float toAttractX = attractPosition.x - positionX[i];
+    float toAttractY = attractPosition.y - positionY[i];
+    float toAttractZ = attractPosition.z - positionZ[i];
 
-    distance -= mMinDistance;
-    distance *= invRange;
+    // Math::Sqrt isn't inlined, which would stop this loop from vectorizing
+    float distance = std::sqrt(toAttractX * toAttractX + toAttractY * toAttractY + toAttractZ * toAttractZ);
 
-    float falloff = 1.0f - distance;
-    falloff = Math::Clamp(falloff, 0.0f, 1.0f);
+    // Normalize the direction (left as zero when on the attract point)
+    float invDistance = distance > 0.0f ? 1.0f / distance : 0.0f;
 
-    Vec3 velocity = particle->Velocity;
-    velocity += toAttractPoint * mStrength * falloff * dt;
-    particle->Velocity = velocity;
+    float falloff = 1.0f - (distance - minDistance) * invRange;
+    falloff = Math::Clamp(falloff, 0.0f, 1.0f);
 
-    // Move to next particle.
-    particle = particle->Next;
+    float scale = invDistance * strength * falloff;
+    velocityX[i] += toAttractX * scale;
+    velocityY[i] += toAttractY * scale;
+    velocityZ[i] += toAttractZ * scale;
   }
 }
 
@@ -372,29 +414,46 @@ void ParticleTwister::Animate(ParticleList* particleList, float dt, Mat4Ref tran
     invRange = (1.0f / range);
 
   Vec3 twistVector = mAxis;
-  float strength = mStrength;
-
-  Particle* particle = particleList->Particles;
-  while (particle != NULL)
+  float minDistance = mMinDistance;
+  float strength = mStrength * dt;
+
+  uint count = particleList->Size();
+  float* positionX = particleList->mPositionX.Data();
+  float* positionY = particleList->mPositionY.Data();
+  float* positionZ = particleList->mPositionZ.Data();
+  float* velocityX = particleList->mVelocityX.Data();
+  float* velocityY = particleList->mVelocityY.Data();
+  float* velocityZ = particleList->mVelocityZ.Data();
+  for (uint i = 0; i < count; ++i)
   {
-    Vec3 toCenter = center - particle->Position;
-    float distance = toCenter.Normalize();
-    Vec3 velocity = particle->Velocity;
-
-    distance -= mMinDistance;
-    distance *= invRange;
-
-    float falloff = 1.0f - distance;
+    float toCenterX = center.x - positionX[i];
+    float toCenterY = center.y - positionY[i];
+    float toCenterZ = center.z - positionZ[i];
+    float distance = std::sqrt(toCenterX * toCenterX + toCenterY * toCenterY + toCenterZ * toCenterZ);
+
+    // Normalize the direction (left as zero when at the center)
+    float invDistance = distance > 0.0f ? 1.0f / distance : 0.0f;
+    toCenterX *= invDistance;
+    toCenterY *= invDistance;
+    toCenterZ *= invDistance;
+
+    float falloff = 1.0f - (distance - minDistance) * invRange;
     falloff = Math::Clamp(falloff, 0.0f, 1.0f);
 
-    Vec3 twistMove = Cross(toCenter, twistVector);
-    Vec3 inVector = Cross(twistVector, twistMove);
-    velocity += (twistMove + inVector) * (dt * strength * falloff);
+    // twistMove = Cross(toCenter, twistVector)
+    float twistMoveX = toCenterY * twistVector.z - toCenterZ * twistVector.y;
+    float twistMoveY = toCenterZ * twistVector.x - toCenterX * twistVector.z;
+    float twistMoveZ = toCenterX * twistVector.y - toCenterY * twistVector.x;
 
-    particle->Velocity = velocity;
+    // inVector = Cross(twistVector, twistMove)
+    float inVectorX = twistVector.y * twistMoveZ - twistVector.z * twistMoveY;
+    float inVectorY = twistVector.z * twistMoveX - twistVector.x * twistMoveZ;
+    float inVectorZ = twistVector.x * twistMoveY - twistVector.y * twistMoveX;
 
-    // Move to next particle.
-    particle = particle->Next;
+    float scale = strength * falloff;
+    velocityX[i] += (twistMoveX + inVectorX) * scale;
+    velocityY[i] += (twistMoveY + inVectorY) * scale;
+    velocityZ[i] += (twistMoveZ + inVectorZ) * scale;
   }
 }
 
@@ -431,9 +490,9 @@ void ParticleCollisionPlane::Initialize(CogInitializer& initializer)
   GetOwner()->has(ParticleSystem)->AddAnimator(this);
 }
 
-void ReflectParticle(Particle* particle, Vec3Param planeNormal, float restitution, float friction)
+void ReflectParticle(ParticleList* particleList, uint index, Vec3Param planeNormal, float restitution, float friction)
 {
-  Vec3 velocity = particle->Velocity;
+  Vec3 velocity = particleList->GetVelocity(index);
 
   // Reflect
   velocity = Math::ReflectAcrossPlane(velocity, planeNormal);
@@ -447,7 +506,7 @@ void ReflectParticle(Particle* particle, Vec3Param planeNormal, float restitutio
   velocityTangent *= (1.0f - friction);
 
   // Re-compute the velocity
-  particle->Velocity = velocityNormal + velocityTangent;
+  particleList->SetVelocity(index, velocityNormal + velocityTangent);
 }
 
 void ParticleCollisionPlane::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
@@ -462,22 +521,19 @@ void ParticleCollisionPlane::Animate(ParticleList* particleList, float dt, Mat4R
 
   Plane plane(planeNormal, planePosition);
 
-  Particle* particle = particleList->Particles;
-  while (particle != NULL)
+  uint count = particleList->Size();
+  for (uint i = 0; i < count; ++i)
   {
-    Vec3 position = particle->Position;
+    Vec3 position = particleList->GetPosition(i);
 
     float distance = plane.SignedDistanceToPlane(position);
     if (distance < 0)
     {
       // Project the particle back onto the plane
-      particle->Position = position + (planeNormal * -distance);
+      particleList->SetPosition(i, position + (planeNormal * -distance));
 
-      ReflectParticle(particle, planeNormal, mRestitution, mFriction);
+      ReflectParticle(particleList, i, planeNormal, mRestitution, mFriction);
     }
-
-    // Move to next particle.
-    particle = particle->Next;
   }
 }
 
@@ -552,28 +608,24 @@ void ParticleCollisionHeightmap::Animate(ParticleList* particleList, float dt, M
   Vec3 mapRight, mapForward;
   Math::GenerateOrthonormalBasis(mapUp, &mapRight, &mapForward);
 
-  Particle* particle = particleList->Particles;
-  while (particle != NULL)
+  uint count = particleList->Size();
+  for (uint i = 0; i < count; ++i)
   {
-    Vec3 position = particle->Position;
+    Vec3 position = particleList->GetPosition(i);
 
     Vec3 normal;
     float sampleHeight = map->SampleHeight(position, -Math::PositiveMax(), &normal);
     float particleHeight = map->GetWorldPointHeight(position);
-    float particleBottom = particleHeight - particle->Size;
 
     if (particleHeight < sampleHeight)
     {
-      Vec3 velocity = particle->Velocity;
+      Vec3 velocity = particleList->GetVelocity(i);
 
       // Move to our previous position
-      particle->Position = particle->Position - velocity * dt;
+      particleList->SetPosition(i, position - velocity * dt);
 
-      ReflectParticle(particle, normal, mRestitution, mFriction);
+      ReflectParticle(particleList, i, normal, mRestitution, mFriction);
     }
-
-    // Move to next particle.
-    particle = particle->Next;
   }
 }
 
@@ -181,6 +181,11 @@ public:
 
   // ParticleAnimator Interface
   void Animate(ParticleList* particleList, float dt, Mat4Ref transform) override;
+  // Resolves the height map's cog path and queries its transform.
+  bool CanAnimateOnJobThread() override
+  {
+    return false;
+  }
 
   /// How much the particle will bounce during a collision. Values should be in
   /// the range of [0, 1], where 0 is an in-elastic collision and 1 is a fully
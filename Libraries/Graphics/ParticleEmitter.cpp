@@ -29,6 +29,7 @@ ParticleEmitter::~ParticleEmitter()
 void ParticleEmitter::Initialize(CogInitializer& initializer)
 {
   mGraphicsSpace = GetSpace()->has(GraphicsSpace);
+  mRandom.SetSeed(mGraphicsSpace->mRandom.Uint32());
 
   GetOwner()->has(ParticleSystem)->AddEmitter(this);
   mTransform = GetOwner()->has(Transform);
@@ -108,6 +109,7 @@ ParticleEmitterShared::ParticleEmitterShared()
   mAccumulation = 0.0f;
   mEmitRateCurrent = 0.0f;
   mSample = 0.0f;
+  mExhaustedEventQueued = false;
 }
 
 ParticleEmitterShared::~ParticleEmitterShared()
@@ -164,6 +166,16 @@ void ParticleEmitterShared::ResetCount()
   mCurrentCount = mEmitCount;
 }
 
+void ParticleEmitterShared::SendQueuedEvents()
+{
+  if (!mExhaustedEventQueued)
+    return;
+
+  mExhaustedEventQueued = false;
+  ObjectEvent e(this);
+  GetOwner()->GetDispatcher()->Dispatch(Events::ParticlesExhausted, &e);
+}
+
 float ParticleEmitterShared::GetEmitRate()
 {
   return mEmitRate;
@@ -198,7 +210,7 @@ int ParticleEmitterShared::GetParticleEmissionCount(ParticleList* particleList,
   if (mSample < sampleTiming)
   {
     mSample += sampleTiming;
-    mEmitRateCurrent = mGraphicsSpace->mRandom.FloatVariance(mEmitRate, mEmitVariance);
+    mEmitRateCurrent = mRandom.FloatVariance(mEmitRate, mEmitVariance);
   }
 
   if (mEmitRateCurrent <= 0.0f)
@@ -230,8 +242,8 @@ int ParticleEmitterShared::GetParticleEmissionCount(ParticleList* particleList,
         particlesToEmit = mCurrentCount;
         mCurrentCount = 0;
         // this emitter has exhausted all the particles it will ever emit.
-        ObjectEvent e(this);
-        GetOwner()->GetDispatcher()->Dispatch(Events::ParticlesExhausted, &e);
+        // This may be on a job thread, so the event is sent later.
+        mExhaustedEventQueued = true;
       }
     }
     else
@@ -243,13 +255,13 @@ int ParticleEmitterShared::GetParticleEmissionCount(ParticleList* particleList,
   return particlesToEmit;
 }
 
-Particle* ParticleEmitterShared::CreateInitializedParticle(ParticleList* particleList,
-                                                           int particle,
-                                                           Mat4Ref transform,
-                                                           Vec3Param emitterVelocity)
+uint ParticleEmitterShared::CreateInitializedParticle(ParticleList* particleList,
+                                                      int particle,
+                                                      Mat4Ref transform,
+                                                      Vec3Param emitterVelocity)
 {
-  Particle* newParticle = particleList->AllocateParticle();
-  Math::Random& random = mGraphicsSpace->mRandom;
+  ParticleData newParticle;
+  Math::Random& random = mRandom;
 
   Vec3 direction;
 
@@ -277,25 +289,25 @@ Particle* ParticleEmitterShared::CreateInitializedParticle(ParticleList* particl
     velocity += dirNorm * mTangentVelocity.z + crossA * mTangentVelocity.y + crossB * mTangentVelocity.x;
   }
 
-  newParticle->Time = 0;
-  newParticle->Size = random.FloatVariance(mSize, mSizeVariance);
+  newParticle.Time = 0;
+  newParticle.Size = random.FloatVariance(mSize, mSizeVariance);
+
+  newParticle.Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
+  newParticle.Position = Math::TransformPoint(transform, startingPoint);
+  newParticle.Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
 
-  newParticle->Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
-  newParticle->Position = Math::TransformPoint(transform, startingPoint);
-  newParticle->Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
+  newParticle.Color = Vec4(1, 1, 1, 1);
 
-  newParticle->WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+  newParticle.WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
 
   if (mRandomSpin)
-    newParticle->Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+    newParticle.Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
   else
-    newParticle->Rotation = 0;
-
-  newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
+    newParticle.Rotation = 0;
 
-  particleList->AddParticle(newParticle);
+  newParticle.RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
 
-  return newParticle;
+  return particleList->AddParticle(newParticle);
 }
 
 } // namespace Zero
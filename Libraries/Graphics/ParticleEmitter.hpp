@@ -32,12 +32,26 @@ public:
   // Reset the number of particles to emit back to EmitCount.
   virtual void ResetCount(){};
 
+  // If this emitter can emit from a job thread. If any emitter or animator in a
+  // particle system can't, the system is updated on the main thread.
+  virtual bool CanEmitOnJobThread()
+  {
+    return true;
+  }
+
+  // Dispatches events queued up while emitting (always called on the main
+  // thread after the particle system has been updated).
+  virtual void SendQueuedEvents(){};
+
   void UpdateLastTranslation();
 
   Link<ParticleEmitter> link;
   Vec3 mLastFramePosition;
   Transform* mTransform;
   GraphicsSpace* mGraphicsSpace;
+  // Each emitter has its own random generator (seeded from the graphics space)
+  // so that particle systems can be updated concurrently.
+  Math::Random mRandom;
 };
 
 typedef InList<ParticleEmitter> EmitterList;
@@ -57,11 +71,15 @@ public:
 
   // Mix in Helpers
   int GetParticleEmissionCount(ParticleList* particleList, float dt, float timeAlive);
-  Particle*
-  CreateInitializedParticle(ParticleList* particleList, int particle, Mat4Ref transform, Vec3Param emitterVelocity);
+  // Returns the index of the new particle.
+  uint CreateInitializedParticle(ParticleList* particleList,
+                                 int particle,
+                                 Mat4Ref transform,
+                                 Vec3Param emitterVelocity);
 
   /// Reset the number of particles to emit back to EmitCount.
   void ResetCount() override;
+  void SendQueuedEvents() override;
 
   /// Rate that particles spawn per second.
   float GetEmitRate();
@@ -138,6 +156,9 @@ public:
   float mAccumulation;
   float mSample;
   float mEmitRateCurrent;
+  // Set when the emitter runs out of particles, the event is sent after the
+  // particle system has been updated.
+  bool mExhaustedEventQueued;
 
   static const float mMaxEmitRate;
 };
@@ -38,7 +38,7 @@ int SphericalParticleEmitter::EmitParticles(
   if (particlesToEmit == 0)
     return 0;
 
-  Math::Random& random = mGraphicsSpace->mRandom;
+  Math::Random& random = mRandom;
 
   Vec3 newPosition = GetTranslationFrom(transform);
   Vec3 offset = mLastFramePosition - newPosition;
@@ -47,7 +47,7 @@ int SphericalParticleEmitter::EmitParticles(
 
   for (int p = 0; p < particlesToEmit; ++p)
   {
-    Particle* newParticle = particleList->AllocateParticle();
+    ParticleData newParticle;
 
     Vec3 direction;
 
@@ -75,30 +75,30 @@ int SphericalParticleEmitter::EmitParticles(
       velocity += dirNorm * mTangentVelocity.z + crossA * mTangentVelocity.y + crossB * mTangentVelocity.x;
     }
 
-    newParticle->Time = 0;
-    newParticle->Size = random.FloatVariance(mSize, mSizeVariance);
+    newParticle.Time = 0;
+    newParticle.Size = random.FloatVariance(mSize, mSizeVariance);
 
-    newParticle->Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
+    newParticle.Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
 
-    newParticle->Position = Math::TransformPoint(transform, startingPoint);
+    newParticle.Position = Math::TransformPoint(transform, startingPoint);
 
     if (mFastMovingEmitter)
     {
-      newParticle->Position += offsetDelta * (float)p;
+      newParticle.Position += offsetDelta * (float)p;
     }
 
-    newParticle->Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
+    newParticle.Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
 
-    newParticle->Color = Vec4(1, 1, 1, 1);
+    newParticle.Color = Vec4(1, 1, 1, 1);
 
-    newParticle->WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+    newParticle.WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
 
     if (mRandomSpin)
-      newParticle->Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+      newParticle.Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
     else
-      newParticle->Rotation = 0;
+      newParticle.Rotation = 0;
 
-    newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
+    newParticle.RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
 
     particleList->AddParticle(newParticle);
   }
@@ -139,7 +139,7 @@ int BoxParticleEmitter::EmitParticles(
   if (particlesToEmit == 0)
     return 0;
 
-  Math::Random& random = mGraphicsSpace->mRandom;
+  Math::Random& random = mRandom;
 
   Vec3 newPosition = GetTranslationFrom(transform);
   Vec3 offset = mLastFramePosition - newPosition;
@@ -148,7 +148,7 @@ int BoxParticleEmitter::EmitParticles(
 
   for (int p = 0; p < particlesToEmit; ++p)
   {
-    Particle* newParticle = particleList->AllocateParticle();
+    ParticleData newParticle;
 
     Vec3 halfExtents = mEmitterSize * 0.5f;
     Vec3 startingPoint = Vec3(0, 0, 0);
@@ -167,30 +167,30 @@ int BoxParticleEmitter::EmitParticles(
       velocity += dirNorm * mTangentVelocity.z + crossA * mTangentVelocity.y + crossB * mTangentVelocity.x;
     }
 
-    newParticle->Time = 0;
-    newParticle->Size = random.FloatVariance(mSize, mSizeVariance);
+    newParticle.Time = 0;
+    newParticle.Size = random.FloatVariance(mSize, mSizeVariance);
 
-    newParticle->Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
+    newParticle.Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
 
-    newParticle->Position = Math::TransformPoint(transform, startingPoint);
+    newParticle.Position = Math::TransformPoint(transform, startingPoint);
 
     if (mFastMovingEmitter)
     {
-      newParticle->Position += offsetDelta * (float)p;
+      newParticle.Position += offsetDelta * (float)p;
     }
 
-    newParticle->Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
+    newParticle.Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
 
-    newParticle->Color = Vec4(1, 1, 1, 1);
+    newParticle.Color = Vec4(1, 1, 1, 1);
 
-    newParticle->WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+    newParticle.WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
 
     if (mRandomSpin)
-      newParticle->Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+      newParticle.Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
     else
-      newParticle->Rotation = 0;
+      newParticle.Rotation = 0;
 
-    newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
+    newParticle.RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
 
     particleList->AddParticle(newParticle);
   }
@@ -316,14 +316,14 @@ int MeshParticleEmitter::EmitParticles(
   if (!mActive)
     return 0;
 
-  Math::Random& random = mGraphicsSpace->mRandom;
+  Math::Random& random = mRandom;
 
   Setup();
 
   int particlesToEmit = GetParticleEmissionCount(particleList, dt, timeAlive);
   for (int p = 0; p < particlesToEmit; ++p)
   {
-    Particle* newParticle = particleList->AllocateParticle();
+    ParticleData newParticle;
 
     Vec3 position, normal;
     GetNextEmitPoint(&position, &normal);
@@ -341,23 +341,23 @@ int MeshParticleEmitter::EmitParticles(
       velocity += dirNorm * mTangentVelocity.z + crossA * mTangentVelocity.y + crossB * mTangentVelocity.x;
     }
 
-    newParticle->Time = 0;
-    newParticle->Size = random.FloatVariance(mSize, mSizeVariance);
+    newParticle.Time = 0;
+    newParticle.Size = random.FloatVariance(mSize, mSizeVariance);
 
-    newParticle->Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
-    newParticle->Position = Math::TransformPoint(transform, startingPoint);
-    newParticle->Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
+    newParticle.Velocity = Math::TransformNormal(transform, velocity) + emitterVelocity * mEmitterVelocityPercent;
+    newParticle.Position = Math::TransformPoint(transform, startingPoint);
+    newParticle.Lifetime = random.FloatVariance(mLifetime, mLifetimeVariance);
 
-    newParticle->Color = Vec4(1, 1, 1, 1);
+    newParticle.Color = Vec4(1, 1, 1, 1);
 
-    newParticle->WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+    newParticle.WanderAngle = random.FloatRange(0.0f, 2 * Math::cTwoPi);
 
     if (mRandomSpin)
-      newParticle->Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
+      newParticle.Rotation = random.FloatRange(0.0f, 2 * Math::cTwoPi);
     else
-      newParticle->Rotation = 0;
+      newParticle.Rotation = 0;
 
-    newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
+    newParticle.RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
 
     particleList->AddParticle(newParticle);
   }
@@ -367,7 +367,7 @@ int MeshParticleEmitter::EmitParticles(
 
 void MeshParticleEmitter::GetNextEmitPoint(Vec3Ptr position, Vec3Ptr normal)
 {
-  Math::Random& random = mGraphicsSpace->mRandom;
+  Math::Random& random = mRandom;
 
   Mesh* mesh = mMesh;
   if (mesh == nullptr)
@@ -114,6 +114,8 @@ void ParticleSystem::Initialize(CogInitializer& initializer)
   mParticleList.Initialize();
   mTimeAlive = 0.0f;
   mDebugDrawing = false;
+  mWorldMatrix = Mat4::cIdentity;
+  mAllParticlesDeadQueued = false;
 
   if (Z::gRuntimeEditor)
   {
@@ -121,10 +123,9 @@ void ParticleSystem::Initialize(CogInitializer& initializer)
     ConnectThisTo(Z::gRuntimeEditor->GetActiveSelection(), Events::SelectionFinal, OnSelectionFinal);
   }
 
-  if (mPreviewInEditor && GetSpace()->IsEditorMode())
-    ConnectThisTo(GetSpace(), Events::FrameUpdate, OnUpdate);
-  else
-    ConnectThisTo(GetSpace(), Events::LogicUpdate, OnUpdate);
+  // The graphics space updates every particle system in the space together
+  mFrameUpdate = mPreviewInEditor && GetSpace()->IsEditorMode();
+  mGraphicsSpace->AddParticleSystem(this);
 }
 
 void ParticleSystem::ScriptInitialize(CogInitializer& initializer)
@@ -181,6 +182,7 @@ void ParticleSystem::OnDestroy(uint flags)
       parentSystem->RemoveChildSystem(this);
   }
 
+  mGraphicsSpace->RemoveParticleSystem(this);
   Clear();
 
   Graphical::OnDestroy(flags);
@@ -271,17 +273,13 @@ void ParticleSystem::SetPreviewInEditor(bool previewInEditor)
   if (!GetSpace()->IsEditorMode())
     return;
 
+  mFrameUpdate = mPreviewInEditor;
   if (mPreviewInEditor)
   {
     mDebugDrawing = false;
-    ConnectThisTo(GetSpace(), Events::FrameUpdate, OnUpdate);
-    GetSpace()->GetDispatcher()->DisconnectEvent(Events::LogicUpdate, this);
   }
   else
   {
-    ConnectThisTo(GetSpace(), Events::LogicUpdate, OnUpdate);
-    GetSpace()->GetDispatcher()->DisconnectEvent(Events::FrameUpdate, this);
-
     // If we're selected in the editor, it's being updated by DebugDraw(), so
     // don't clear the particles
     if (!IsSelectedInEditor())
@@ -291,12 +289,11 @@ void ParticleSystem::SetPreviewInEditor(bool previewInEditor)
 
 ParticleListRange ParticleSystem::AllParticles()
 {
-  return mParticleList.All();
+  return ParticleListRange(this, 0, mParticleList.Size());
 }
 
 void ParticleSystem::Clear()
 {
-  mParticleList.ClearDestroyed();
   mParticleList.FreeParticles();
 
   forRange (ParticleEmitter& emitter, mEmitters.All())
@@ -306,20 +303,73 @@ void ParticleSystem::Clear()
     r.Front().Clear();
 }
 
-void ParticleSystem::OnUpdate(UpdateEvent* event)
-{
-  SystemUpdate(event->Dt);
-}
-
 void ParticleSystem::SystemUpdate(float dt)
 {
   // Our parent will update us if we're a child system
   if (mChildSystem)
     return;
 
+  PrepareUpdate();
+  UpdateParticles(dt);
+  SendQueuedEvents();
+}
+
+void ParticleSystem::PrepareUpdate()
+{
+  mWorldMatrix = mTransform->GetWorldMatrix();
+
+  for (ParticleSystemList::range r = mChildSystems.All(); !r.Empty(); r.PopFront())
+    r.Front().PrepareUpdate();
+}
+
+void ParticleSystem::UpdateParticles(float dt)
+{
   BaseUpdate(dt);
   UpdateLifetimes(dt);
-  mParticleList.ClearDestroyed();
+}
+
+void ParticleSystem::SendQueuedEvents()
+{
+  forRange (ParticleEmitter& emitter, mEmitters.All())
+    emitter.SendQueuedEvents();
+
+  if (mAllParticlesDeadQueued)
+  {
+    mAllParticlesDeadQueued = false;
+    ObjectEvent event(this);
+    DispatchEvent(Events::AllParticlesDead, &event);
+  }
+
+  for (ParticleSystemList::range r = mChildSystems.All(); !r.Empty(); r.PopFront())
+    r.Front().SendQueuedEvents();
+}
+
+bool ParticleSystem::CanUpdateOnJobThread()
+{
+  // Anyone listening for spawned particles expects to be called as the
+  // particles are spawned
+  if (GetOwner()->HasReceivers(Events::ParticlesSpawned))
+    return false;
+
+  forRange (ParticleEmitter& emitter, mEmitters.All())
+  {
+    if (!emitter.CanEmitOnJobThread())
+      return false;
+  }
+
+  forRange (ParticleAnimator& animator, mAnimators.All())
+  {
+    if (!animator.CanAnimateOnJobThread())
+      return false;
+  }
+
+  for (ParticleSystemList::range r = mChildSystems.All(); !r.Empty(); r.PopFront())
+  {
+    if (!r.Front().CanUpdateOnJobThread())
+      return false;
+  }
+
+  return true;
 }
 
 uint ParticleSystem::BaseUpdate(float dt)
@@ -331,11 +381,11 @@ uint ParticleSystem::BaseUpdate(float dt)
 
   Mat4 worldTransform = Mat4::cIdentity;
   if (mSystemSpace == SystemSpace::WorldSpace)
-    worldTransform = mTransform->GetWorldMatrix();
+    worldTransform = mWorldMatrix;
 
   // Emit Particles
   int emitCount = 0;
-  Particle* oldFront = mParticleList.Particles;
+  uint oldCount = mParticleList.Size();
   for (EmitterList::range r = mEmitters.All(); !r.Empty(); r.PopFront())
     emitCount += EmitParticles(this, &r.Front(), &mParticleList, dt, worldTransform, mTimeAlive);
 
@@ -344,7 +394,7 @@ uint ParticleSystem::BaseUpdate(float dt)
   {
     ParticleEvent eventToSend;
     eventToSend.mNewParticleCount = (uint)emitCount;
-    eventToSend.mNewParticles = ParticleList::range(mParticleList.Particles, oldFront);
+    eventToSend.mNewParticles = ParticleListRange(this, oldCount, mParticleList.Size());
     GetOwner()->DispatchEvent(Events::ParticlesSpawned, &eventToSend);
   }
 
@@ -361,18 +411,17 @@ uint ParticleSystem::BaseUpdate(float dt)
 void ParticleSystem::ChildUpdate(float dt, ParticleList* parentList, uint parentEmitCount)
 {
   uint emitCount = 0;
-  Mat4 worldTransform = mTransform->GetWorldMatrix();
-
-  Particle* particle = parentList->Particles;
+  Mat4 worldTransform = mWorldMatrix;
 
-  while (particle != nullptr)
+  uint parentCount = parentList->Size();
+  for (uint i = 0; i < parentCount; ++i)
   {
-    SetTranslationOn(&worldTransform, particle->Position);
+    SetTranslationOn(&worldTransform, parentList->GetPosition(i));
 
+    Vec3 velocity = parentList->GetVelocity(i);
+    float time = parentList->mTime[i];
     for (EmitterList::range r = mEmitters.All(); !r.Empty(); r.PopFront())
-      emitCount += r.Front().EmitParticles(&mParticleList, dt, worldTransform, particle->Velocity, particle->Time);
-
-    particle = particle->Next;
+      emitCount += r.Front().EmitParticles(&mParticleList, dt, worldTransform, velocity, time);
   }
 
   for (AnimatorList::range r = mAnimators.All(); !r.Empty(); r.PopFront())
@@ -380,47 +429,23 @@ void ParticleSystem::ChildUpdate(float dt, ParticleList* parentList, uint parent
 
   for (ParticleSystemList::range r = mChildSystems.All(); !r.Empty(); r.PopFront())
     r.Front().ChildUpdate(dt, &mParticleList, emitCount);
-
-  mParticleList.ClearDestroyed();
 }
 
 void ParticleSystem::UpdateLifetimes(float dt)
 {
-  // Begin particle update pass removing dead particles
-  Particle* particle = mParticleList.Particles;
-  Particle** prev = &mParticleList.Particles;
+  uint count = mParticleList.Size();
+  float* time = mParticleList.mTime.Data();
 
-  while (particle != nullptr)
-  {
-    particle->Time += dt;
-
-    if (particle->Time >= particle->Lifetime)
-    {
-      // Particle is dead remove from active list
-      (*prev) = particle->Next;
-
-      Particle* deadParticle = particle;
-
-      // Move to next particle
-      particle = particle->Next;
-
-      mParticleList.DestroyParticle(deadParticle);
-
-      if (mParticleList.Particles == nullptr)
-      {
-        ObjectEvent event(this);
-        DispatchEvent(Events::AllParticlesDead, &event);
-      }
-    }
-    else
-    {
-      // Set the prev to this particle
-      prev = &particle->Next;
-
-      // Move to next particle.
-      particle = particle->Next;
-    }
-  }
+  // Age every particle
+  for (uint i = 0; i < count; ++i)
+    time[i] += dt;
+
+  // Remove dead particles (the remaining particles keep their draw order)
+  mParticleList.RemoveDeadParticles();
+
+  // This may be on a job thread, so the event is sent later
+  if (count != 0 && mParticleList.Empty())
+    mAllParticlesDeadQueued = true;
 
   for (ParticleSystemList::range r = mChildSystems.All(); !r.Empty(); r.PopFront())
     r.Front().UpdateLifetimes(dt);
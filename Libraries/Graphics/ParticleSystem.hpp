@@ -90,10 +90,21 @@ public:
 
   Link<ParticleSystem> SystemLink;
   typedef InList<ParticleSystem, &ParticleSystem::SystemLink> ParticleSystemList;
+  Link<ParticleSystem> UpdateLink;
+  typedef InList<ParticleSystem, &ParticleSystem::UpdateLink> UpdateList;
 
-  void OnUpdate(UpdateEvent* event);
-
+  // Updates this system and its child systems on the calling thread.
   void SystemUpdate(float dt);
+
+  // SystemUpdate split up so that systems can be updated on job threads.
+  // PrepareUpdate and SendQueuedEvents must be called on the main thread.
+  // UpdateParticles can be called on a job thread if CanUpdateOnJobThread
+  // returns true (nothing else may touch the system while it runs).
+  void PrepareUpdate();
+  void UpdateParticles(float dt);
+  void SendQueuedEvents();
+  bool CanUpdateOnJobThread();
+
   uint BaseUpdate(float dt);
   void ChildUpdate(float dt, ParticleList* parentList, uint emitCount);
   void UpdateLifetimes(float dt);
@@ -119,6 +130,14 @@ public:
   float mTimeAlive;
   // Flag for resetting particles when selection changes.
   bool mDebugDrawing;
+  // If the system is updated on FrameUpdate (previewing in the editor)
+  // instead of LogicUpdate.
+  bool mFrameUpdate;
+  // World matrix of the system, cached before updating because transforms
+  // can't be queried from job threads.
+  Mat4 mWorldMatrix;
+  // Set when the last particle dies, the event is sent after updating.
+  bool mAllParticlesDeadQueued;
 };
 
 } // namespace Zero
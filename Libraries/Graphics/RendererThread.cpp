@@ -84,7 +84,10 @@ void WaitRendererJob::WaitOnThisJob()
 
 void CreateRendererJob::Execute()
 {
-  Z::gRenderer = CreateRenderer(mMainWindowHandle, mError);
+  if (mEmptyRenderer)
+    Z::gRenderer = new EmptyRenderer();
+  else
+    Z::gRenderer = CreateRenderer(mMainWindowHandle, mError);
   mWaitEvent.Signal();
 }
 
@@ -87,6 +87,8 @@ public:
   void Execute() override;
 
   OsHandle mMainWindowHandle;
+  // Creates the EmptyRenderer instead of the platform's renderer.
+  bool mEmptyRenderer;
   String mError;
 };
 
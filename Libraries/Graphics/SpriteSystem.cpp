@@ -64,6 +64,48 @@ void SpriteParticleSystem::ExtractFrameData(FrameNode& frameNode, FrameBlock& fr
   frameNode.mBoneMatrixRange = IndexRange(0, 0);
 }
 
+// Vertices generated for each particle (a quad made of two triangles)
+static const uint cVerticesPerParticle = 6;
+// Minimum number of particles to generate vertices for on each job
+static const uint cParticleVertexChunkSize = 1024;
+
+// Generates the vertices of a range of particles
+struct SpriteParticleVertexGenerator
+{
+  SpriteParticleVertexGenerator(SpriteParticleSystem* system,
+                                ViewNode& viewNode,
+                                Array<uint>& sortedIndices,
+                                RenderQueues& renderQueues,
+                                SpriteSource* spriteSource,
+                                Vec3Param emitterPos) :
+      mSystem(system),
+      mViewNode(viewNode),
+      mSortedIndices(sortedIndices),
+      mRenderQueues(renderQueues),
+      mSpriteSource(spriteSource),
+      mEmitterPos(emitterPos)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    uint vertexStart = mViewNode.mStreamedVertexStart;
+    for (uint i = start; i < end; ++i)
+    {
+      uint index = mSortedIndices.Empty() ? i : mSortedIndices[i];
+      uint vertexIndex = vertexStart + i * cVerticesPerParticle;
+      mSystem->AddParticleVertices(mViewNode, mRenderQueues, mSpriteSource, index, vertexIndex, mEmitterPos);
+    }
+  }
+
+  SpriteParticleSystem* mSystem;
+  ViewNode& mViewNode;
+  Array<uint>& mSortedIndices;
+  RenderQueues& mRenderQueues;
+  SpriteSource* mSpriteSource;
+  Vec3 mEmitterPos;
+};
+
 void SpriteParticleSystem::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBlock, FrameBlock& frameBlock)
 {
   viewNode.mLocalToView = viewBlock.mWorldToView;
@@ -78,135 +120,150 @@ void SpriteParticleSystem::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBl
   Vec3 emitterPos = mTransform->GetWorldTranslation();
 
   CheckSort(viewBlock);
-  Particle* particle = mParticleList.Particles;
 
-  while (particle != nullptr)
-  {
-    float particleWidth = particle->Size * 0.5f;
+  // Allocate every particle's vertices up front so that they can be generated
+  // in parallel, each particle writing to its own vertices
+  StreamedVertexArray& vertices = frameBlock.mRenderQueues->mStreamedVertices;
+  uint count = mParticleList.Size();
+  vertices.Resize(vertices.Size() + count * cVerticesPerParticle);
+  viewNode.mStreamedVertexCount = count * cVerticesPerParticle;
+
+  RenderQueues& renderQueues = *frameBlock.mRenderQueues;
+  SpriteParticleVertexGenerator generator(this, viewNode, mSortedIndices, renderQueues, mSpriteSource, emitterPos);
+  if (Z::gJobs != nullptr && count > cParticleVertexChunkSize)
+    Z::gJobs->ParallelFor(0, count, generator, cParticleVertexChunkSize);
+  else
+    generator(0, count);
+}
 
-    Vec3 center, right, up;
+void SpriteParticleSystem::AddParticleVertices(ViewNode& viewNode,
+                                               RenderQueues& renderQueues,
+                                               SpriteSource* spriteSource,
+                                               uint index,
+                                               uint vertexIndex,
+                                               Vec3Param emitterPos)
+{
+  float size = mParticleList.mSize[index];
+  float rotation = mParticleList.mRotation[index];
+  Vec3 position = mParticleList.GetPosition(index);
+  Vec3 velocity = mParticleList.GetVelocity(index);
 
-    switch (mGeometryMode)
-    {
-    case SpriteParticleGeometryMode::Billboarded:
-    {
-      float cosAngle = Math::Cos(particle->Rotation);
-      float sinAngle = Math::Sin(particle->Rotation);
+  float particleWidth = size * 0.5f;
 
-      center = Math::TransformPoint(viewNode.mLocalToView, particle->Position);
-      right = Vec3(cosAngle, sinAngle, 0) * particleWidth;
-      up = Vec3(-sinAngle, cosAngle, 0) * particleWidth;
-    }
-    break;
+  Vec3 center, right, up;
 
-    case SpriteParticleGeometryMode::Beam:
-    {
-      Vec3 velocityDir = Math::TransformNormal(viewNode.mLocalToView, particle->Velocity);
-      float speed = velocityDir.AttemptNormalize();
+  switch (mGeometryMode)
+  {
+  case SpriteParticleGeometryMode::Billboarded:
+  {
+    float cosAngle = Math::Cos(rotation);
+    float sinAngle = Math::Sin(rotation);
 
-      center = Math::TransformPoint(viewNode.mLocalToView, particle->Position);
-      right = velocityDir * (speed * mBeamVelocityScale + mBeamBaseScale) * particleWidth;
-      up = Cross(Vec3(0, 0, 1), velocityDir) * particleWidth;
-    }
-    break;
+    center = Math::TransformPoint(viewNode.mLocalToView, position);
+    right = Vec3(cosAngle, sinAngle, 0) * particleWidth;
+    up = Vec3(-sinAngle, cosAngle, 0) * particleWidth;
+  }
+  break;
 
-    case SpriteParticleGeometryMode::Outward:
-    {
-      Vec3 zAxis = particle->Position - emitterPos;
-      zAxis.AttemptNormalize();
-
-      Vec3 xAxis, yAxis;
-      Math::GenerateOrthonormalBasis(zAxis, &xAxis, &yAxis);
-
-      xAxis = Math::TransformNormal(viewNode.mLocalToView, xAxis);
-      xAxis.AttemptNormalize();
-      yAxis = Math::TransformNormal(viewNode.mLocalToView, yAxis);
-      yAxis.AttemptNormalize();
-      zAxis = Math::TransformNormal(viewNode.mLocalToView, zAxis);
-      zAxis.AttemptNormalize();
-
-      center = Math::TransformPoint(viewNode.mLocalToView, particle->Position);
-      right = (xAxis * Math::Cos(particle->Rotation) + yAxis * Math::Sin(particle->Rotation));
-      up = Cross(zAxis, right) * particleWidth;
-      right *= particleWidth;
-    }
-    break;
+  case SpriteParticleGeometryMode::Beam:
+  {
+    Vec3 velocityDir = Math::TransformNormal(viewNode.mLocalToView, velocity);
+    float speed = velocityDir.AttemptNormalize();
 
-    case SpriteParticleGeometryMode::FaceVelocity:
-    {
-      Vec3 zAxis = particle->Velocity;
-      zAxis.AttemptNormalize();
-
-      Vec3 xAxis, yAxis;
-      Math::GenerateOrthonormalBasis(zAxis, &xAxis, &yAxis);
-
-      xAxis = Math::TransformNormal(viewNode.mLocalToView, xAxis);
-      xAxis.AttemptNormalize();
-      yAxis = Math::TransformNormal(viewNode.mLocalToView, yAxis);
-      yAxis.AttemptNormalize();
-      zAxis = Math::TransformNormal(viewNode.mLocalToView, zAxis);
-      zAxis.AttemptNormalize();
-
-      center = Math::TransformPoint(viewNode.mLocalToView, particle->Position);
-      right = (xAxis * Math::Cos(particle->Rotation) + yAxis * Math::Sin(particle->Rotation));
-      up = Cross(zAxis, right) * particleWidth;
-      right *= particleWidth;
-    }
-    break;
+    center = Math::TransformPoint(viewNode.mLocalToView, position);
+    right = velocityDir * (speed * mBeamVelocityScale + mBeamBaseScale) * particleWidth;
+    up = Cross(Vec3(0, 0, 1), velocityDir) * particleWidth;
+  }
+  break;
 
-    case SpriteParticleGeometryMode::Flat:
-    {
-      Vec3 facing = Math::TransformNormal(viewNode.mLocalToView, Vec3::cZAxis);
-      facing.AttemptNormalize();
-      Vec3 xAxis = Math::TransformNormal(viewNode.mLocalToView, Vec3::cXAxis);
-      xAxis.AttemptNormalize();
-      Vec3 yAxis = Math::TransformNormal(viewNode.mLocalToView, Vec3::cYAxis);
-      yAxis.AttemptNormalize();
-
-      center = Math::TransformPoint(viewNode.mLocalToView, particle->Position);
-      right = (xAxis * Math::Cos(particle->Rotation) + yAxis * Math::Sin(particle->Rotation));
-      up = Cross(facing, right) * particleWidth;
-      right *= particleWidth;
-    }
-    break;
-    }
+  case SpriteParticleGeometryMode::Outward:
+  {
+    Vec3 zAxis = position - emitterPos;
+    zAxis.AttemptNormalize();
+
+    Vec3 xAxis, yAxis;
+    Math::GenerateOrthonormalBasis(zAxis, &xAxis, &yAxis);
+
+    xAxis = Math::TransformNormal(viewNode.mLocalToView, xAxis);
+    xAxis.AttemptNormalize();
+    yAxis = Math::TransformNormal(viewNode.mLocalToView, yAxis);
+    yAxis.AttemptNormalize();
+    zAxis = Math::TransformNormal(viewNode.mLocalToView, zAxis);
+    zAxis.AttemptNormalize();
+
+    center = Math::TransformPoint(viewNode.mLocalToView, position);
+    right = (xAxis * Math::Cos(rotation) + yAxis * Math::Sin(rotation));
+    up = Cross(zAxis, right) * particleWidth;
+    right *= particleWidth;
+  }
+  break;
 
-    Vec3 pos[4] = {
-        center - right + up,
-        center - right - up,
-        center + right - up,
-        center + right + up,
-    };
+  case SpriteParticleGeometryMode::FaceVelocity:
+  {
+    Vec3 zAxis = velocity;
+    zAxis.AttemptNormalize();
+
+    Vec3 xAxis, yAxis;
+    Math::GenerateOrthonormalBasis(zAxis, &xAxis, &yAxis);
+
+    xAxis = Math::TransformNormal(viewNode.mLocalToView, xAxis);
+    xAxis.AttemptNormalize();
+    yAxis = Math::TransformNormal(viewNode.mLocalToView, yAxis);
+    yAxis.AttemptNormalize();
+    zAxis = Math::TransformNormal(viewNode.mLocalToView, zAxis);
+    zAxis.AttemptNormalize();
+
+    center = Math::TransformPoint(viewNode.mLocalToView, position);
+    right = (xAxis * Math::Cos(rotation) + yAxis * Math::Sin(rotation));
+    up = Cross(zAxis, right) * particleWidth;
+    right *= particleWidth;
+  }
+  break;
 
-    // Compute particle Uv Rect based on animation
-    UvRect uvRect = mSpriteSource->GetUvRect(0);
-    if (mSpriteSource->FrameCount > 1)
-    {
-      // Update particle frame
-      uint frame;
-      if (mParticleAnimation == SpriteParticleAnimationMode::Single)
-        frame = (uint)(particle->Time / particle->Lifetime * (float)mSpriteSource->FrameCount);
-      else
-        frame = (uint)(particle->Time / mSpriteSource->FrameDelay) % mSpriteSource->FrameCount;
-      uvRect = mSpriteSource->GetUvRect(frame);
-    }
+  case SpriteParticleGeometryMode::Flat:
+  {
+    Vec3 facing = Math::TransformNormal(viewNode.mLocalToView, Vec3::cZAxis);
+    facing.AttemptNormalize();
+    Vec3 xAxis = Math::TransformNormal(viewNode.mLocalToView, Vec3::cXAxis);
+    xAxis.AttemptNormalize();
+    Vec3 yAxis = Math::TransformNormal(viewNode.mLocalToView, Vec3::cYAxis);
+    yAxis.AttemptNormalize();
+
+    center = Math::TransformPoint(viewNode.mLocalToView, position);
+    right = (xAxis * Math::Cos(rotation) + yAxis * Math::Sin(rotation));
+    up = Cross(facing, right) * particleWidth;
+    right *= particleWidth;
+  }
+  break;
+  }
 
-    Vec2 uv0 = uvRect.TopLeft;
-    Vec2 uv1 = uvRect.BotRight;
+  Vec3 pos[4] = {
+      center - right + up,
+      center - right - up,
+      center + right - up,
+      center + right + up,
+  };
 
-    Vec4 color = particle->Color * mVertexColor;
+  // Compute particle Uv Rect based on animation
+  UvRect uvRect = spriteSource->GetUvRect(0);
+  if (spriteSource->FrameCount > 1)
+  {
+    // Update particle frame
+    uint frame;
+    if (mParticleAnimation == SpriteParticleAnimationMode::Single)
+      frame = (uint)(mParticleList.mTime[index] / mParticleList.mLifetime[index] * (float)spriteSource->FrameCount);
+    else
+      frame = (uint)(mParticleList.mTime[index] / spriteSource->FrameDelay) % spriteSource->FrameCount;
+    uvRect = spriteSource->GetUvRect(frame);
+  }
 
-    frameBlock.mRenderQueues->AddStreamedQuadView(viewNode, pos, uv0, uv1, color);
+  Vec2 uv0 = uvRect.TopLeft;
+  Vec2 uv1 = uvRect.BotRight;
 
-    particle = particle->Next;
-  }
-}
+  Vec4 color = mParticleList.mColor[index] * mVertexColor;
 
-struct ParticleSortInfo
-{
-  Particle* mParticle;
-  u32 mSortValue;
-};
+  renderQueues.SetStreamedQuadView(vertexIndex, pos, uv0, uv1, color);
+}
 
 struct LocalSpriteSorter
 {
@@ -260,17 +317,17 @@ u32 GetParticleSortValue(SpriteParticleSortMode::Enum sortMode, Vec3 pos, Vec3 c
 
 void SpriteParticleSystem::CheckSort(ViewBlock& viewBlock)
 {
-  Particle* particle = mParticleList.Particles;
+  uint count = mParticleList.Size();
+  mSortedIndices.Clear();
 
   // As long as we're in sort mode, and we have particles to be sorted...
-  if (mParticleSort == SpriteParticleSortMode::None || particle == nullptr)
+  if (mParticleSort == SpriteParticleSortMode::None || count == 0)
     return;
 
-  // An array to store all sorted particles
-  Array<ParticleSortInfo> sortedParticles;
-
-  // Reserve space in the sorted particle array
-  sortedParticles.Reserve(mParticleList.mActiveParticles);
+  // Reuse the sort info from previous frames
+  Array<ParticleSortInfo>& sortedParticles = mSortInfos;
+  sortedParticles.Clear();
+  sortedParticles.Reserve(count);
 
   // Particle info for the sorter
   ParticleSortInfo particleInfo;
@@ -279,39 +336,25 @@ void SpriteParticleSystem::CheckSort(ViewBlock& viewBlock)
   Vec3 cameraDir = viewBlock.mEyeDirection;
 
   // Loop through all the particles
-  while (particle != nullptr)
+  for (uint i = 0; i < count; ++i)
   {
     // Fill in the particle info and push it back
-    particleInfo.mParticle = particle;
-    particleInfo.mSortValue = GetParticleSortValue(mParticleSort, particle->Position, cameraPos, cameraDir);
+    particleInfo.mIndex = i;
+    particleInfo.mSortValue =
+        GetParticleSortValue(mParticleSort, mParticleList.GetPosition(i), cameraPos, cameraDir);
 
     // Push them into the array
     sortedParticles.PushBack(particleInfo);
-
-    // Iterate to the next particle
-    particle = particle->Next;
   }
 
   // Sort the array
   Sort(sortedParticles.All(), LocalSpriteSorter());
 
-  // Loop through all the sorted particles
-  for (size_t i = 0; i < (sortedParticles.Size() - 1); ++i)
-  {
-    // Re-point the particle's next pointer
-    sortedParticles[i].mParticle->Next = sortedParticles[i + 1].mParticle;
-  }
-
-  // Make sure we set the last particle in the array to point at null for its
-  // "next" pointer
-  sortedParticles.Back().mParticle->Next = nullptr;
-
-  // The particle list is now pointing to the front of our array
-  particle = sortedParticles.Front().mParticle;
-
-  // Since we resorted the list and actually modified the particles, we need to
-  // make sure we set the new head of the list
-  mParticleList.Particles = particle;
+  // The particles themselves are left where they are (they're stored in
+  // contiguous arrays), the view just draws them in the sorted order
+  mSortedIndices.Resize(count);
+  for (uint i = 0; i < count; ++i)
+    mSortedIndices[i] = sortedParticles[i].mIndex;
 }
 
 } // namespace Zero
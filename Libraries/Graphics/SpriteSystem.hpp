@@ -19,6 +19,13 @@ DeclareEnum9(SpriteParticleSortMode,
              PositiveToNegativeZ);
 DeclareEnum2(SpriteParticleAnimationMode, Single, Looping);
 
+/// The sort value of a particle, used to find the order particles are drawn in.
+struct ParticleSortInfo
+{
+  uint mIndex;
+  u32 mSortValue;
+};
+
 /// A particle system that uses sprites to represent each particle.
 class SpriteParticleSystem : public ParticleSystem
 {
@@ -63,7 +70,23 @@ public:
 
   // Internal
 
+  // Generates the vertices of a single particle, starting at the given vertex
+  // (called from job threads).
+  void AddParticleVertices(ViewNode& viewNode,
+                           RenderQueues& renderQueues,
+                           SpriteSource* spriteSource,
+                           uint index,
+                           uint vertexIndex,
+                           Vec3Param emitterPos);
+
+  // Fills out mSortedIndices with the particle indices in the order they
+  // should be drawn (left empty if the particles don't need sorting).
   void CheckSort(ViewBlock& viewBlock);
+
+  // Sorting scratch space kept between frames so sorting doesn't allocate
+  // (views are extracted one at a time on the main thread).
+  Array<ParticleSortInfo> mSortInfos;
+  Array<uint> mSortedIndices;
 };
 
 } // namespace Zero
@@ -127,4 +127,9 @@ String ZeroZilchShaderGlslBackend::GetErrorLog()
   return mErrorLog;
 }
 
+String ZeroZilchShaderGlslBackend::GetCacheDescription()
+{
+  return String::Format("ZeroZilchShaderGlslBackend:%d:%d", mTargetVersion, (int)mTargetGlslEs);
+}
+
 } // namespace Zero
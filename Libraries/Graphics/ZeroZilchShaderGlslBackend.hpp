@@ -14,6 +14,7 @@ public:
   String GetExtension() override;
   bool RunTranslationPass(ShaderTranslationPassResult& inputData, ShaderTranslationPassResult& outputData) override;
   String GetErrorLog() override;
+  String GetCacheDescription() override;
 
   int mTargetVersion;
   bool mTargetGlslEs;
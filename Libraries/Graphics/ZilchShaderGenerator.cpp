@@ -5,6 +5,60 @@
 namespace Zero
 {
 
+// Changing this invalidates every cached shader (bump it if the translation
+// changes in a way the build version doesn't capture or the layout changes)
+static const uint cShaderCacheVersion = 3;
+
+// Appends the length before the data so that adjacent values can't be confused
+static void AppendHashField(Zilch::Sha1Builder& sha1, StringParam value)
+{
+  sha1.Append(String::Format("%u:", (uint)value.SizeInBytes()));
+  sha1.Append(value);
+}
+
+// Runs the spir-v passes and the backend for a range of translated shader
+// entries on a job thread. The passes and backend keep state while running, so
+// every range gets its own pipeline.
+struct ShaderPipelineCompiler
+{
+  ShaderPipelineCompiler(ZilchShaderGenerator& generator,
+                         ZilchShaderIRLibrary* shaderLibrary,
+                         Array<ShaderEntry>& shaderEntries,
+                         Array<size_t>& entryIndices,
+                         Array<String>& cacheKeys,
+                         Array<bool>& results) :
+      mGenerator(generator),
+      mShaderLibrary(shaderLibrary),
+      mShaderEntries(shaderEntries),
+      mEntryIndices(entryIndices),
+      mCacheKeys(cacheKeys),
+      mResults(results)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    ShaderPipelineDescription pipeline;
+    mGenerator.CreatePipeline(pipeline);
+
+    for (uint i = start; i < end; ++i)
+    {
+      ShaderEntry& entry = mShaderEntries[mEntryIndices[i]];
+      mResults[i] = mGenerator.CompileShaderEntry(mShaderLibrary, pipeline, entry);
+
+      if (mResults[i] && !mCacheKeys[i].Empty())
+        mGenerator.StoreCachedShader(mCacheKeys[i], entry);
+    }
+  }
+
+  ZilchShaderGenerator& mGenerator;
+  ZilchShaderIRLibrary* mShaderLibrary;
+  Array<ShaderEntry>& mShaderEntries;
+  Array<size_t>& mEntryIndices;
+  Array<String>& mCacheKeys;
+  Array<bool>& mResults;
+};
+
 ZilchShaderGenerator* CreateZilchShaderGenerator()
 {
   ZilchShaderGenerator* shaderGenerator = new ZilchShaderGenerator();
@@ -393,6 +447,11 @@ LibraryRef ZilchShaderGenerator::BuildFragmentsLibrary(Module& dependencies,
   mFragmentsProject.Clear();
   mFragmentsProject.mProjectName = libraryName;
 
+  // Hash of everything the library is built from, used to key cached shaders
+  Zilch::Sha1Builder sourceHash;
+  AppendHashField(sourceHash, libraryName);
+  bool cacheable = true;
+
   // Add all fragments
   forRange (Resource* resource, fragments.All())
   {
@@ -404,6 +463,8 @@ LibraryRef ZilchShaderGenerator::BuildFragmentsLibrary(Module& dependencies,
 
     ZilchFragment* fragment = (ZilchFragment*)resource;
     mFragmentsProject.AddCodeFromString(fragment->mText, fragment->GetOrigin(), resource);
+    AppendHashField(sourceHash, fragment->GetOrigin());
+    AppendHashField(sourceHash, fragment->mText);
   }
 
   // Internal dependencies used to build the internal library
@@ -418,6 +479,12 @@ LibraryRef ZilchShaderGenerator::BuildFragmentsLibrary(Module& dependencies,
   {
     ZilchShaderIRLibraryRef internalDependency = GetInternalLibrary(dependentLibrary);
     internalDependencies->Append(internalDependency);
+
+    String* dependencyHash = mLibrarySourceHashes.FindPointer(internalDependency);
+    if (dependencyHash != nullptr)
+      AppendHashField(sourceHash, *dependencyHash);
+    else
+      cacheable = false;
   }
 
   ZilchShaderIRLibraryRef fragmentsLibrary =
@@ -425,6 +492,9 @@ LibraryRef ZilchShaderGenerator::BuildFragmentsLibrary(Module& dependencies,
   if (fragmentsLibrary == nullptr)
     return nullptr;
 
+  if (cacheable)
+    mLibrarySourceHashes[fragmentsLibrary] = sourceHash.OutputHashString();
+
   // Write to the complex user data of each shader type the name of the resource
   // they came from. This has to be done as a second pass because complex user
   // currently can't be written per file (we also need per type).
@@ -511,6 +581,16 @@ bool ZilchShaderGenerator::Commit(ZilchCompileEvent* e)
   // Clear after assert so it's not repeated or leaked.
   mPendingToPendingInternal.Clear();
 
+  // Forget the source hashes of libraries that are no longer used
+  HashMap<ZilchShaderIRLibrary*, String> usedSourceHashes;
+  forRange (ZilchShaderIRLibraryRef internalLibrary, mCurrentToInternal.Values())
+  {
+    String* sourceHash = mLibrarySourceHashes.FindPointer(internalLibrary);
+    if (sourceHash != nullptr)
+      usedSourceHashes.Insert(internalLibrary, *sourceHash);
+  }
+  mLibrarySourceHashes = usedSourceHashes;
+
   MapFragmentTypes();
 
   return true;
@@ -564,26 +644,21 @@ bool ZilchShaderGenerator::BuildShaders(ShaderSet& shaders,
                                         Array<ShaderEntry>& shaderEntries,
                                         Array<ShaderDefinition>* compositeShaderDefs)
 {
-  // @Nate: Build a description of the pipeline tools to run.
-  // This could be cached and down the line should probably be
-  // split up to deal with multiple libraries and caching.
+  // Only used for the settings of the pipeline, each job makes its own
   ShaderPipelineDescription pipelineDescription;
-#if !defined(ZeroDebug)
-  pipelineDescription.mToolPasses.PushBack(new SpirVSpecializationConstantPass());
-  pipelineDescription.mToolPasses.PushBack(new SpirVOptimizerPass());
-#endif
-  ZeroZilchShaderGlslBackend* backend = new ZeroZilchShaderGlslBackend();
-  pipelineDescription.mBackend = backend;
-
-#ifdef WelderTargetOsEmscripten
-  backend->mTargetVersion = 300;
-  backend->mTargetGlslEs = true;
-#endif
+  CreatePipeline(pipelineDescription);
 
   ZilchShaderIRCompositor compositor;
 
   ZilchShaderIRLibraryRef fragmentsLibrary = GetCurrentInternalProjectLibrary();
 
+  // Everything shared by the cache keys of every shader
+  String cacheKeyPrefix;
+  String* librarySourceHash = mLibrarySourceHashes.FindPointer(fragmentsLibrary);
+  if (!mCachePath.Empty() && librarySourceHash != nullptr)
+    cacheKeyPrefix = GetShaderCacheKeyPrefix(pipelineDescription, *librarySourceHash);
+  size_t cachedShaderCount = 0;
+
   Array<Shader*> shaderArray;
   shaderArray.Append(shaders.All());
 
@@ -596,8 +671,10 @@ bool ZilchShaderGenerator::BuildShaders(ShaderSet& shaders,
   {
     ZilchShaderIRProject shaderProject("ShaderProject");
 
-    // All batches are added to this array, get start index for this batch.
-    size_t entryStartIndex = shaderEntries.Size();
+    // All batches are added to this array, the indices of the entries in this
+    // batch that weren't in the cache (and their cache keys) are kept.
+    Array<size_t> compileEntryIndices;
+    Array<String> compileCacheKeys;
 
     size_t endIndex = Math::Min(startIndex + compositeBatchCount, totalShaderCount);
     for (size_t i = startIndex; i < endIndex; ++i)
@@ -657,19 +734,37 @@ bool ZilchShaderGenerator::BuildShaders(ShaderSet& shaders,
       ZilchShaderIRCompositor::ShaderStageDescription& geometryInfo = shaderDef.mResults[FragmentType::Geometry];
       ZilchShaderIRCompositor::ShaderStageDescription& pixelInfo = shaderDef.mResults[FragmentType::Pixel];
 
+      shader->mSentToRenderer = true;
+
+      ShaderEntry entry(shader);
+      String cacheKey;
+      if (!cacheKeyPrefix.Empty())
+        cacheKey = GetShaderCacheKey(cacheKeyPrefix, shaderDef);
+
+      // Translated by a previous run?
+      if (!cacheKey.Empty() && LoadCachedShader(cacheKey, entry))
+      {
+        shaderEntries.PushBack(entry);
+        ++cachedShaderCount;
+        continue;
+      }
+
       shaderProject.AddCodeFromString(vertexInfo.mShaderCode, vertexInfo.mClassName, nullptr);
       shaderProject.AddCodeFromString(geometryInfo.mShaderCode, geometryInfo.mClassName, nullptr);
       shaderProject.AddCodeFromString(pixelInfo.mShaderCode, pixelInfo.mClassName, nullptr);
 
-      ShaderEntry entry(shader);
       entry.mVertexShader = vertexInfo.mClassName;
       entry.mGeometryShader = geometryInfo.mClassName;
       entry.mPixelShader = pixelInfo.mClassName;
+      compileEntryIndices.PushBack(shaderEntries.Size());
+      compileCacheKeys.PushBack(cacheKey);
       shaderEntries.PushBack(entry);
-
-      shader->mSentToRenderer = true;
     }
 
+    // Every shader in the batch was cached
+    if (compileEntryIndices.Empty())
+      continue;
+
     ZilchShaderIRModuleRef shaderDependencies = new ZilchShaderIRModule();
     shaderDependencies->PushBack(fragmentsLibrary);
 
@@ -683,36 +778,205 @@ bool ZilchShaderGenerator::BuildShaders(ShaderSet& shaders,
       return false;
     }
 
-    for (size_t i = entryStartIndex; i < shaderEntries.Size(); ++i)
+    // The translated library is only read from here on, so every shader's
+    // passes and backend can run at the same time
+    Array<bool> compileResults;
+    compileResults.Resize(compileEntryIndices.Size(), false);
+    ShaderPipelineCompiler pipelineCompiler(
+        *this, shaderLibrary, shaderEntries, compileEntryIndices, compileCacheKeys, compileResults);
+    if (Z::gJobs != nullptr)
+      Z::gJobs->ParallelFor(0, compileEntryIndices.Size(), pipelineCompiler);
+    else
+      pipelineCompiler(0, compileEntryIndices.Size());
+
+    forRange (bool success, compileResults.All())
     {
-      ShaderEntry& entry = shaderEntries[i];
+      if (!success)
+        return false;
+    }
+  }
 
-      ZilchShaderIRType* vertexShader = shaderLibrary->FindType(entry.mVertexShader);
-      ZilchShaderIRType* geometryShader = shaderLibrary->FindType(entry.mGeometryShader);
-      ZilchShaderIRType* pixelShader = shaderLibrary->FindType(entry.mPixelShader);
-      ErrorIf(vertexShader == nullptr || pixelShader == nullptr, "Invalid shader entry");
+  if (cachedShaderCount != 0)
+    ZPrint("Restored %u of %u shaders from the shader cache\n", (uint)cachedShaderCount, (uint)totalShaderCount);
 
-      bool success = true;
-      Array<TranslationPassResultRef> vertexPipelineResults;
-      success &= CompilePipeline(vertexShader, pipelineDescription, vertexPipelineResults);
+  return true;
+}
 
-      Array<TranslationPassResultRef> geometryPipelineResults;
-      if (geometryShader != nullptr)
-        success &= CompilePipeline(geometryShader, pipelineDescription, geometryPipelineResults);
+String ZilchShaderGenerator::GetShaderCacheKeyPrefix(ShaderPipelineDescription& pipeline,
+                                                     StringParam librarySourceHash)
+{
+  // The spir-v settings and the translator are set up in code, so the build
+  // version covers them
+  StringBuilder builder;
+  builder.AppendFormat("%u:%s:%s", cShaderCacheVersion, GetBuildVersionName().c_str(), librarySourceHash.c_str());
 
-      Array<TranslationPassResultRef> pixelPipelineResults;
-      success &= CompilePipeline(pixelShader, pipelineDescription, pixelPipelineResults);
+  // Every pass that runs (in order) and its settings
+  for (size_t i = 0; i < pipeline.mToolPasses.Size(); ++i)
+  {
+    String description = pipeline.mToolPasses[i]->GetCacheDescription();
+    if (description.Empty())
+      return String();
+    builder.AppendFormat(":%s", description.c_str());
+  }
 
-      if (!success)
-        return false;
+  String backendDescription = pipeline.mBackend->GetCacheDescription();
+  if (backendDescription.Empty())
+    return String();
+  builder.AppendFormat(":%s", backendDescription.c_str());
 
-      entry.mVertexShader = vertexPipelineResults.Back()->mByteStream.ToString();
-      if (geometryShader != nullptr)
-        entry.mGeometryShader = geometryPipelineResults.Back()->mByteStream.ToString();
-      entry.mPixelShader = pixelPipelineResults.Back()->mByteStream.ToString();
-    }
+  return builder.ToString();
+}
+
+String ZilchShaderGenerator::GetShaderCacheKey(StringParam keyPrefix, ShaderDefinition& shaderDef)
+{
+  Zilch::Sha1Builder sha1;
+  AppendHashField(sha1, keyPrefix);
+
+  // The composited code of each stage (it only references the fragments, their
+  // sources are covered by the prefix)
+  FragmentType::Enum stages[] = {FragmentType::Vertex, FragmentType::Geometry, FragmentType::Pixel};
+  for (size_t i = 0; i < 3; ++i)
+  {
+    ZilchShaderIRCompositor::ShaderStageDescription& stageInfo = shaderDef.mResults[stages[i]];
+    AppendHashField(sha1, stageInfo.mClassName);
+    AppendHashField(sha1, stageInfo.mShaderCode);
   }
 
+  return sha1.OutputHashString();
+}
+
+bool ZilchShaderGenerator::LoadCachedShader(StringParam key, ShaderEntry& entry)
+{
+  String cachedFile = GetCachedShaderFile(key);
+  if (!FileExists(cachedFile))
+    return false;
+
+  DataBlock block = ReadFileIntoDataBlock(cachedFile.c_str());
+  if (block.Data == nullptr)
+    return false;
+
+  // The translated code of each stage, prefixed by its size
+  String stageCode[3];
+  size_t offset = 0;
+  bool valid = true;
+  for (size_t i = 0; i < 3 && valid; ++i)
+  {
+    u32 size = 0;
+    valid = offset + sizeof(size) <= block.Size;
+    if (!valid)
+      break;
+    memcpy(&size, block.Data + offset, sizeof(size));
+    offset += sizeof(size);
+
+    valid = offset + size <= block.Size;
+    if (!valid)
+      break;
+    stageCode[i] = String((cstr)block.Data + offset, size);
+    offset += size;
+  }
+  valid = valid && offset == block.Size && !stageCode[0].Empty() && !stageCode[2].Empty();
+  zDeallocate(block.Data);
+
+  // A damaged (or empty) entry is removed so that it gets stored again
+  if (!valid)
+  {
+    DeleteFile(cachedFile);
+    return false;
+  }
+
+  // Mark the entry as recently used so trimming keeps it
+  SetFileToCurrentTime(cachedFile);
+
+  entry.mVertexShader = stageCode[0];
+  entry.mGeometryShader = stageCode[1];
+  entry.mPixelShader = stageCode[2];
+  return true;
+}
+
+void ZilchShaderGenerator::StoreCachedShader(StringParam key, ShaderEntry& entry)
+{
+  // Never cache a failed translation (every later run would load it)
+  if (entry.mVertexShader.Empty() || entry.mPixelShader.Empty())
+    return;
+
+  String cachedFile = GetCachedShaderFile(key);
+  if (FileExists(cachedFile))
+    return;
+
+  // The translated code of each stage, prefixed by its size
+  String* stageCode[] = {&entry.mVertexShader, &entry.mGeometryShader, &entry.mPixelShader};
+  size_t totalSize = 0;
+  for (size_t i = 0; i < 3; ++i)
+    totalSize += sizeof(u32) + stageCode[i]->SizeInBytes();
+
+  Array<byte> data;
+  data.Resize(totalSize);
+  size_t offset = 0;
+  for (size_t i = 0; i < 3; ++i)
+  {
+    u32 size = (u32)stageCode[i]->SizeInBytes();
+    memcpy(data.Data() + offset, &size, sizeof(size));
+    offset += sizeof(size);
+    memcpy(data.Data() + offset, stageCode[i]->Data(), size);
+    offset += size;
+  }
+
+  // Other processes sharing the cache never read a partially written entry
+  FileCache::StoreFile(cachedFile, data.Data(), data.Size());
+}
+
+String ZilchShaderGenerator::GetCachedShaderFile(StringParam key)
+{
+  return FileCache::GetEntryPath(mCachePath, key, ".shader");
+}
+
+ZeroZilchShaderGlslBackend* ZilchShaderGenerator::CreatePipeline(ShaderPipelineDescription& pipeline)
+{
+  // @Nate: Build a description of the pipeline tools to run.
+  // This could be cached and down the line should probably be
+  // split up to deal with multiple libraries and caching.
+#if !defined(ZeroDebug)
+  pipeline.mToolPasses.PushBack(new SpirVSpecializationConstantPass());
+  pipeline.mToolPasses.PushBack(new SpirVOptimizerPass());
+#endif
+  ZeroZilchShaderGlslBackend* backend = new ZeroZilchShaderGlslBackend();
+  pipeline.mBackend = backend;
+
+#ifdef WelderTargetOsEmscripten
+  backend->mTargetVersion = 300;
+  backend->mTargetGlslEs = true;
+#endif
+
+  return backend;
+}
+
+bool ZilchShaderGenerator::CompileShaderEntry(ZilchShaderIRLibrary* shaderLibrary,
+                                              ShaderPipelineDescription& pipeline,
+                                              ShaderEntry& entry)
+{
+  ZilchShaderIRType* vertexShader = shaderLibrary->FindType(entry.mVertexShader);
+  ZilchShaderIRType* geometryShader = shaderLibrary->FindType(entry.mGeometryShader);
+  ZilchShaderIRType* pixelShader = shaderLibrary->FindType(entry.mPixelShader);
+  ErrorIf(vertexShader == nullptr || pixelShader == nullptr, "Invalid shader entry");
+
+  bool success = true;
+  Array<TranslationPassResultRef> vertexPipelineResults;
+  success &= CompilePipeline(vertexShader, pipeline, vertexPipelineResults);
+
+  Array<TranslationPassResultRef> geometryPipelineResults;
+  if (geometryShader != nullptr)
+    success &= CompilePipeline(geometryShader, pipeline, geometryPipelineResults);
+
+  Array<TranslationPassResultRef> pixelPipelineResults;
+  success &= CompilePipeline(pixelShader, pipeline, pixelPipelineResults);
+
+  if (!success)
+    return false;
+
+  entry.mVertexShader = vertexPipelineResults.Back()->mByteStream.ToString();
+  if (geometryShader != nullptr)
+    entry.mGeometryShader = geometryPipelineResults.Back()->mByteStream.ToString();
+  entry.mPixelShader = pixelPipelineResults.Back()->mByteStream.ToString();
   return true;
 }
 
@@ -742,7 +1006,8 @@ bool ZilchShaderGenerator::CompilePipeline(ZilchShaderIRType* shaderType,
     ShaderTranslationPassResult* toolData = new ShaderTranslationPassResult();
     pipelineResults.PushBack(toolData);
 
-    translationPass->RunTranslationPass(*prevPassData, *toolData);
+    if (!translationPass->RunTranslationPass(*prevPassData, *toolData))
+      return false;
     ErrorIf(toolData->mByteStream.ByteCount() == 0, "No shader bytecode output");
   }
 
@@ -763,9 +1028,7 @@ bool ZilchShaderGenerator::CompilePipeline(ZilchShaderIRType* shaderType,
   // Run the final backend
   ShaderTranslationPassResult* backendResult = new ShaderTranslationPassResult();
   pipelineResults.PushBack(backendResult);
-  pipeline.mBackend->RunTranslationPass(*lastPassData, *backendResult);
-
-  return true;
+  return pipeline.mBackend->RunTranslationPass(*lastPassData, *backendResult);
 }
 
 ShaderInput ZilchShaderGenerator::CreateShaderInput(StringParam fragmentName,
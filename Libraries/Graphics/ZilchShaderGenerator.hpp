@@ -46,10 +46,26 @@ public:
                     HashMap<String, UniqueComposite>& composites,
                     Array<ShaderEntry>& shaderEntries,
                     Array<ShaderDefinition>* compositeShaderDefs = nullptr);
+  // Makes the passes and backend that translate shaders for the renderer.
+  ZeroZilchShaderGlslBackend* CreatePipeline(ShaderPipelineDescription& pipeline);
+  // Replaces the entry's shader names with the translated shaders (safe to call
+  // from job threads with separate pipelines).
+  bool CompileShaderEntry(ZilchShaderIRLibrary* shaderLibrary, ShaderPipelineDescription& pipeline, ShaderEntry& entry);
+  // Returns false if any tool pass or the backend fails.
   bool CompilePipeline(ZilchShaderIRType* shaderType,
                        ShaderPipelineDescription& pipeline,
                        Array<TranslationPassResultRef>& pipelineResults);
 
+  // Persistent cache of translated shaders. Entries are keyed on the hash of
+  // the fragment sources, the composited shader code and the translator setup
+  // so any change only invalidates the shaders it affects. The prefix is empty
+  // if any pass of the pipeline can't be cached.
+  String GetShaderCacheKeyPrefix(ShaderPipelineDescription& pipeline, StringParam librarySourceHash);
+  String GetShaderCacheKey(StringParam keyPrefix, ShaderDefinition& shaderDef);
+  bool LoadCachedShader(StringParam key, ShaderEntry& entry);
+  void StoreCachedShader(StringParam key, ShaderEntry& entry);
+  String GetCachedShaderFile(StringParam key);
+
   ShaderInput
   CreateShaderInput(StringParam fragmentName, StringParam inputName, ShaderInputType::Enum type, AnyParam value);
 
@@ -88,6 +104,12 @@ public:
   HashMap<Library*, ZilchFragmentTypeMap> mPendingFragmentTypes;
 
   HashMap<String, u32> mSamplerAttributeValues;
+
+  // Directory translated shaders are cached in across runs (empty if disabled).
+  String mCachePath;
+  // Hash of the fragment sources that each internal library (and all of its
+  // dependencies) was built from. Missing if the library can't be cached.
+  HashMap<ZilchShaderIRLibrary*, String> mLibrarySourceHashes;
 };
 
 } // namespace Zero
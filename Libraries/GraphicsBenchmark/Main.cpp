@@ -0,0 +1,91 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+void LoadGamePackages(StringParam projectFile, Cog* projectCog);
+
+/// Loads a project's packaged content without a main window, then runs the
+/// graphics frame benchmark on one of its levels and exits.
+class GraphicsBenchmarkStartup : public ZeroStartup
+{
+private:
+  Cog* mProjectCog = nullptr;
+  String mProjectFile;
+  String mLevelName;
+  uint mFrameCount = 300;
+
+  void UserInitializeConfig(Cog* configCog) override;
+  void UserInitialize() override;
+  void UserStartup() override;
+  void UserCreation() override;
+};
+
+void GraphicsBenchmarkStartup::UserInitializeConfig(Cog* configCog)
+{
+  HasOrAdd<ContentConfig>(configCog);
+}
+
+void GraphicsBenchmarkStartup::UserInitialize()
+{
+  mProjectFile = Environment::GetValue<String>("file");
+  mLevelName = Environment::GetValue<String>("level");
+  mFrameCount = Environment::GetValue<uint>("frames", mFrameCount);
+
+  if (mProjectFile.Empty() || mLevelName.Empty())
+  {
+    ZPrint("Usage: GraphicsBenchmark -file <Project.zeroproj> -level <LevelName> [-frames <count>] [-logStdOut]\n");
+    return Exit(1);
+  }
+
+  mProjectCog = Z::gFactory->Create(Z::gEngine->GetEngineSpace(), mProjectFile, 0, nullptr);
+  if (mProjectCog == nullptr)
+  {
+    ZPrint("GraphicsBenchmark: Failed to load project '%s'\n", mProjectFile.c_str());
+    return Exit(1);
+  }
+
+  // The project's packages are loaded instead of building its content, and
+  // graphics runs on the EmptyRenderer so no gpu is needed.
+  mLoadContent = false;
+  mCreateMainWindow = false;
+}
+
+void GraphicsBenchmarkStartup::UserStartup()
+{
+  LoadGamePackages(mProjectFile, mProjectCog);
+}
+
+void GraphicsBenchmarkStartup::UserCreation()
+{
+  ProjectSettings* project = mProjectCog->has(ProjectSettings);
+  ObjectStore::GetInstance()->SetStoreName(project->ProjectName);
+
+  // Make sure scripts in the project are compiled
+  ZilchManager::GetInstance()->TriggerCompileExternally();
+
+  Level* level = LevelManager::FindOrNull(mLevelName);
+  if (level == nullptr)
+  {
+    ZPrint("GraphicsBenchmark: Level '%s' was not found\n", mLevelName.c_str());
+    return Exit(1);
+  }
+
+  RunGraphicsFrameBenchmark(level, mFrameCount);
+
+  // Shut down after the next engine update
+  Z::gEngine->Terminate();
+}
+
+} // namespace Zero
+
+using namespace Zero;
+
+extern "C" int main(int argc, char* argv[])
+{
+  CommandLineToStringArray(gCommandLineArguments, argv, argc);
+  SetupApplication(1, 0, 0, 1, sWelderOrganization, sEditorGuid, sEditorName);
+
+  return (new GraphicsBenchmarkStartup())->Run();
+}
@@ -465,6 +465,7 @@ ZilchDefineType(NetChannelType, builder, type)
   ZilchBindGetterSetterProperty(ReliabilityMode);
   ZilchBindGetterSetterProperty(TransferMode);
   ZilchBindGetterSetterProperty(AccurateTimestampOnChange);
+  ZilchBindGetterSetterProperty(UseDeltaCompression);
 }
 
 NetChannelType::NetChannelType(const String& name) : ReplicaChannelType(name)
@@ -503,6 +504,7 @@ void NetChannelType::ResetConfig()
     SetReplicateOnOffline();
     SetSerializationMode();
     SetTransferMode();
+    SetUseDeltaCompression();
   }
 
   // Set runtime config options
@@ -533,6 +535,7 @@ void NetChannelType::SetConfig(NetChannelConfig* netChannelConfig)
     SetReplicateOnOffline(netChannelConfig->mReplicateOnOffline);
     SetSerializationMode(netChannelConfig->mSerializationMode);
     SetTransferMode(netChannelConfig->mTransferMode);
+    SetUseDeltaCompression(netChannelConfig->mUseDeltaCompression);
   }
 
   // Set runtime config options
@@ -819,6 +822,25 @@ bool NetChannelType::GetAccurateTimestampOnChange() const
   return ReplicaChannelType::GetAccurateTimestampOnChange();
 }
 
+void NetChannelType::SetUseDeltaCompression(bool useDeltaCompression)
+{
+  // Already valid?
+  if (ReplicaChannelType::IsValid())
+  {
+    // Unable to modify configuration
+    DoNotifyError("NetChannelType",
+                  "Unable to modify this NetChannelType configuration option "
+                  "at game runtime");
+    return;
+  }
+
+  ReplicaChannelType::SetUseDeltaCompression(useDeltaCompression);
+}
+bool NetChannelType::GetUseDeltaCompression() const
+{
+  return ReplicaChannelType::GetUseDeltaCompression();
+}
+
 //                              NetChannelConfig //
 
 ZilchDefineType(NetChannelConfig, builder, type)
@@ -852,6 +874,7 @@ ZilchDefineType(NetChannelConfig, builder, type)
   ZilchBindFieldProperty(mReliabilityMode);
   ZilchBindFieldProperty(mTransferMode);
   ZilchBindFieldProperty(mAccurateTimestampOnChange);
+  ZilchBindFieldProperty(mUseDeltaCompression);
 }
 
 void NetChannelConfig::Serialize(Serializer& stream)
@@ -876,6 +899,7 @@ void NetChannelConfig::Serialize(Serializer& stream)
   SerializeEnumNameDefault(ReliabilityMode, mReliabilityMode, ReliabilityMode::Reliable);
   SerializeEnumNameDefault(TransferMode, mTransferMode, TransferMode::Ordered);
   SerializeNameDefault(mAccurateTimestampOnChange, false);
+  SerializeNameDefault(mUseDeltaCompression, false);
 }
 
 //
@@ -294,6 +294,13 @@ public:
   /// object setting)
   void SetAccurateTimestampOnChange(bool accurateTimestampOnChange = false);
   bool GetAccurateTimestampOnChange() const;
+
+  /// Controls whether or not net channel changes are delta compressed against
+  /// the last change acknowledged by each peer. (Only used with net channels
+  /// that serialize all net properties in full and a non-ordered transfer
+  /// mode, late changes are discarded) (Cannot be modified at game runtime)
+  void SetUseDeltaCompression(bool useDeltaCompression = false);
+  bool GetUseDeltaCompression() const;
 };
 
 //                              NetChannelConfig //
@@ -429,6 +436,12 @@ public:
   /// belonging to a specific net object by enabling the corresponding net
   /// object setting)
   bool mAccurateTimestampOnChange;
+
+  /// Controls whether or not net channel changes are delta compressed against
+  /// the last change acknowledged by each peer. (Only used with net channels
+  /// that serialize all net properties in full and a non-ordered transfer
+  /// mode, late changes are discarded)
+  bool mUseDeltaCompression;
 };
 
 //                           NetChannelConfigManager //
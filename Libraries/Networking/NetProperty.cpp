@@ -164,6 +164,7 @@ void NetPropertyType::ResetConfig()
     SetSerializationMode();
     SetUseHalfFloats();
     SetUseQuantization();
+    SetUseSmallestThree();
     SetQuantizationRangeMin();
     SetQuantizationRangeMax();
     SetUseInterpolation();
@@ -224,6 +225,7 @@ void NetPropertyType::SetConfig(NetPropertyConfig* netPropertyConfig)
     SetSerializationMode(netPropertyConfig->mSerializationMode);
     SetUseHalfFloats(netPropertyConfig->mUseHalfFloats);
     SetUseQuantization(netPropertyConfig->mUseQuantization);
+    SetUseSmallestThree(netPropertyConfig->mUseSmallestThree && ourBasicNetType == BasicNetType::Quaternion);
     SetQuantizationRangeMin(quantizationRangeMin);
     SetQuantizationRangeMax(quantizationRangeMax);
     SetUseInterpolation(netPropertyConfig->mUseInterpolation);
@@ -439,6 +441,9 @@ ZilchDefineType(NetPropertyConfig, builder, type)
   ZilchBindGetterSetterProperty(UseQuantization)
       ->AddAttributeChainable(PropertyAttributes::cInvalidatesObject)
       ->Add(new PropertyFilterArithmeticTypes);
+  ZilchBindGetterSetterProperty(UseSmallestThree)
+      ->AddAttributeChainable(PropertyAttributes::cInvalidatesObject)
+      ->Add(new PropertyFilterQuaternion);
   BindVariantGetSetForArithmeticTypes(QuantizationRangeMin);
   BindVariantGetSetForArithmeticTypes(QuantizationRangeMax);
   ZilchBindGetterSetterProperty(UseInterpolation)->Add(new PropertyFilterArithmeticTypes);
@@ -460,6 +465,7 @@ NetPropertyConfig::NetPropertyConfig() :
     mSerializationMode(SerializationMode::All),
     mUseHalfFloats(false),
     mUseQuantization(false),
+    mUseSmallestThree(false),
     mQuantizationRangeMin(),
     mQuantizationRangeMax(),
     mUseInterpolation(false),
@@ -489,6 +495,7 @@ void NetPropertyConfig::Serialize(Serializer& stream)
   SerializeEnumNameDefault(SerializationMode, mSerializationMode, SerializationMode::All);
   SerializeNameDefault(mUseHalfFloats, false);
   SerializeNameDefault(mUseQuantization, false);
+  SerializeNameDefault(mUseSmallestThree, false);
   SerializeNameDefault(mQuantizationRangeMin, Variant(DefaultFloatQuantizationRangeMin));
   SerializeNameDefault(mQuantizationRangeMax, Variant(DefaultFloatQuantizationRangeMax));
   SerializeNameDefault(mUseInterpolation, false);
@@ -578,7 +585,10 @@ void NetPropertyConfig::SetUseHalfFloats(bool useHalfFloats)
 
   // Using half floats?
   if (mUseHalfFloats)
-    SetUseQuantization(false); // Disable quantization
+  {
+    SetUseQuantization(false);  // Disable quantization
+    SetUseSmallestThree(false); // Disable smallest three
+  }
 }
 bool NetPropertyConfig::GetUseHalfFloats() const
 {
@@ -594,6 +604,7 @@ void NetPropertyConfig::SetUseQuantization(bool useQuantization)
   {
     SetUseDeltaThreshold(true); // Enable delta threshold
     SetUseHalfFloats(false);    // Disable half floats
+    SetUseSmallestThree(false); // Disable smallest three
   }
 }
 bool NetPropertyConfig::GetUseQuantization() const
@@ -601,6 +612,22 @@ bool NetPropertyConfig::GetUseQuantization() const
   return mUseQuantization;
 }
 
+void NetPropertyConfig::SetUseSmallestThree(bool useSmallestThree)
+{
+  mUseSmallestThree = useSmallestThree;
+
+  // Using smallest three?
+  if (mUseSmallestThree)
+  {
+    SetUseHalfFloats(false);   // Disable half floats
+    SetUseQuantization(false); // Disable quantization
+  }
+}
+bool NetPropertyConfig::GetUseSmallestThree() const
+{
+  return mUseSmallestThree;
+}
+
 DefineVariantGetSetForArithmeticTypes(QuantizationRangeMin);
 
 DefineVariantGetSetForArithmeticTypes(QuantizationRangeMax);
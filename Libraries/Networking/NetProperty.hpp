@@ -166,6 +166,13 @@ public:
   void SetUseQuantization(bool useQuantization);
   bool GetUseQuantization() const;
 
+  /// Controls whether or not a quaternion net property is serialized using the
+  /// smallest three encoding (the largest component is omitted and the other
+  /// three are quantized, 32 bits in total). (Using smallest three is mutually
+  /// exclusive with using half floats and quantization)
+  void SetUseSmallestThree(bool useSmallestThree);
+  bool GetUseSmallestThree() const;
+
   /// Controls the minimum, inclusive value at which a net property's
   /// primitive-components may be quantized during serialization.
   DeclareVariantGetSetForArithmeticTypes(QuantizationRangeMin, (-1), int(-1));
@@ -252,6 +259,7 @@ public:
   SerializationMode::Enum mSerializationMode; ///< Serialization mode.
   bool mUseHalfFloats;                        ///< Use half floats?
   bool mUseQuantization;                      ///< Use quantization?
+  bool mUseSmallestThree;                     ///< Use smallest three?
   Variant mQuantizationRangeMin;              ///< Quantization range minimum.
   Variant mQuantizationRangeMax;              ///< Quantization range maximum.
   bool mUseInterpolation;                     ///< Use interpolation?
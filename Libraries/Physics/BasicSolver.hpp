@@ -39,7 +39,7 @@ public:
 
   void DrawJoints(uint debugFlags);
 
-private:
+protected:
   typedef InList<Joint, &Joint::SolverLink> JointList;
   typedef InList<Contact, &Contact::SolverLink> ContactList;
   typedef Array<ConstraintMolecule> MoleculeList;
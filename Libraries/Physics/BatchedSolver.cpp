@@ -0,0 +1,421 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+#if defined(ZeroSimdSse2)
+#  include "ConstraintFragmentsSse.hpp"
+#endif
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+/// How many of the open batches to check when placing a contact point. Bounds
+/// the cost of building the batches at the price of some partially full ones.
+const uint cMaxBatchSearchCount = 16;
+
+void SolveContactRow(ContactRowBatch& rows, ContactBatchVelocities& velocities)
+{
+  const uint width = cContactBatchWidth;
+
+  // compute JV (the lane loop is innermost so it can be vectorized)
+  real cDot[width] = {};
+  for (uint object = 0; object < 2; ++object)
+  {
+    for (uint axis = 0; axis < 3; ++axis)
+    {
+      for (uint lane = 0; lane < width; ++lane)
+      {
+        cDot[lane] += rows.mLinear[object][axis][lane] * velocities.mLinear[object][axis][lane];
+        cDot[lane] += rows.mAngular[object][axis][lane] * velocities.mAngular[object][axis][lane];
+      }
+    }
+  }
+
+  // same as ComputeLambda, but for every lane
+  real lambda[width];
+  for (uint lane = 0; lane < width; ++lane)
+  {
+    real oldImpulse = rows.mImpulse[lane];
+    real value = cDot[lane] + rows.mBias[lane] + rows.mGamma[lane] * oldImpulse;
+    real impulse = oldImpulse - rows.mMass[lane] * value;
+    impulse = Math::Clamp(impulse, rows.mMinImpulse[lane], rows.mMaxImpulse[lane]);
+    lambda[lane] = impulse - oldImpulse;
+    rows.mImpulse[lane] = impulse;
+  }
+
+  // apply the impulse
+  for (uint object = 0; object < 2; ++object)
+  {
+    for (uint axis = 0; axis < 3; ++axis)
+    {
+      for (uint lane = 0; lane < width; ++lane)
+      {
+        velocities.mLinear[object][axis][lane] += rows.mLinearImpulse[object][axis][lane] * lambda[lane];
+        velocities.mAngular[object][axis][lane] += rows.mAngularImpulse[object][axis][lane] * lambda[lane];
+      }
+    }
+  }
+}
+
+void ComputeContactBatchLimits(ContactPointBatch& batch)
+{
+  // the friction bounds depend on the current normal impulse
+  // (same as ComputeContactLimits)
+  ContactRowBatch& normal = batch.mRows[0];
+  for (uint lane = 0; lane < cContactBatchWidth; ++lane)
+  {
+    real frictionMax = batch.mFrictionRatio[lane] * normal.mImpulse[lane];
+    for (uint row = 1; row < 3; ++row)
+    {
+      batch.mRows[row].mMinImpulse[lane] = -frictionMax;
+      batch.mRows[row].mMaxImpulse[lane] = frictionMax;
+    }
+  }
+}
+
+void SolveContactBatch(ContactPointBatch& batch, ContactBatchVelocities& velocities)
+{
+  SolveContactRow(batch.mRows[0], velocities);
+  ComputeContactBatchLimits(batch);
+  SolveContactRow(batch.mRows[1], velocities);
+  SolveContactRow(batch.mRows[2], velocities);
+}
+
+#if defined(ZeroSimdSse2)
+void SolveContactBatchSse(ContactPointBatch& batch, ContactBatchVelocities& velocities)
+{
+  SolveContactRowSse(batch.mRows[0], velocities);
+  ComputeContactBatchLimitsSse(batch);
+  SolveContactRowSse(batch.mRows[1], velocities);
+  SolveContactRowSse(batch.mRows[2], velocities);
+}
+#endif
+
+void WarmStartContactBatch(ContactPointBatch& batch, ContactBatchVelocities& velocities)
+{
+  for (uint row = 0; row < 3; ++row)
+  {
+    ContactRowBatch& rows = batch.mRows[row];
+    for (uint object = 0; object < 2; ++object)
+    {
+      for (uint axis = 0; axis < 3; ++axis)
+      {
+        for (uint lane = 0; lane < cContactBatchWidth; ++lane)
+        {
+          velocities.mLinear[object][axis][lane] += rows.mLinearImpulse[object][axis][lane] * rows.mImpulse[lane];
+          velocities.mAngular[object][axis][lane] += rows.mAngularImpulse[object][axis][lane] * rows.mImpulse[lane];
+        }
+      }
+    }
+  }
+}
+
+BatchedSolver::BatchedSolver()
+{
+  mFirstOpenBatch = 0;
+
+#if defined(ZeroSimdSse2)
+  mSolveBatch = SolveContactBatchSse;
+#else
+  mSolveBatch = SolveContactBatch;
+#endif
+}
+
+BatchedSolver::~BatchedSolver()
+{
+  Clear();
+}
+
+void BatchedSolver::Solve(real dt)
+{
+  BatchedSolver::UpdateData();
+  BatchedSolver::WarmStart();
+  BasicSolver::SolveVelocities();
+  BatchedSolver::Commit();
+  BasicSolver::BatchEvents();
+}
+
+void BatchedSolver::Clear()
+{
+  BasicSolver::Clear();
+
+  mBodies.Clear();
+  mLinearVelocities.Clear();
+  mAngularVelocities.Clear();
+  mBodyIndices.Clear();
+  mBatches.Clear();
+  mFirstOpenBatch = 0;
+}
+
+void BatchedSolver::UpdateData()
+{
+  mMolecules.Resize(mConstraintCount);
+
+  MoleculeWalker molecules(mMolecules.Data(), sizeof(ConstraintMolecule), 0);
+  UpdateDataFragmentList(mJoints, molecules);
+
+  // the contacts' molecules start where the joints' end
+  MoleculeWalker contactMolecules = molecules;
+  UpdateDataFragmentList(mContacts, molecules);
+
+  BuildBatches(contactMolecules);
+}
+
+void BatchedSolver::WarmStart()
+{
+  if (mSolverConfig->mWarmStart == false)
+    return;
+
+  MoleculeWalker molecules(mMolecules.Data(), sizeof(ConstraintMolecule), 0);
+  WarmStartFragmentList(mJoints, molecules);
+
+  ReadBodyVelocities();
+  ContactBatchVelocities velocities;
+  for (uint i = 0; i < mBatches.Size(); ++i)
+  {
+    ContactPointBatch& batch = mBatches[i];
+    GatherVelocities(batch, velocities);
+    WarmStartContactBatch(batch, velocities);
+    ScatterVelocities(batch, velocities);
+  }
+  WriteBodyVelocities();
+}
+
+void BatchedSolver::IterateVelocities(uint iteration)
+{
+  MoleculeWalker molecules(mMolecules.Data(), sizeof(ConstraintMolecule), 0);
+  IterateVelocitiesFragmentList(mJoints, molecules, iteration);
+
+  // the joints write directly to the bodies so the contacts have to re-read
+  // the velocities every iteration
+  ReadBodyVelocities();
+  ContactBatchVelocities velocities;
+  for (uint i = 0; i < mBatches.Size(); ++i)
+  {
+    ContactPointBatch& batch = mBatches[i];
+    GatherVelocities(batch, velocities);
+    mSolveBatch(batch, velocities);
+    ScatterVelocities(batch, velocities);
+  }
+  WriteBodyVelocities();
+}
+
+void BatchedSolver::Commit()
+{
+  // copy the accumulated impulses back into the molecules
+  // so the contacts can cache them as normal
+  for (uint i = 0; i < mBatches.Size(); ++i)
+  {
+    ContactPointBatch& batch = mBatches[i];
+    for (uint lane = 0; lane < batch.mCount; ++lane)
+    {
+      ConstraintMolecule* molecules = batch.mMolecules[lane];
+      for (uint row = 0; row < 3; ++row)
+        molecules[row].mImpulse = batch.mRows[row].mImpulse[lane];
+    }
+  }
+
+  BasicSolver::Commit();
+}
+
+void BatchedSolver::BuildBatches(MoleculeWalker& molecules)
+{
+  mBodies.Clear();
+  mLinearVelocities.Clear();
+  mAngularVelocities.Clear();
+  mBodyIndices.Clear();
+  mBatches.Clear();
+  mFirstOpenBatch = 0;
+
+  // reserve the static body
+  BatchBody& staticBody = mBodies.PushBack();
+  staticBody.mBody = nullptr;
+  staticBody.mDynamic = false;
+
+  ContactList::range range = mContacts.All();
+  for (; !range.Empty(); range.PopFront())
+  {
+    Contact& contact = range.Front();
+    uint body0 = GetBodyIndex(contact.GetCollider(0)->GetActiveBody());
+    uint body1 = GetBodyIndex(contact.GetCollider(1)->GetActiveBody());
+
+    JointMass masses;
+    JointHelpers::GetMasses(contact.GetCollider(0), contact.GetCollider(1), masses);
+
+    uint contactCount = contact.GetContactCount();
+    real frictionRatio = contact.mManifold->DynamicFriction / contactCount;
+    for (uint i = 0; i < contactCount; ++i)
+    {
+      ContactPointBatch& batch = FindBatch(body0, body1);
+      AddContactPoint(batch, &molecules[0], frictionRatio, masses, body0, body1);
+      molecules += 3;
+    }
+  }
+
+  mLinearVelocities.Resize(mBodies.Size());
+  mAngularVelocities.Resize(mBodies.Size());
+}
+
+uint BatchedSolver::GetBodyIndex(RigidBody* body)
+{
+  if (body == nullptr)
+    return 0;
+
+  uint index = mBodyIndices.FindValue(body, 0);
+  if (index != 0)
+    return index;
+
+  index = mBodies.Size();
+  BatchBody& batchBody = mBodies.PushBack();
+  batchBody.mBody = body;
+  batchBody.mDynamic = body->IsDynamic();
+  mBodyIndices.Insert(body, index);
+  return index;
+}
+
+ContactPointBatch& BatchedSolver::FindBatch(uint body0, uint body1)
+{
+  // Only dynamic bodies conflict, everything else has no inverse mass
+  // so every lane writes back the same velocity it read.
+  bool dynamic0 = mBodies[body0].mDynamic;
+  bool dynamic1 = mBodies[body1].mDynamic;
+
+  uint searchEnd = Math::Min((uint)mBatches.Size(), mFirstOpenBatch + cMaxBatchSearchCount);
+  for (uint i = mFirstOpenBatch; i < searchEnd; ++i)
+  {
+    ContactPointBatch& batch = mBatches[i];
+    if (batch.mCount == cContactBatchWidth)
+      continue;
+
+    bool conflicts = false;
+    for (uint lane = 0; lane < batch.mCount && !conflicts; ++lane)
+    {
+      for (uint object = 0; object < 2; ++object)
+      {
+        uint laneBody = batch.mBodies[object][lane];
+        if ((dynamic0 && laneBody == body0) || (dynamic1 && laneBody == body1))
+          conflicts = true;
+      }
+    }
+
+    if (!conflicts)
+      return batch;
+  }
+
+  // Every lane starts out as a static pair with no mass so unused lanes
+  // don't change any velocities
+  ContactPointBatch& batch = mBatches.PushBack();
+  memset(&batch, 0, sizeof(ContactPointBatch));
+  return batch;
+}
+
+void BatchedSolver::AddContactPoint(ContactPointBatch& batch,
+                                    ConstraintMolecule* molecules,
+                                    real frictionRatio,
+                                    JointMass& masses,
+                                    uint body0,
+                                    uint body1)
+{
+  uint lane = batch.mCount;
+  ++batch.mCount;
+
+  batch.mBodies[0][lane] = body0;
+  batch.mBodies[1][lane] = body1;
+  batch.mFrictionRatio[lane] = frictionRatio;
+  batch.mMolecules[lane] = molecules;
+
+  for (uint row = 0; row < 3; ++row)
+  {
+    ConstraintMolecule& mol = molecules[row];
+    ContactRowBatch& rows = batch.mRows[row];
+
+    for (uint object = 0; object < 2; ++object)
+    {
+      Vec3 linearImpulse = masses.mInvMass[object].Apply(mol.mJacobian.Linear[object]);
+      Vec3 angularImpulse = Math::Transform(masses.InverseInertia[object], mol.mJacobian.Angular[object]);
+      for (uint axis = 0; axis < 3; ++axis)
+      {
+        rows.mLinear[object][axis][lane] = mol.mJacobian.Linear[object][axis];
+        rows.mAngular[object][axis][lane] = mol.mJacobian.Angular[object][axis];
+        rows.mLinearImpulse[object][axis][lane] = linearImpulse[axis];
+        rows.mAngularImpulse[object][axis][lane] = angularImpulse[axis];
+      }
+    }
+
+    rows.mMass[lane] = mol.mMass;
+    rows.mBias[lane] = mol.mBias;
+    rows.mGamma[lane] = mol.mGamma;
+    rows.mImpulse[lane] = mol.mImpulse;
+    rows.mMinImpulse[lane] = mol.mMinImpulse;
+    rows.mMaxImpulse[lane] = mol.mMaxImpulse;
+  }
+
+  // move past any batches that are now full
+  while (mFirstOpenBatch < mBatches.Size() && mBatches[mFirstOpenBatch].mCount == cContactBatchWidth)
+    ++mFirstOpenBatch;
+}
+
+void BatchedSolver::ReadBodyVelocities()
+{
+  mLinearVelocities[0].ZeroOut();
+  mAngularVelocities[0].ZeroOut();
+  for (uint i = 1; i < mBodies.Size(); ++i)
+  {
+    RigidBody* body = mBodies[i].mBody;
+    mLinearVelocities[i] = body->mVelocity;
+    mAngularVelocities[i] = body->mAngularVelocity;
+  }
+}
+
+void BatchedSolver::WriteBodyVelocities()
+{
+  for (uint i = 1; i < mBodies.Size(); ++i)
+  {
+    RigidBody* body = mBodies[i].mBody;
+    body->mVelocity = mLinearVelocities[i];
+    body->mAngularVelocity = mAngularVelocities[i];
+  }
+}
+
+void BatchedSolver::GatherVelocities(ContactPointBatch& batch, ContactBatchVelocities& velocities)
+{
+  for (uint object = 0; object < 2; ++object)
+  {
+    for (uint lane = 0; lane < cContactBatchWidth; ++lane)
+    {
+      uint body = batch.mBodies[object][lane];
+      Vec3& linear = mLinearVelocities[body];
+      Vec3& angular = mAngularVelocities[body];
+      for (uint axis = 0; axis < 3; ++axis)
+      {
+        velocities.mLinear[object][axis][lane] = linear[axis];
+        velocities.mAngular[object][axis][lane] = angular[axis];
+      }
+    }
+  }
+}
+
+void BatchedSolver::ScatterVelocities(ContactPointBatch& batch, ContactBatchVelocities& velocities)
+{
+  // Unused lanes write zero back into the static body (they have no mass)
+  for (uint object = 0; object < 2; ++object)
+  {
+    for (uint lane = 0; lane < cContactBatchWidth; ++lane)
+    {
+      uint body = batch.mBodies[object][lane];
+      Vec3& linear = mLinearVelocities[body];
+      Vec3& angular = mAngularVelocities[body];
+      for (uint axis = 0; axis < 3; ++axis)
+      {
+        linear[axis] = velocities.mLinear[object][axis][lane];
+        angular[axis] = velocities.mAngular[object][axis][lane];
+      }
+    }
+  }
+}
+
+} // namespace Physics
+
+} // namespace Zero
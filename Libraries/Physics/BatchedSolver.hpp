@@ -0,0 +1,115 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+namespace Physics
+{
+
+/// How many contact points the BatchedSolver solves at once.
+const uint cContactBatchWidth = 4;
+
+/// One row (normal or friction) of every contact point in a batch. Stored as
+/// a structure of arrays so that all of the lanes can be solved at once.
+struct ContactRowBatch
+{
+  /// The Jacobian of each lane, indexed by [object][axis][lane].
+  real mLinear[2][3][cContactBatchWidth];
+  real mAngular[2][3][cContactBatchWidth];
+  /// The inverse mass (or inertia) times the Jacobian. This is the change in
+  /// each object's velocity from one unit of impulse.
+  real mLinearImpulse[2][3][cContactBatchWidth];
+  real mAngularImpulse[2][3][cContactBatchWidth];
+
+  real mMass[cContactBatchWidth];
+  real mBias[cContactBatchWidth];
+  real mGamma[cContactBatchWidth];
+  real mImpulse[cContactBatchWidth];
+  real mMinImpulse[cContactBatchWidth];
+  real mMaxImpulse[cContactBatchWidth];
+};
+
+/// Up to cContactBatchWidth contact points where no two points write to the
+/// same dynamic body. Each point is a normal row followed by two friction rows.
+struct ContactPointBatch
+{
+  /// The index of each lane's objects into the solver's body array.
+  uint mBodies[2][cContactBatchWidth];
+  /// Scales the normal impulse into the friction limit of each lane.
+  real mFrictionRatio[cContactBatchWidth];
+  /// The normal molecule of each lane (the friction molecules follow it).
+  /// Unused lanes are null.
+  ConstraintMolecule* mMolecules[cContactBatchWidth];
+  uint mCount;
+
+  ContactRowBatch mRows[3];
+};
+
+/// The velocities of each lane's objects, indexed by [object][axis][lane].
+struct ContactBatchVelocities
+{
+  real mLinear[2][3][cContactBatchWidth];
+  real mAngular[2][3][cContactBatchWidth];
+};
+
+/// A BasicSolver that solves contacts several points at a time. Contact points
+/// are packed into batches that don't share a dynamic body so each row of a
+/// batch can be solved with one set of SSE instructions (on SSE2 targets, see
+/// ZeroSimdSse2). Joints are still solved one at a time by the BasicSolver.
+class BatchedSolver : public BasicSolver
+{
+public:
+  typedef void (*BatchSolveFunction)(ContactPointBatch& batch, ContactBatchVelocities& velocities);
+
+  BatchedSolver();
+  ~BatchedSolver();
+
+  void Solve(real dt) override;
+  void Clear() override;
+  void UpdateData() override;
+  void WarmStart() override;
+  void IterateVelocities(uint iteration) override;
+  void Commit() override;
+
+private:
+  /// A body written to by the batches. Index 0 is reserved for static
+  /// objects (no rigid body) which always have zero velocity.
+  struct BatchBody
+  {
+    RigidBody* mBody;
+    bool mDynamic;
+  };
+
+  void BuildBatches(MoleculeWalker& molecules);
+  uint GetBodyIndex(RigidBody* body);
+  ContactPointBatch& FindBatch(uint body0, uint body1);
+  void AddContactPoint(ContactPointBatch& batch, ConstraintMolecule* molecules, real frictionRatio,
+                       JointMass& masses, uint body0, uint body1);
+
+  /// Copies the velocities between the rigid bodies and the solver's arrays.
+  void ReadBodyVelocities();
+  void WriteBodyVelocities();
+  void GatherVelocities(ContactPointBatch& batch, ContactBatchVelocities& velocities);
+  void ScatterVelocities(ContactPointBatch& batch, ContactBatchVelocities& velocities);
+
+  Array<BatchBody> mBodies;
+  Array<Vec3> mLinearVelocities;
+  Array<Vec3> mAngularVelocities;
+  HashMap<RigidBody*, uint> mBodyIndices;
+
+  Array<ContactPointBatch> mBatches;
+  /// Every batch before this one is full (used to bound the batch search).
+  uint mFirstOpenBatch;
+
+  /// Solves one batch. The SSE kernel on SSE2 targets, SolveContactBatch
+  /// otherwise.
+  BatchSolveFunction mSolveBatch;
+};
+
+/// Solves every row of the batch one lane at a time (no SIMD required).
+void SolveContactBatch(ContactPointBatch& batch, ContactBatchVelocities& velocities);
+
+} // namespace Physics
+
+} // namespace Zero
@@ -104,6 +104,67 @@ SimInline void SolveConstraintSse(SimVecRef v0,
   w1 = Simd::MultiplyAdd(Simd::Transform(i1, A1), lambda, w1);
 }
 
+// Solves one row of every lane in a contact batch at once.
+// Each SimVec holds one value for all of the lanes (structure of arrays).
+SimInline void SolveContactRowSse(ContactRowBatch& rows, ContactBatchVelocities& velocities)
+{
+  SimVec cDot = Simd::ZeroOutVec();
+  for (uint object = 0; object < 2; ++object)
+  {
+    for (uint axis = 0; axis < 3; ++axis)
+    {
+      SimVec v = Simd::UnAlignedLoad(velocities.mLinear[object][axis]);
+      SimVec w = Simd::UnAlignedLoad(velocities.mAngular[object][axis]);
+      cDot = Simd::MultiplyAdd(Simd::UnAlignedLoad(rows.mLinear[object][axis]), v, cDot);
+      cDot = Simd::MultiplyAdd(Simd::UnAlignedLoad(rows.mAngular[object][axis]), w, cDot);
+    }
+  }
+
+  SimVec mass = Simd::UnAlignedLoad(rows.mMass);
+  SimVec bias = Simd::UnAlignedLoad(rows.mBias);
+  SimVec gamma = Simd::UnAlignedLoad(rows.mGamma);
+  SimVec impulse = Simd::UnAlignedLoad(rows.mImpulse);
+  SimVec minImpulse = Simd::UnAlignedLoad(rows.mMinImpulse);
+  SimVec maxImpulse = Simd::UnAlignedLoad(rows.mMaxImpulse);
+
+  cDot = Simd::Add(cDot, bias);
+  cDot = Simd::MultiplyAdd(gamma, impulse, cDot);
+  SimVec lambda = Simd::Negate(Simd::Multiply(mass, cDot));
+
+  SimVec oldImpulse = impulse;
+  impulse = Simd::Clamp(Simd::Add(oldImpulse, lambda), minImpulse, maxImpulse);
+  lambda = Simd::Subtract(impulse, oldImpulse);
+  Simd::UnAlignedStore(impulse, rows.mImpulse);
+
+  for (uint object = 0; object < 2; ++object)
+  {
+    for (uint axis = 0; axis < 3; ++axis)
+    {
+      real* v = velocities.mLinear[object][axis];
+      real* w = velocities.mAngular[object][axis];
+      SimVec linearImpulse = Simd::UnAlignedLoad(rows.mLinearImpulse[object][axis]);
+      SimVec angularImpulse = Simd::UnAlignedLoad(rows.mAngularImpulse[object][axis]);
+      Simd::UnAlignedStore(Simd::MultiplyAdd(linearImpulse, lambda, Simd::UnAlignedLoad(v)), v);
+      Simd::UnAlignedStore(Simd::MultiplyAdd(angularImpulse, lambda, Simd::UnAlignedLoad(w)), w);
+    }
+  }
+}
+
+// Updates the friction bounds of every lane from the normal impulse.
+SimInline void ComputeContactBatchLimitsSse(ContactPointBatch& batch)
+{
+  SimVec ratio = Simd::UnAlignedLoad(batch.mFrictionRatio);
+  SimVec normalImpulse = Simd::UnAlignedLoad(batch.mRows[0].mImpulse);
+  SimVec frictionMax = Simd::Multiply(ratio, normalImpulse);
+  SimVec frictionMin = Simd::Negate(frictionMax);
+
+  for (uint row = 1; row < 3; ++row)
+  {
+    Simd::UnAlignedStore(frictionMin, batch.mRows[row].mMinImpulse);
+    Simd::UnAlignedStore(frictionMax, batch.mRows[row].mMaxImpulse);
+  }
+}
+
 } // namespace Physics
 
 } // namespace Zero
@@ -36,6 +36,11 @@ public:
   /// called internally by physics, but is exposed for manual triggering.
   void ClearCachedEdgeAdjacency();
 
+  /// The edge adjacency cache is filled in lazily during the narrow phase which
+  /// can run on multiple threads. Anyone touching GetInfoMap() during the
+  /// narrow phase must hold this lock.
+  SpinLock mInfoMapLock;
+
   //-------------------------------------------------------------------Internal
 
   /// A range for returning the local-space triangles that need to have
@@ -12,8 +12,11 @@ size_t GetMaxSolverSize()
   size_t basicSolver = sizeof(BasicSolver);
   size_t normalSolver = sizeof(NormalSolver);
   size_t basicGenericSolver = sizeof(GenericBasicSolver);
+  size_t threadedSolver = sizeof(ThreadedSolver);
+  size_t batchedSolver = sizeof(BatchedSolver);
 
-  return Math::Max(basicSolver, Math::Max(normalSolver, basicGenericSolver));
+  size_t maxSize = Math::Max(basicSolver, Math::Max(normalSolver, basicGenericSolver));
+  return Math::Max(maxSize, Math::Max(threadedSolver, batchedSolver));
 }
 
 Memory::Pool* IConstraintSolver::sPool =
@@ -41,6 +44,14 @@ void IConstraintSolver::AddContacts(ContactList& contacts)
   }
 }
 
+void IConstraintSolver::SolveConstraints(real dt)
+{
+  UpdateData();
+  WarmStart();
+  SolveVelocities();
+  Commit();
+}
+
 uint IConstraintSolver::GetSolverIterationCount() const
 {
   return mSolverConfig->mSolverIterationCount;
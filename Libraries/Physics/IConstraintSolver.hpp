@@ -70,6 +70,10 @@ public:
   virtual void Commit(){};
   virtual void BatchEvents(){};
 
+  /// Runs every step of Solve except for BatchEvents. Batching events touches
+  /// the space, so this is what can safely be run for several solvers at once.
+  void SolveConstraints(real dt);
+
   /// Returns the number of iterations this solver should use (determined by the
   /// config).
   uint GetSolverIterationCount() const;
@@ -880,6 +880,11 @@ void CorrectInternalEdgeNormal(HeightMapCollider* collider,
   // didn't exist then there is nothing for us to do
   TriangleInfoMap* map = collider->GetInfoMap();
 
+  // Other threads may be adding to the map (invalidating any pointers into
+  // it) so copy the entry out while holding the lock.
+  MeshTriangleInfo info;
+  collider->mInfoMapLock.Lock();
+
   // If the map is too big then we risk crashing since the map is contiguous
   // memory. For now it's easiest to clear the map when we exceed some threshold
   // and let it gradually re-populate over time. This should only happen if lots
@@ -887,22 +892,27 @@ void CorrectInternalEdgeNormal(HeightMapCollider* collider,
   if (map->Size() > 100000)
     collider->ClearCachedEdgeAdjacency();
 
-  MeshTriangleInfo* info = map->FindPointer(contactId);
+  MeshTriangleInfo* cachedInfo = map->FindPointer(contactId);
   // If this entry didn't already exist then create it
-  if (info == nullptr)
+  if (cachedInfo == nullptr)
   {
     GenerateInternalEdgeInfoDynamic(collider, contactId);
-    info = map->FindPointer(contactId);
-    ReturnIf(info == nullptr,
-             ,
-             "Somehow creating an entry for a contact id didn't actually "
-             "create the entry");
+    cachedInfo = map->FindPointer(contactId);
   }
+  if (cachedInfo != nullptr)
+    info = *cachedInfo;
+
+  collider->mInfoMapLock.Unlock();
+
+  ReturnIf(cachedInfo == nullptr,
+           ,
+           "Somehow creating an entry for a contact id didn't actually "
+           "create the entry");
 
   // set up some info on our state struct for ease of passing around
   StateInfo stateInfo;
   stateInfo.mCollider = collider;
-  stateInfo.mInfo = info;
+  stateInfo.mInfo = &info;
   stateInfo.mTri = tri;
   stateInfo.mTriNormal = tri.GetNormal();
   stateInfo.mObjectIndex = objectIndex;
@@ -166,6 +166,17 @@ void Island::Solve(real dt, bool allowSleeping, uint debugFlags)
   UpdateSleep(dt, allowSleeping, debugFlags);
 }
 
+void Island::SolveConstraints(real dt)
+{
+  CommitConstraints();
+  mSolver->SolveConstraints(dt);
+}
+
+void Island::BatchEvents()
+{
+  mSolver->BatchEvents();
+}
+
 void Island::SolvePositions(real dt)
 {
   mSolver->SolvePositions();
@@ -38,6 +38,9 @@ public:
   void IntegratePosition(real dt);
   void CommitConstraints();
   void Solve(real dt, bool allowSleeping, uint debugFlags);
+  /// The part of Solve that only touches this island's objects (no events).
+  void SolveConstraints(real dt);
+  void BatchEvents();
   void SolvePositions(real dt);
   void UpdateSleep(real dt, bool allowSleeping, uint debugFlags);
   /// Helper function to mark everything as not on an island.
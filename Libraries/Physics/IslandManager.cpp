@@ -257,6 +257,35 @@ struct ConstraintCountPreProcessing
   }
 };
 
+/// How many constraints (contacts and joints) to try to put in one batch of
+/// islands when solving concurrently. Islands with at least this many
+/// constraints are solved on their own.
+const uint cIslandBatchConstraintCount = 128;
+
+/// Solves a range of island batches (everything but events and sleeping).
+struct IslandBatchSolveOperation
+{
+  IslandBatchSolveOperation(Array<Island*>& islands, Array<uint>& batchOffsets, real dt) :
+      mIslands(islands),
+      mBatchOffsets(batchOffsets),
+      mDt(dt)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    for (uint batch = start; batch < end; ++batch)
+    {
+      for (uint i = mBatchOffsets[batch]; i < mBatchOffsets[batch + 1]; ++i)
+        mIslands[i]->SolveConstraints(mDt);
+    }
+  }
+
+  Array<Island*>& mIslands;
+  Array<uint>& mBatchOffsets;
+  real mDt;
+};
+
 IslandManager::IslandManager(PhysicsSolverConfig* config)
 {
   mIslandCount = 0;
@@ -388,12 +417,132 @@ void IslandManager::Solve(real dt, bool allowSleeping, uint debugFlags)
     return;
   }
 
+  // Islands never share a body so they can be solved independently. Composite
+  // islands don't extend over kinematic objects though, so a kinematic object
+  // can be written to by more than one island.
+  if (Z::gJobs != nullptr && mIslandingType != PhysicsIslandType::Composites)
+  {
+    SolveConcurrently(dt, allowSleeping, debugFlags);
+    return;
+  }
+
   // solve all of the islands.
   IslandList::range islandRange = mIslands.All();
   for (; !islandRange.Empty(); islandRange.PopFront())
     islandRange.Front().Solve(dt, allowSleeping, debugFlags);
 }
 
+void IslandManager::SolveConcurrently(real dt, bool allowSleeping, uint debugFlags)
+{
+  BuildIslandBatches();
+
+  IslandBatchSolveOperation solveOperation(mSolveIslands, mIslandBatchOffsets, dt);
+  uint batchCount = mIslandBatchOffsets.Size() - 1;
+  Z::gJobs->ParallelFor(0, batchCount, solveOperation);
+
+  // These islands share bodies with other islands, so they can't be solved at
+  // the same time as anything else
+  forRange (Island* island, mSerialIslands.All())
+    island->SolveConstraints(dt);
+
+  // Sending events and putting objects to sleep isn't thread safe,
+  // so do it afterwards in the same order as the islands were built.
+  IslandList::range islandRange = mIslands.All();
+  for (; !islandRange.Empty(); islandRange.PopFront())
+  {
+    Island& island = islandRange.Front();
+    island.BatchEvents();
+    island.UpdateSleep(dt, allowSleeping, debugFlags);
+  }
+}
+
+void IslandManager::BuildIslandBatches()
+{
+  mSolveIslands.Clear();
+  mSerialIslands.Clear();
+  mIslandBatchOffsets.Clear();
+  mIslandBatchOffsets.PushBack(0);
+
+  // Find which island every body is on
+  mBodyIslands.Clear();
+  IslandList::range islandRange = mIslands.All();
+  for (; !islandRange.Empty(); islandRange.PopFront())
+  {
+    Island* island = &islandRange.Front();
+    Island::Colliders::range colliders = island->mColliders.All();
+    for (; !colliders.Empty(); colliders.PopFront())
+    {
+      if (RigidBody* body = colliders.Front().GetActiveBody())
+        mBodyIslands[body] = island;
+    }
+  }
+
+  uint batchConstraintCount = 0;
+  islandRange = mIslands.All();
+  for (; !islandRange.Empty(); islandRange.PopFront())
+  {
+    Island* island = &islandRange.Front();
+    if (TouchesOtherBodies(island))
+    {
+      mSerialIslands.PushBack(island);
+      continue;
+    }
+
+    uint constraintCount = island->ContactCount + island->JointCount;
+
+    // A large island gets a batch of its own (if its solver is threaded it
+    // will further split itself across the workers)
+    if (constraintCount >= cIslandBatchConstraintCount && batchConstraintCount != 0)
+    {
+      mIslandBatchOffsets.PushBack(mSolveIslands.Size());
+      batchConstraintCount = 0;
+    }
+
+    mSolveIslands.PushBack(island);
+    batchConstraintCount += constraintCount;
+
+    if (batchConstraintCount >= cIslandBatchConstraintCount)
+    {
+      mIslandBatchOffsets.PushBack(mSolveIslands.Size());
+      batchConstraintCount = 0;
+    }
+  }
+
+  if (mIslandBatchOffsets.Back() != mSolveIslands.Size())
+    mIslandBatchOffsets.PushBack(mSolveIslands.Size());
+}
+
+bool IslandManager::TouchesOtherBodies(Island* island)
+{
+  // The solvers write the velocities of every body a constraint has
+  // (even static and sleeping bodies)
+  Island::ContactList::range contacts = island->mContacts.All();
+  for (; !contacts.Empty(); contacts.PopFront())
+  {
+    Contact& contact = contacts.Front();
+    for (uint i = 0; i < 2; ++i)
+    {
+      RigidBody* body = contact.GetCollider(i)->GetActiveBody();
+      if (body != nullptr && mBodyIslands.FindValue(body, nullptr) != island)
+        return true;
+    }
+  }
+
+  Island::JointList::range joints = island->mJoints.All();
+  for (; !joints.Empty(); joints.PopFront())
+  {
+    Joint& joint = joints.Front();
+    for (uint i = 0; i < 2; ++i)
+    {
+      Collider* collider = joint.GetCollider(i);
+      RigidBody* body = collider != nullptr ? collider->GetActiveBody() : nullptr;
+      if (body != nullptr && mBodyIslands.FindValue(body, nullptr) != island)
+        return true;
+    }
+  }
+  return false;
+}
+
 void IslandManager::SolvePositions(real dt)
 {
   IslandList::range islandRange = mIslands.All();
@@ -430,6 +579,10 @@ void IslandManager::Clear()
 {
   mIslandCount = 0;
 
+  mSolveIslands.Clear();
+  mSerialIslands.Clear();
+  mIslandBatchOffsets.Clear();
+  mBodyIslands.Clear();
   DeleteObjectsIn<Island, &Island::ManagerLink>(mIslands);
   if (mShareSolver && mSharedSolver != nullptr)
   {
@@ -548,6 +701,8 @@ IConstraintSolver* IslandManager::GetNewSolver()
     solver = new NormalSolver();
   else if (mPhysicsSolverConfig->mSolverType == PhysicsSolverType::Threaded)
     solver = new ThreadedSolver();
+  else if (mPhysicsSolverConfig->mSolverType == PhysicsSolverType::Batched)
+    solver = new BatchedSolver();
   else
     ErrorIf(true, "Invalid Solver type specified.");
 
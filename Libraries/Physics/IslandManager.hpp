@@ -6,7 +6,7 @@ namespace Zero
 
 /// What kind of a constraint solver should be used. A few pre-defined types
 /// meant for comparing performance.
-DeclareEnum4(PhysicsSolverType, Basic, Normal, GenericBasic, Threaded);
+DeclareEnum5(PhysicsSolverType, Basic, Normal, GenericBasic, Threaded, Batched);
 /// How should islands be built. Internal for testing (mostly legacy).
 DeclareEnum3(PhysicsIslandType, Composites, Kinematics, ForcedOne);
 /// What kind of pre-processing strategy should be used for merging islands.
@@ -30,6 +30,17 @@ public:
   void BuildIslands(ColliderList& colliders);
   void PostProcessIslands();
   void Solve(real dt, bool allowSleeping, uint debugFlags);
+  /// Solves the islands' constraints across the job system. Events and
+  /// sleeping are handled afterwards in island order so the results are the
+  /// same no matter which thread solved what.
+  void SolveConcurrently(real dt, bool allowSleeping, uint debugFlags);
+  /// Groups small islands together so each task has a reasonable amount of work.
+  /// Islands with constraints to bodies that aren't on them are set aside to be
+  /// solved serially.
+  void BuildIslandBatches();
+  /// Does the island have a constraint to a body that isn't on the island (a
+  /// sleeping body that wasn't traversed or a body on another island)?
+  bool TouchesOtherBodies(Island* island);
   void SolvePositions(real dt);
   void Draw(uint flags);
 
@@ -64,6 +75,16 @@ public:
   PhysicsSpace* mSpace;
   bool mShareSolver;
   IConstraintSolver* mSharedSolver;
+
+  /// The islands in solving order and the index of the first island in each
+  /// batch (with an extra entry marking the end of the last batch).
+  Array<Island*> mSolveIslands;
+  Array<uint> mIslandBatchOffsets;
+  /// Islands that can write to a body another island can also write to, so
+  /// they're solved one at a time after the batches.
+  Array<Island*> mSerialIslands;
+  /// The island each body is on while building the batches.
+  HashMap<RigidBody*, Island*> mBodyIslands;
 };
 
 } // namespace Physics
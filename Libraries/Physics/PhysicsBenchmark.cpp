@@ -0,0 +1,219 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+namespace
+{
+// Each box rests on the one below it so every box adds one contact.
+const uint cStackHeight = 10;
+const real cBoxSpacing = real(1.5);
+// Let the stacks settle so the contacts exist before we start timing.
+const uint cSettleSteps = 10;
+const real cTimeStep = real(1.0 / 60.0);
+
+const uint cSolverTypeCount = 4;
+const PhysicsSolverType::Enum cSolverTypes[cSolverTypeCount] = {
+    PhysicsSolverType::Basic, PhysicsSolverType::Normal, PhysicsSolverType::Threaded, PhysicsSolverType::Batched};
+
+// The broad phase boxes are unit cubes with about this much empty space
+// around each one so that every box has a few neighbors.
+const real cBroadPhaseSpacing = real(2.0);
+const real cJitterDistance = real(0.1);
+const uint cBroadPhaseSeed = 1337;
+
+DeclareEnum2(SapUpdateMode, Incremental, Batched);
+DeclareEnum2(SapMotion, Jitter, Teleport);
+
+uint CountBenchmarkContacts(Array<Cog*>& cogs)
+{
+  // Every contact is between two of the benchmark's colliders so it's counted twice.
+  uint contactCount = 0;
+  forRange (Cog* cog, cogs.All())
+  {
+    if (Collider* collider = cog->has(Collider))
+      contactCount += collider->GetContactCount();
+  }
+  return contactCount / 2;
+}
+
+void CreateBenchmarkStacks(Space* space, uint boxCount, Array<Cog*>& cogsOut)
+{
+  uint stackCount = (boxCount + cStackHeight - 1) / cStackHeight;
+  uint stacksPerRow = (uint)Math::Ceil(Math::Sqrt(real(stackCount)));
+  real floorSize = real(stacksPerRow + 1) * cBoxSpacing;
+  real rowStart = -real(stacksPerRow - 1) * cBoxSpacing * real(0.5);
+
+  Cog* floor = space->CreateAt(CoreArchetypes::Cube, Vec3(0, -0.5f, 0), Vec3(floorSize, 1, floorSize));
+  floor->has(RigidBody)->SetDynamicState(RigidBodyDynamicState::Static);
+  cogsOut.PushBack(floor);
+
+  uint created = 0;
+  for (uint stack = 0; stack < stackCount; ++stack)
+  {
+    real x = rowStart + real(stack % stacksPerRow) * cBoxSpacing;
+    real z = rowStart + real(stack / stacksPerRow) * cBoxSpacing;
+    for (uint level = 0; level < cStackHeight && created < boxCount; ++level, ++created)
+      cogsOut.PushBack(space->CreateAt(CoreArchetypes::Cube, Vec3(x, real(level) + real(0.5), z)));
+  }
+}
+} // namespace
+
+void RunPhysicsSolverBenchmark(uint contactCount, uint steps)
+{
+  for (uint i = 0; i < cSolverTypeCount; ++i)
+  {
+    PhysicsSolverType::Enum solverType = cSolverTypes[i];
+
+    Space* space = Z::gFactory->CreateSpace(CoreArchetypes::DefaultSpace, CreationFlags::Default, nullptr);
+    PhysicsSpace* physicsSpace = space->has(PhysicsSpace);
+    ReturnIf(physicsSpace == nullptr, , "The default space has no PhysicsSpace to benchmark");
+
+    HandleOf<PhysicsSolverConfig> config = PhysicsSolverConfigManager::GetDefault()->RuntimeClone();
+    config->SetSolverType(solverType);
+    physicsSpace->SetPhysicsSolverConfig(config);
+    physicsSpace->SetIsSolverShared(true);
+    physicsSpace->SetAllowSleep(false);
+
+    Array<Cog*> cogs;
+    CreateBenchmarkStacks(space, contactCount, cogs);
+
+    for (uint step = 0; step < cSettleSteps; ++step)
+      physicsSpace->IterateTimestep(cTimeStep);
+
+    BenchmarkTimer timer;
+    timer.Start();
+    for (uint step = 0; step < steps; ++step)
+      physicsSpace->IterateTimestep(cTimeStep);
+    timer.Stop();
+
+    PrintBenchmarkResult("PhysicsSolverBenchmark",
+                         "%s solver, %u contacts, %.3f ms per step",
+                         PhysicsSolverType::Names[solverType],
+                         CountBenchmarkContacts(cogs),
+                         timer.GetMsPerRun(steps));
+
+    space->Destroy();
+  }
+}
+
+void RunPhysicsSolverBenchmarks()
+{
+  RunPhysicsSolverBenchmark(1000);
+  RunPhysicsSolverBenchmark(10000);
+  RunPhysicsSolverBenchmark(50000);
+}
+
+namespace
+{
+void SetBenchmarkBox(BroadPhaseData& data, Vec3Param center)
+{
+  Vec3 halfExtents(real(0.5));
+  data.mAabb.SetMinAndMax(center - halfExtents, center + halfExtents);
+  data.mBoundingSphere.mCenter = center;
+  data.mBoundingSphere.mRadius = halfExtents.Length();
+}
+
+Vec3 RandomBenchmarkPoint(Math::Random& random, real worldSize)
+{
+  return Vec3(random.FloatRange(0, worldSize), random.FloatRange(0, worldSize), random.FloatRange(0, worldSize));
+}
+
+double TimeSapUpdates(SapUpdateMode::Enum mode, SapMotion::Enum motion, uint objectCount, uint steps, uint& pairCount)
+{
+  real worldSize = Math::Pow(real(objectCount), real(1.0) / real(3.0)) * cBroadPhaseSpacing;
+  // Use the same seed for each mode so they move the boxes the same way
+  Math::Random random(cBroadPhaseSeed);
+
+  SapBroadPhase broadPhase;
+  broadPhase.SetBatchRatio(mode == SapUpdateMode::Batched ? real(0.0) : Math::PositiveMax());
+
+  Array<BroadPhaseProxy> proxies;
+  proxies.Resize(objectCount);
+  Array<Vec3> centers;
+  centers.Resize(objectCount);
+  BroadPhaseObjectArray objects;
+  objects.Resize(objectCount);
+  for (uint i = 0; i < objectCount; ++i)
+  {
+    centers[i] = RandomBenchmarkPoint(random, worldSize);
+    objects[i].mProxy = &proxies[i];
+    // Each box needs unique client data since the pairs are hashed on it
+    objects[i].mData.mClientData = (void*)(uintptr_t)(i + 1);
+    SetBenchmarkBox(objects[i].mData, centers[i]);
+  }
+  broadPhase.CreateProxies(objects);
+
+  BenchmarkTimer timer;
+  for (uint step = 0; step < steps; ++step)
+  {
+    for (uint i = 0; i < objectCount; ++i)
+    {
+      if (motion == SapMotion::Jitter)
+        centers[i] += random.PointInUnitSphere() * cJitterDistance;
+      else
+        centers[i] = RandomBenchmarkPoint(random, worldSize);
+      SetBenchmarkBox(objects[i].mData, centers[i]);
+    }
+
+    timer.Start();
+    broadPhase.UpdateProxies(objects);
+    timer.Stop();
+  }
+
+  ClientPairArray pairs;
+  broadPhase.SelfQuery(pairs);
+  pairCount = pairs.Size();
+
+  return timer.GetMsPerRun(steps);
+}
+} // namespace
+
+void RunSapBroadPhaseBenchmark(uint objectCount, uint steps)
+{
+  for (uint motion = 0; motion < SapMotion::Size; ++motion)
+  {
+    uint pairCounts[SapUpdateMode::Size];
+    for (uint mode = 0; mode < SapUpdateMode::Size; ++mode)
+    {
+      uint& pairCount = pairCounts[mode];
+      pairCount = 0;
+      double msPerStep =
+          TimeSapUpdates((SapUpdateMode::Enum)mode, (SapMotion::Enum)motion, objectCount, steps, pairCount);
+      PrintBenchmarkResult("SapBroadPhaseBenchmark",
+                           "%s update, %s, %u objects, %u pairs, %.3f ms per step",
+                           SapUpdateMode::Names[mode],
+                           SapMotion::Names[motion],
+                           objectCount,
+                           pairCount,
+                           msPerStep);
+    }
+
+    // Both modes move the boxes the same way so they have to end up with the
+    // same pairs, otherwise the batched update is broken and its time is
+    // meaningless
+    if (pairCounts[SapUpdateMode::Incremental] != pairCounts[SapUpdateMode::Batched])
+    {
+      PrintBenchmarkResult("SapBroadPhaseBenchmark",
+                           "MISMATCH, %s, %u objects, %u incremental pairs, %u batched pairs",
+                           SapMotion::Names[motion],
+                           objectCount,
+                           pairCounts[SapUpdateMode::Incremental],
+                           pairCounts[SapUpdateMode::Batched]);
+      Error("The incremental and batched Sap updates found different pairs (%u and %u).",
+            pairCounts[SapUpdateMode::Incremental],
+            pairCounts[SapUpdateMode::Batched]);
+    }
+  }
+}
+
+void RunBroadPhaseBenchmarks()
+{
+  // Teleporting is quadratic for the incremental path so stay small
+  RunSapBroadPhaseBenchmark(1000);
+  RunSapBroadPhaseBenchmark(4000);
+  RunSapBroadPhaseBenchmark(16000);
+}
+
+} // namespace Zero
@@ -0,0 +1,25 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+/// Builds a scene of box stacks resting on a static floor with roughly the
+/// given number of contacts, steps it with each constraint solver type and
+/// prints the average time per step. All constraints go through one shared
+/// solver and sleeping is disabled so that every step solves every contact.
+void RunPhysicsSolverBenchmark(uint contactCount, uint steps = 60);
+
+/// Runs the solver benchmark at 1k, 10k and 50k contacts.
+void RunPhysicsSolverBenchmarks();
+
+/// Scatters boxes through a cube, then moves every box each step either a
+/// small amount (jitter) or to a random new spot (teleport) and prints the
+/// average time Sap takes to update them with its incremental and its
+/// batched (radix sorted) update paths.
+void RunSapBroadPhaseBenchmark(uint objectCount, uint steps = 10);
+
+/// Runs the Sap broad phase benchmark at 1k, 4k and 16k objects.
+void RunBroadPhaseBenchmarks();
+
+} // namespace Zero
@@ -297,8 +297,8 @@ ZilchDefineType(PhysicsSolverConfig, builder, type)
   // ZilchBindFieldProperty(mWarmStart);
   // ZilchBindFieldProperty(mCacheContacts);
   // ZilchBindGetterSetterProperty(SubCorrectionType);
-  // ZilchBindGetterSetterProperty(SolverType);
 
+  ZilchBindGetterSetterProperty(SolverType);
   ZilchBindGetterSetterProperty(PositionCorrectionType);
 }
 
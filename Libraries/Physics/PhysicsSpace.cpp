@@ -151,6 +151,8 @@ ZilchDefineType(PhysicsSpace, builder, type)
   ZilchBindOverloadedMethod(CastAabb, ZilchInstanceOverload(CastResultsRange, const Aabb&, uint, CastFilter&));
   ZilchBindOverloadedMethod(CastSphere, ZilchInstanceOverload(CastResultsRange, const Sphere&, uint, CastFilter&));
   ZilchBindOverloadedMethod(CastFrustum, ZilchInstanceOverload(CastResultsRange, const Frustum&, uint, CastFilter&));
+  ZilchBindOverloadedMethod(CastQueries, ZilchInstanceOverload(void, CastBatch&));
+  ZilchBindOverloadedMethod(CastQueries, ZilchInstanceOverload(void, CastBatch&, CastFilter&));
   ZilchBindOverloadedMethod(CastCollider, ZilchInstanceOverload(CastResultsRange, Vec3Param, Collider*, CastFilter&));
   // Event Dispatching in Region
   ZilchBindOverloadedMethod(DispatchWithinSphere, ZilchInstanceOverload(void, const Sphere&, StringParam, Event*));
@@ -781,49 +783,112 @@ void PhysicsSpace::BroadPhase()
     Sort(mPossiblePairs.All(), &ClientPairSorter);
 }
 
+/// How many of the broad phase's possible pairs are tested as one chunk.
+const uint cNarrowPhaseChunkSize = 64;
+
+/// Tests a range of chunks of the possible pairs, writing the results into
+/// each chunk's buffer. Only reads from the colliders so chunks can be run on
+/// any thread.
+struct NarrowPhaseChunkOperation
+{
+  NarrowPhaseChunkOperation(ClientPairArray& pairs,
+                            Physics::CollisionManager* collisionManager,
+                            Array<Physics::NarrowPhaseBuffer>& buffers) :
+      mPairs(pairs),
+      mCollisionManager(collisionManager),
+      mBuffers(buffers)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    for (uint chunk = start; chunk < end; ++chunk)
+      TestChunk(chunk);
+  }
+
+  void TestChunk(uint chunk)
+  {
+    Physics::NarrowPhaseBuffer& buffer = mBuffers[chunk];
+    buffer.mManifolds.Clear();
+    buffer.mPairs.Clear();
+
+    uint pairStart = chunk * cNarrowPhaseChunkSize;
+    uint pairEnd = Math::Min(pairStart + cNarrowPhaseChunkSize, (uint)mPairs.Size());
+    for (uint pairIndex = pairStart; pairIndex < pairEnd; ++pairIndex)
+    {
+      ClientPair* clientPair = &mPairs[pairIndex];
+      Collider* collider1 = static_cast<Collider*>(clientPair->mClientData[0]);
+      Collider* collider2 = static_cast<Collider*>(clientPair->mClientData[1]);
+      // Convert the proxy to a collider
+      ColliderPair pair(collider1, collider2);
+
+      // Test for collision (manifolds are appended to the buffer)
+      uint manifoldStart = buffer.mManifolds.Size();
+      if (!mCollisionManager->TestCollision(pair, buffer.mManifolds))
+      {
+        buffer.mManifolds.Resize(manifoldStart);
+        continue;
+      }
+
+      Physics::NarrowPhaseBuffer::CollidedPair& collidedPair = buffer.mPairs.PushBack();
+      collidedPair.mPairIndex = pairIndex;
+      collidedPair.mManifoldStart = manifoldStart;
+      collidedPair.mManifoldEnd = buffer.mManifolds.Size();
+    }
+  }
+
+  ClientPairArray& mPairs;
+  Physics::CollisionManager* mCollisionManager;
+  Array<Physics::NarrowPhaseBuffer>& mBuffers;
+};
+
 void PhysicsSpace::NarrowPhase()
 {
   ProfileScopeTree("NarrowPhase", "Iteration", Color::Salmon);
 
   HeapAllocator allocator(mHeap);
-  Physics::ManifoldArray tempManifolds;
-  tempManifolds.SetAllocator(allocator);
-
   Array<NodePointerPair> Collisions;
   Collisions.SetAllocator(allocator);
 
-  uint size = mPossiblePairs.Size();
-  for (unsigned pairIndex = 0; pairIndex < size; ++pairIndex)
-  {
-    ClientPair* clientPair = &mPossiblePairs[pairIndex];
-    Collider* collider1 = static_cast<Collider*>(clientPair->mClientData[0]);
-    Collider* collider2 = static_cast<Collider*>(clientPair->mClientData[1]);
-    // Convert the proxy to a collider
-    ColliderPair pair(collider1, collider2);
+  // Collision detection only reads from the colliders, so test chunks of the
+  // pairs across the job system (or on this thread if there isn't one)
+  uint pairCount = mPossiblePairs.Size();
+  uint chunkCount = (pairCount + cNarrowPhaseChunkSize - 1) / cNarrowPhaseChunkSize;
+  if (mNarrowPhaseBuffers.Size() < chunkCount)
+    mNarrowPhaseBuffers.Resize(chunkCount);
 
-    // Test for collision
-    if (!mCollisionManager->TestCollision(pair, tempManifolds))
-    {
-      tempManifolds.Clear();
-      continue;
-    }
+  NarrowPhaseChunkOperation chunkOperation(mPossiblePairs, mCollisionManager, mNarrowPhaseBuffers);
+  if (Z::gJobs != nullptr)
+    Z::gJobs->ParallelFor(0, chunkCount, chunkOperation);
+  else
+    chunkOperation(0, chunkCount);
 
-    // If tracking is enabled, we need to record the collision
-    if (mBroadPhase->IsTracking())
+  // Merge the results in pair order so contacts and events are created in
+  // the same order no matter which thread tested what
+  bool tracking = mBroadPhase->IsTracking();
+  for (uint chunk = 0; chunk < chunkCount; ++chunk)
+  {
+    Physics::NarrowPhaseBuffer& buffer = mNarrowPhaseBuffers[chunk];
+    for (uint i = 0; i < buffer.mPairs.Size(); ++i)
     {
-      NodePointerPair nodePair(clientPair->mClientData[0], clientPair->mClientData[1]);
-      Collisions.PushBack(nodePair);
-    }
+      Physics::NarrowPhaseBuffer::CollidedPair& collidedPair = buffer.mPairs[i];
 
-    // Add all manifolds to the contact manager
-    for (uint i = 0; i < tempManifolds.Size(); ++i)
-    {
-      Physics::Manifold& manifold = tempManifolds[i];
-      mContactManager->AddManifold(tempManifolds[i]);
-      manifold.Clear();
-    }
+      // If tracking is enabled, we need to record the collision
+      if (tracking)
+      {
+        ClientPair* clientPair = &mPossiblePairs[collidedPair.mPairIndex];
+        NodePointerPair nodePair(clientPair->mClientData[0], clientPair->mClientData[1]);
+        Collisions.PushBack(nodePair);
+      }
 
-    tempManifolds.Clear();
+      // Add all manifolds to the contact manager
+      for (uint m = collidedPair.mManifoldStart; m < collidedPair.mManifoldEnd; ++m)
+      {
+        Physics::Manifold& manifold = buffer.mManifolds[m];
+        mContactManager->AddManifold(manifold);
+        manifold.Clear();
+      }
+    }
   }
 
   mBroadPhase->RecordFrameResults(Collisions);
@@ -1029,6 +1094,108 @@ CastResultsRange PhysicsSpace::CastFrustum(const Frustum& frustum, uint maxCount
   return CastResultsRange(results);
 }
 
+/// How many queries of a CastBatch are run together on one thread.
+const uint cCastBatchChunkSize = 16;
+
+/// Runs a range of a CastBatch's queries. Each query writes only to its own
+/// entries of the batch and casts only read from the broad phases and
+/// colliders, so ranges can be run on any thread.
+struct CastBatchOperation
+{
+  CastBatchOperation(PhysicsSpace* space, CastBatch& batch, CastFilter& rayFilter, CastFilter& volumeFilter) :
+      mSpace(space),
+      mBatch(batch),
+      mRayFilter(rayFilter),
+      mVolumeFilter(volumeFilter)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    mSpace->CastBatchRange(mBatch, start, end, mRayFilter, mVolumeFilter);
+  }
+
+  PhysicsSpace* mSpace;
+  CastBatch& mBatch;
+  CastFilter& mRayFilter;
+  CastFilter& mVolumeFilter;
+};
+
+void PhysicsSpace::CastQueries(CastBatch& batch)
+{
+  CastFilter filter;
+  CastQueries(batch, filter);
+}
+
+void PhysicsSpace::CastQueries(CastBatch& batch, CastFilter& filter)
+{
+  // Push once for the entire batch rather than once per query
+  PushBroadPhaseQueue();
+  batch.PrepareResults();
+
+  // Rays use the filter as is, everything else never ignores internal casts
+  // (the same as the single casts, but without modifying the user's filter)
+  CastFilter rayFilter(filter);
+  CastFilter volumeFilter(filter);
+  volumeFilter.ClearFlag(BaseCastFilterFlags::IgnoreInternalCasts);
+
+  // The filter callback dispatches an event and the tracker records every
+  // cast, so neither of them can be run from multiple threads
+  uint queryCount = batch.GetQueryCount();
+  bool serial = filter.mCallbackObject != nullptr || mBroadPhase->IsTracking();
+
+  CastBatchOperation operation(this, batch, rayFilter, volumeFilter);
+  if (Z::gJobs != nullptr && !serial)
+    Z::gJobs->ParallelFor(0, queryCount, operation, cCastBatchChunkSize);
+  else
+    operation(0, queryCount);
+}
+
+void PhysicsSpace::CastBatchRange(
+    CastBatch& batch, uint start, uint end, CastFilter& rayFilter, CastFilter& volumeFilter)
+{
+  CastResults rayResults(batch.mResultStride, rayFilter);
+  CastResults volumeResults(batch.mResultStride, volumeFilter);
+
+  for (uint i = start; i < end; ++i)
+  {
+    uint queryIndex = batch.mOrder[i];
+    CastBatch::Query& query = batch.mQueries[queryIndex];
+    uint shapeIndex = query.mShapeIndex;
+
+    CastResults& results = (query.mType == CastBatchQueryType::Ray) ? rayResults : volumeResults;
+    results.Clear();
+
+    switch (query.mType)
+    {
+    case CastBatchQueryType::Ray:
+    {
+      Ray& ray = batch.mRays[shapeIndex];
+      mBroadPhase->CastRay(ray.Start, ray.Direction.AttemptNormalized(), results.mResults);
+      break;
+    }
+    case CastBatchQueryType::Segment:
+    {
+      Segment& segment = batch.mSegments[shapeIndex];
+      mBroadPhase->CastSegment(segment.Start, segment.End, results.mResults);
+      break;
+    }
+    case CastBatchQueryType::Aabb:
+      mBroadPhase->CastAabb(batch.mAabbs[shapeIndex], results.mResults);
+      break;
+    case CastBatchQueryType::Sphere:
+      mBroadPhase->CastSphere(batch.mSpheres[shapeIndex], results.mResults);
+      break;
+    case CastBatchQueryType::Frustum:
+      mBroadPhase->CastFrustum(batch.mFrustums[shapeIndex], results.mResults);
+      break;
+    }
+
+    results.ConvertToColliders();
+    batch.StoreResults(queryIndex, results.mArray.Data(), results.Size());
+  }
+}
+
 void PhysicsSpace::CastCollider(Vec3Param offset,
                                 Collider* testCollider,
                                 Physics::ManifoldArray& results,
@@ -51,6 +51,29 @@ struct SweepResult
 
 typedef Array<SweepResult> SweepResultArray;
 
+namespace Physics
+{
+
+/// The narrow phase results for one chunk of the broad phase pairs. Each chunk
+/// writes into its own buffer so chunks can be tested on any thread, then the
+/// buffers are merged in chunk order. The buffers persist between frames so
+/// their memory is reused.
+struct NarrowPhaseBuffer
+{
+  /// A pair that collided and the range of its manifolds in the buffer.
+  struct CollidedPair
+  {
+    uint mPairIndex;
+    uint mManifoldStart;
+    uint mManifoldEnd;
+  };
+
+  ManifoldArray mManifolds;
+  Array<CollidedPair> mPairs;
+};
+
+} // namespace Physics
+
 struct SweepResultRange
 {
   typedef SweepResult value_type;
@@ -191,6 +214,8 @@ public:
   void SolvePositions(real dt);
   /// Solve any spring systems
   void SolveSprings(real dt);
+  /// Runs the queries of a batch in the range [start, end) of its run order.
+  void CastBatchRange(CastBatch& batch, uint start, uint end, CastFilter& rayFilter, CastFilter& volumeFilter);
 
   //---------------------------------------------------------------- Ray Casting
   /// Returns the results of a Ray Cast. The results of the ray cast are
@@ -242,6 +267,14 @@ public:
   /// given filter. This returns up to maxCount number of objects.
   CastResultsRange CastFrustum(const Frustum& frustum, uint maxCount, CastFilter& filter);
 
+  //------------------------------------------------------------- Batch Casting
+  /// Runs every query in the batch, storing each query's results in the
+  /// batch. Large batches are split across the job system. A default
+  /// CastFilter will be used.
+  void CastQueries(CastBatch& batch);
+  /// Runs every query in the batch using the given filter for all of them.
+  void CastQueries(CastBatch& batch, CastFilter& filter);
+
   //------------------------------------------------------------- Collider
   // Casting
   /// Currently a hack function for player controller sweeping
@@ -396,6 +429,8 @@ private:
   // Stores the objects returned from the broad phase for that frame.  It is
   // not created on the stack each frame to avoid allocations.
   ClientPairArray mPossiblePairs;
+  // One buffer per chunk of possible pairs tested during the narrow phase.
+  Array<Physics::NarrowPhaseBuffer> mNarrowPhaseBuffers;
 
   // Stores all broad phase information.
   BroadPhasePackage* mBroadPhase;
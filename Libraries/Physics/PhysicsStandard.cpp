@@ -190,6 +190,7 @@ ZilchDefineStaticLibrary(PhysicsLibrary)
   ZilchInitializeType(CastFilter);
   ZilchInitializeType(CastResult);
   ZilchInitializeType(CastResults);
+  ZilchInitializeType(CastBatch);
   ZilchInitializeType(SweepResult);
 
   // Misc
@@ -136,10 +136,12 @@ public:
 #include "TemplatedFragments.hpp"
 #include "ThreadedFragments.hpp"
 #include "ThreadedSolver.hpp"
+#include "BatchedSolver.hpp"
 
 #include "RayCast.hpp"
 #include "Manifold.hpp"
 #include "PhysicsSpace.hpp"
+#include "PhysicsBenchmark.hpp"
 
 // BroadPhase
 #include "Analyzer.hpp"
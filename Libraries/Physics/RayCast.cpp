@@ -321,6 +321,15 @@ CastResultsRange::CastResultsRange(const CastResults& castResults)
   mRange = mArray.All();
 }
 
+CastResultsRange::CastResultsRange(CastResultArray::range results)
+{
+  uint count = results.Size();
+  mArray.Resize(count);
+  for (uint i = 0; i < count; ++i)
+    mArray[i] = results[i];
+  mRange = mArray.All();
+}
+
 CastResultsRange::CastResultsRange(const CastResultsRange& rhs)
 {
   uint count = rhs.mArray.Size();
@@ -350,4 +359,190 @@ uint CastResultsRange::Size()
   return mRange.Size();
 }
 
+/// Rays and segments are also grouped by the signs of their direction.
+const uint cCastBatchDirectionGroups = 8;
+
+ZilchDefineType(CastBatch, builder, type)
+{
+  type->CreatableInScript = true;
+
+  ZeroBindDocumented();
+
+  ZilchBindDefaultCopyDestructor();
+
+  ZilchBindMethod(Clear);
+  ZilchBindMethod(AddRay);
+  ZilchBindMethod(AddSegment);
+  ZilchBindMethod(AddAabb);
+  ZilchBindMethod(AddSphere);
+  ZilchBindMethod(AddFrustum);
+  ZilchBindGetterProperty(QueryCount);
+  ZilchBindGetterSetterProperty(MaxResults);
+  ZilchBindMethod(GetResultCount);
+  ZilchBindMethod(GetResult);
+  ZilchBindMethod(GetFirstResult);
+  ZilchBindMethod(GetResults);
+}
+
+CastBatch::CastBatch()
+{
+  mMaxResults = 1;
+  mResultStride = 0;
+}
+
+void CastBatch::Clear()
+{
+  mQueries.Clear();
+  mRays.Clear();
+  mSegments.Clear();
+  mAabbs.Clear();
+  mSpheres.Clear();
+  mFrustums.Clear();
+  mResults.Clear();
+  mResultStride = 0;
+  mResultCounts.Clear();
+  mOrder.Clear();
+}
+
+uint CastBatch::AddRay(const Ray& ray)
+{
+  mRays.PushBack(ray);
+  return AddQuery(CastBatchQueryType::Ray, mRays.Size() - 1);
+}
+
+uint CastBatch::AddSegment(const Segment& segment)
+{
+  mSegments.PushBack(segment);
+  return AddQuery(CastBatchQueryType::Segment, mSegments.Size() - 1);
+}
+
+uint CastBatch::AddAabb(const Aabb& aabb)
+{
+  mAabbs.PushBack(aabb);
+  return AddQuery(CastBatchQueryType::Aabb, mAabbs.Size() - 1);
+}
+
+uint CastBatch::AddSphere(const Sphere& sphere)
+{
+  mSpheres.PushBack(sphere);
+  return AddQuery(CastBatchQueryType::Sphere, mSpheres.Size() - 1);
+}
+
+uint CastBatch::AddFrustum(const Frustum& frustum)
+{
+  mFrustums.PushBack(frustum);
+  return AddQuery(CastBatchQueryType::Frustum, mFrustums.Size() - 1);
+}
+
+uint CastBatch::GetQueryCount()
+{
+  return mQueries.Size();
+}
+
+uint CastBatch::GetMaxResults()
+{
+  return mMaxResults;
+}
+
+void CastBatch::SetMaxResults(uint maxResults)
+{
+  // Same limits as a single cast's CastResults
+  mMaxResults = Math::Clamp(maxResults, 1u, 100000u);
+}
+
+uint CastBatch::GetResultCount(uint queryIndex)
+{
+  if (queryIndex >= mResultCounts.Size())
+  {
+    DoNotifyException("Invalid index", "The query index is not in the batch or the batch has not been cast.");
+    return 0;
+  }
+  return mResultCounts[queryIndex];
+}
+
+CastResult CastBatch::GetResult(uint queryIndex, uint resultIndex)
+{
+  if (resultIndex >= GetResultCount(queryIndex))
+    return CastResult();
+
+  uint index = queryIndex * mResultStride + resultIndex;
+  if (index >= mResults.Size())
+    return CastResult();
+  return mResults[index];
+}
+
+CastResult CastBatch::GetFirstResult(uint queryIndex)
+{
+  return GetResult(queryIndex, 0);
+}
+
+CastResultsRange CastBatch::GetResults(uint queryIndex)
+{
+  uint count = GetResultCount(queryIndex);
+  uint first = queryIndex * mResultStride;
+  if (count == 0 || first + count > mResults.Size())
+    return CastResultsRange(CastResultArray::range());
+
+  CastResult* begin = mResults.Data() + first;
+  return CastResultsRange(CastResultArray::range(begin, begin + count));
+}
+
+uint CastBatch::AddQuery(CastBatchQueryType::Enum type, uint shapeIndex)
+{
+  Query& query = mQueries.PushBack();
+  query.mType = type;
+  query.mShapeIndex = shapeIndex;
+  return mQueries.Size() - 1;
+}
+
+void CastBatch::PrepareResults()
+{
+  uint queryCount = mQueries.Size();
+  mResultStride = mMaxResults;
+  mResults.Resize(queryCount * mResultStride);
+  mResultCounts.Resize(queryCount);
+  mOrder.Resize(queryCount);
+
+  // Counting sort the queries by their type (and direction for rays and
+  // segments) so that neighboring queries walk the same parts of the broad
+  // phases and share the same cast code while it is still in the cache.
+  mOrderCounts.Resize(CastBatchQueryType::Size * cCastBatchDirectionGroups + 1);
+  for (uint i = 0; i < mOrderCounts.Size(); ++i)
+    mOrderCounts[i] = 0;
+
+  for (uint i = 0; i < queryCount; ++i)
+    ++mOrderCounts[GetSortKey(i) + 1];
+  for (uint i = 1; i < mOrderCounts.Size(); ++i)
+    mOrderCounts[i] += mOrderCounts[i - 1];
+  for (uint i = 0; i < queryCount; ++i)
+    mOrder[mOrderCounts[GetSortKey(i)]++] = i;
+}
+
+uint CastBatch::GetSortKey(uint queryIndex)
+{
+  Query& query = mQueries[queryIndex];
+
+  Vec3 direction = Vec3::cZero;
+  if (query.mType == CastBatchQueryType::Ray)
+    direction = mRays[query.mShapeIndex].Direction;
+  else if (query.mType == CastBatchQueryType::Segment)
+    direction = mSegments[query.mShapeIndex].End - mSegments[query.mShapeIndex].Start;
+
+  uint octant = 0;
+  for (uint axis = 0; axis < 3; ++axis)
+  {
+    if (direction[axis] < real(0.0))
+      octant |= 1 << axis;
+  }
+  return query.mType * cCastBatchDirectionGroups + octant;
+}
+
+void CastBatch::StoreResults(uint queryIndex, const CastResult* results, uint count)
+{
+  CastResult* slots = mResults.Data() + queryIndex * mResultStride;
+  for (uint i = 0; i < count; ++i)
+    slots[i] = results[i];
+  mResultCounts[queryIndex] = count;
+}
+
 } // namespace Zero
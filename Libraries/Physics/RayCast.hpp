@@ -174,6 +174,7 @@ struct CastResultsRange
   {
   }
   CastResultsRange(const CastResults& castResults);
+  CastResultsRange(CastResultArray::range results);
   CastResultsRange(const CastResultsRange& rhs);
 
   bool Empty();
@@ -185,4 +186,82 @@ struct CastResultsRange
   CastResultArray mArray;
 };
 
+/// The kind of cast a query in a CastBatch performs.
+DeclareEnum5(CastBatchQueryType, Ray, Segment, Aabb, Sphere, Frustum);
+
+/// Many casts that are run together by PhysicsSpace::CastQueries. The results
+/// of every query are stored in one flat array where each query owns MaxResults
+/// entries, so a batch that is rebuilt every frame does not allocate once it
+/// has grown to its largest size.
+class CastBatch
+{
+public:
+  ZilchDeclareType(CastBatch, TypeCopyMode::ReferenceType);
+
+  CastBatch();
+
+  /// Removes all queries and their results (the memory is kept).
+  void Clear();
+
+  /// Adds a query to the batch. Returns the index of the query which is
+  /// used to look up its results after the batch has been cast.
+  uint AddRay(const Ray& ray);
+  uint AddSegment(const Segment& segment);
+  uint AddAabb(const Aabb& aabb);
+  uint AddSphere(const Sphere& sphere);
+  uint AddFrustum(const Frustum& frustum);
+
+  /// The number of queries in the batch.
+  uint GetQueryCount();
+  /// The maximum number of objects each query can return.
+  uint GetMaxResults();
+  void SetMaxResults(uint maxResults);
+
+  /// Returns the number of objects the given query hit.
+  uint GetResultCount(uint queryIndex);
+  /// Returns a result of the given query. Results are sorted by time of
+  /// collision (ray and segment queries).
+  CastResult GetResult(uint queryIndex, uint resultIndex);
+  /// Returns the first result of the given query (an empty result if nothing
+  /// was hit).
+  CastResult GetFirstResult(uint queryIndex);
+  /// Returns a range of all results of the given query.
+  CastResultsRange GetResults(uint queryIndex);
+
+private:
+  friend class PhysicsSpace;
+
+  struct Query
+  {
+    CastBatchQueryType::Enum mType;
+    /// Index into the array of this query's shape type.
+    uint mShapeIndex;
+  };
+
+  uint AddQuery(CastBatchQueryType::Enum type, uint shapeIndex);
+  /// Sizes the results for the current queries and sorts the queries so that
+  /// the same kind of casts are run next to each other.
+  void PrepareResults();
+  uint GetSortKey(uint queryIndex);
+  /// Copies the results of one query into its entries of the result array.
+  void StoreResults(uint queryIndex, const CastResult* results, uint count);
+
+  Array<Query> mQueries;
+  Array<Ray> mRays;
+  Array<Segment> mSegments;
+  Array<Aabb> mAabbs;
+  Array<Sphere> mSpheres;
+  Array<Frustum> mFrustums;
+
+  uint mMaxResults;
+  /// The max results when the batch was cast (MaxResults may be changed
+  /// after casting). Query i owns the entries [i * stride, i * stride + stride).
+  uint mResultStride;
+  CastResultArray mResults;
+  Array<uint> mResultCounts;
+  /// The order the queries are run in.
+  Array<uint> mOrder;
+  Array<uint> mOrderCounts;
+};
+
 } // namespace Zero
@@ -21,6 +21,8 @@ struct ConstraintBatch
   uint ConstraintCount;
   typedef InList<JointType, &JointType::SolverLink> JointList;
   JointList Joints;
+  // Where this batch's molecules start so it can be solved independently.
+  MoleculeWalker Molecules;
 
   IntrusiveLink(ConstraintBatch<JointType>, link);
 };
@@ -41,6 +43,8 @@ struct ConstraintPhase
   typedef ConstraintBatch<JointType> JointBatch;
   typedef InList<JointBatch> JointBatches;
   JointBatches Batches;
+  // The same batches as above, for random access when splitting across threads.
+  Array<JointBatch*> BatchArray;
 
   IntrusiveLink(ConstraintPhase<JointType>, link);
 };
@@ -125,15 +129,65 @@ void GroupOperationTwoParamFragment(ConstraintGroup<typename ListType::value_typ
   }
 }
 
+/// Runs an operation on a sub-range of a phase's batches (used with ParallelFor).
+template <typename JointType, typename Functor>
+struct PhaseBatchRangeOperation
+{
+  typedef ConstraintBatch<JointType> BatchType;
+
+  PhaseBatchRangeOperation(Array<BatchType*>& batches, Functor& operation) :
+      mBatches(&batches),
+      mOperation(&operation)
+  {
+  }
+
+  void operator()(uint start, uint end)
+  {
+    for (uint i = start; i < end; ++i)
+      (*mOperation)(*(*mBatches)[i]);
+  }
+
+  Array<BatchType*>* mBatches;
+  Functor* mOperation;
+};
+
+/// Runs the operation on every batch of each phase in order. The batches in a
+/// phase never share a body so they are run across the job system's workers,
+/// and each phase must finish before the next one starts. Since the batches
+/// write disjoint data the result doesn't depend on which thread ran what.
+template <typename JointType, typename Functor>
+void ParallelGroupOperation(ConstraintGroup<JointType>& group, Functor& operation)
+{
+  typedef ConstraintGroup<JointType> JointGroup;
+  typedef ConstraintPhase<JointType> JointPhase;
+
+  typename JointGroup::PhaseTypeList::range phaseRange = group.Phases.All();
+  for (; !phaseRange.Empty(); phaseRange.PopFront())
+  {
+    JointPhase& phase = phaseRange.Front();
+    PhaseBatchRangeOperation<JointType, Functor> batchOperation(phase.BatchArray, operation);
+
+    uint batchCount = phase.BatchArray.Size();
+    if (Z::gJobs != nullptr)
+      Z::gJobs->ParallelFor(0, batchCount, batchOperation);
+    else
+      batchOperation(0, batchCount);
+  }
+}
+
+/// Splits the joints into phases of batches where no two joints in a phase
+/// write to the same body. Static colliders are never written to by the solver
+/// so they don't prevent joints from sharing a phase.
 template <typename ListType>
-void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value_type>& phases)
+void SplitConstraints(ListType& joints,
+                      ConstraintGroup<typename ListType::value_type>& phases,
+                      uint batchSize = 32,
+                      uint batchesPerPhase = 2)
 {
   typedef ConstraintPhase<typename ListType::value_type> PhaseType;
   typedef ConstraintBatch<typename ListType::value_type> BatchType;
 
-  HashSet<uint> bodySet;
-  uint batchSize = 32;
-  uint batchesPerPhase = 2;
+  HashSet<RigidBody*> bodySet;
 
   PhaseType* phase = nullptr;
   BatchType* batch = nullptr;
@@ -149,6 +203,7 @@ void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value
       ++phases.PhaseCount;
       batch = new BatchType();
       phase->Batches.PushBack(batch);
+      phase->BatchArray.PushBack(batch);
       ++phase->BatchCount;
       bodySet.Clear();
     }
@@ -160,13 +215,14 @@ void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value
       typename ListType::pointer joint = &(range.Front());
       range.PopFront();
 
-      // get the id of the two bodies involved in this joint
-      uint idA = joint->GetCollider(0)->mId;
-      uint idB = joint->GetCollider(1)->mId;
+      // get the two bodies whose velocities this joint writes to
+      // (multiple colliders can share one body)
+      RigidBody* bodyA = joint->GetCollider(0)->GetActiveBody();
+      RigidBody* bodyB = joint->GetCollider(1)->GetActiveBody();
 
       // if either of the bodies have been used in this phase, then skip this
       // joint
-      if (!bodySet.Find(idA).Empty() || !bodySet.Find(idB).Empty())
+      if ((bodyA && bodySet.Contains(bodyA)) || (bodyB && bodySet.Contains(bodyB)))
         continue;
 
       // if adding this joint would make the batch too large, make a new batch
@@ -188,12 +244,15 @@ void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value
 
         batch = new BatchType();
         phase->Batches.PushBack(batch);
+        phase->BatchArray.PushBack(batch);
         ++phase->BatchCount;
       }
 
       // mark both of these bodies as being used for this phase
-      bodySet.Insert(idA);
-      bodySet.Insert(idB);
+      if (bodyA)
+        bodySet.Insert(bodyA);
+      if (bodyB)
+        bodySet.Insert(bodyB);
 
       // put the joint in this batch
       ListType::Unlink(joint);
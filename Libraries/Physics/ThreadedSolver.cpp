@@ -24,13 +24,77 @@ namespace Zero
 namespace Physics
 {
 
-template <typename JointList>
-void ThreadSolveFunction(JointList& joints, MoleculeWalker molecules, uint startIndex)
+// How many molecules are put into one batch (the unit of work given to a thread).
+const uint cThreadedBatchSize = 32;
+// How many batches a phase can hold before a new phase (and barrier) is started.
+const uint cThreadedBatchesPerPhase = 64;
+
+// Per batch operations that are run in parallel by ParallelGroupOperation.
+// Each batch walks its own molecules starting from where UpdateData placed it.
+template <typename ListType>
+struct UpdateDataBatchOperation
+{
+  void operator()(ConstraintBatch<typename ListType::value_type>& batch)
+  {
+    MoleculeWalker molecules = batch.Molecules;
+    UpdateDataFragmentList(batch.Joints, molecules);
+  }
+};
+
+template <typename ListType>
+struct WarmStartBatchOperation
+{
+  void operator()(ConstraintBatch<typename ListType::value_type>& batch)
+  {
+    MoleculeWalker molecules = batch.Molecules;
+    WarmStartFragmentList(batch.Joints, molecules);
+  }
+};
+
+template <typename ListType>
+struct IterateVelocitiesBatchOperation
+{
+  IterateVelocitiesBatchOperation(uint iteration) : mIteration(iteration)
+  {
+  }
+
+  void operator()(ConstraintBatch<typename ListType::value_type>& batch)
+  {
+    MoleculeWalker molecules = batch.Molecules;
+    IterateVelocitiesFragmentList(batch.Joints, molecules, mIteration);
+  }
+
+  uint mIteration;
+};
+
+template <typename ListType>
+struct CommitBatchOperation
 {
-  MoleculeWalker mols = molecules;
-  mols += startIndex;
+  void operator()(ConstraintBatch<typename ListType::value_type>& batch)
+  {
+    MoleculeWalker molecules = batch.Molecules;
+    CommitFragmentList(batch.Joints, molecules);
+  }
+};
+
+// Assigns each batch its start in the molecule buffer (in the same order
+// that the serial fragment operations would have walked them).
+template <typename JointType>
+void AssignBatchMolecules(ConstraintGroup<JointType>& group, MoleculeWalker& molecules)
+{
+  typedef ConstraintGroup<JointType> JointGroup;
+  typedef ConstraintPhase<JointType> JointPhase;
 
-  IterateVelocitiesFragment(joints, mols, 0);
+  typename JointGroup::PhaseTypeList::range phaseRange = group.Phases.All();
+  for (; !phaseRange.Empty(); phaseRange.PopFront())
+  {
+    JointPhase& phase = phaseRange.Front();
+    forRange (ConstraintBatch<JointType>* batch, phase.BatchArray.All())
+    {
+      batch->Molecules = molecules;
+      molecules += batch->ConstraintCount;
+    }
+  }
 }
 
 ThreadedSolver::ThreadedSolver()
@@ -121,11 +185,16 @@ void ThreadedSolver::UpdateData()
 
   MoleculeWalker molecules(mMolecules.Data(), sizeof(ConstraintMolecule), 0);
 
-  SplitConstraints(mContacts, mContactPhases);
-  SplitConstraints(mJoints, mJointPhases);
+  SplitConstraints(mContacts, mContactPhases, cThreadedBatchSize, cThreadedBatchesPerPhase);
+  SplitConstraints(mJoints, mJointPhases, cThreadedBatchSize, cThreadedBatchesPerPhase);
+
+  AssignBatchMolecules(mContactPhases, molecules);
+  AssignBatchMolecules(mJointPhases, molecules);
 
-  GroupOperationParamFragment<ContactList>(mContactPhases, molecules, UpdateDataFragmentList<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases, molecules, UpdateDataFragmentList<JointList>);
+  UpdateDataBatchOperation<ContactList> contactOperation;
+  UpdateDataBatchOperation<JointList> jointOperation;
+  ParallelGroupOperation(mContactPhases, contactOperation);
+  ParallelGroupOperation(mJointPhases, jointOperation);
 }
 
 void ThreadedSolver::WarmStart()
@@ -133,10 +202,10 @@ void ThreadedSolver::WarmStart()
   if (mSolverConfig->mWarmStart == false)
     return;
 
-  MoleculeWalker molecules(mMolecules.Data(), sizeof(ConstraintMolecule), 0);
-
-  GroupOperationParamFragment<ContactList>(mContactPhases, molecules, WarmStartFragmentList<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases, molecules, WarmStartFragmentList<JointList>);
+  WarmStartBatchOperation<ContactList> contactOperation;
+  WarmStartBatchOperation<JointList> jointOperation;
+  ParallelGroupOperation(mContactPhases, contactOperation);
+  ParallelGroupOperation(mJointPhases, jointOperation);
 }
 
 void ThreadedSolver::SolveVelocities()
@@ -148,12 +217,12 @@ void ThreadedSolver::SolveVelocities()
 
 void ThreadedSolver::IterateVelocities(uint iteration)
 {
-  MoleculeWalker molecules(mMolecules.Data(), sizeof(ConstraintMolecule), 0);
-
-  GroupOperationTwoParamFragment<ContactList>(
-      mContactPhases, molecules, iteration, IterateVelocitiesFragmentList<ContactList>);
-  GroupOperationTwoParamFragment<JointList>(
-      mJointPhases, molecules, iteration, IterateVelocitiesFragmentList<JointList>);
+  // Contacts and joints can share bodies, so all contact
+  // phases finish before any joint phase starts.
+  IterateVelocitiesBatchOperation<ContactList> contactOperation(iteration);
+  IterateVelocitiesBatchOperation<JointList> jointOperation(iteration);
+  ParallelGroupOperation(mContactPhases, contactOperation);
+  ParallelGroupOperation(mJointPhases, jointOperation);
 }
 
 void ThreadedSolver::SolvePositions()
@@ -192,10 +261,10 @@ void ThreadedSolver::SolvePositions()
 
 void ThreadedSolver::Commit()
 {
-  MoleculeWalker molecules(mMolecules.Data(), sizeof(ConstraintMolecule), 0);
-
-  GroupOperationParamFragment<ContactList>(mContactPhases, molecules, CommitFragmentList<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases, molecules, CommitFragmentList<JointList>);
+  CommitBatchOperation<ContactList> contactOperation;
+  CommitBatchOperation<JointList> jointOperation;
+  ParallelGroupOperation(mContactPhases, contactOperation);
+  ParallelGroupOperation(mJointPhases, jointOperation);
 }
 
 void ThreadedSolver::BatchEvents()
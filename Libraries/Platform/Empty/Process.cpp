@@ -70,6 +70,11 @@ bool Process::IsStandardInRedirected()
   return false;
 }
 
+OsInt Process::GetCurrentProcessId()
+{
+  return 0;
+}
+
 void GetProcesses(Array<ProcessInfo>& results)
 {
 }
@@ -360,6 +360,11 @@ bool Socket::IsCommonConnectError(int extendedErrorCode)
   return false;
 }
 
+bool Socket::SupportsDatagramBatching()
+{
+  return false;
+}
+
 bool Socket::IsSocketLibraryInitialized()
 {
   return false;
@@ -519,6 +524,19 @@ Socket::ReceiveFrom(Status& status, byte* dataOut, size_t dataLength, SocketAddr
   return 0;
 }
 
+size_t Socket::SendToBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+  status.SetFailed("Socket not implemented");
+  return 0;
+}
+
+size_t
+Socket::ReceiveFromBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+  status.SetFailed("Socket not implemented");
+  return 0;
+}
+
 bool Socket::Select(Status& status, SocketSelect::Enum selectMode, float timeoutSeconds) const
 {
   status.SetFailed("Socket not implemented");
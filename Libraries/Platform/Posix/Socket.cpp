@@ -1107,6 +1107,15 @@ bool Socket::IsCommonConnectError(int extendedErrorCode)
   }
 }
 
+bool Socket::SupportsDatagramBatching()
+{
+#if defined(__linux__)
+  return true;
+#else
+  return false;
+#endif
+}
+
 bool Socket::IsSocketLibraryInitialized()
 {
   return gSocketLibrary.IsInitialized();
@@ -1451,6 +1460,129 @@ Socket::ReceiveFrom(Status& status, byte* dataOut, size_t dataLength, SocketAddr
   return result;
 }
 
+#if defined(__linux__)
+/// Maximum number of datagrams passed to a single sendmmsg/recvmmsg call
+static const size_t cMaxDatagramBatchSize = 64;
+
+/// Describes the datagrams as messages for sendmmsg/recvmmsg
+static void FillDatagramMessages(SocketDatagram* datagrams, size_t datagramCount, mmsghdr* messages, iovec* buffers)
+{
+  memset(messages, 0, sizeof(mmsghdr) * datagramCount);
+  for (size_t i = 0; i < datagramCount; ++i)
+  {
+    SocketDatagram& datagram = datagrams[i];
+    buffers[i].iov_base = datagram.mData;
+    buffers[i].iov_len = datagram.mDataLength;
+
+    msghdr& header = messages[i].msg_hdr;
+    header.msg_name = (SOCKET_ADDRESS_STORAGE*)datagram.mAddress.mPrivateData;
+    header.msg_namelen = sizeof(SOCKET_ADDRESS_STORAGE);
+    header.msg_iov = &buffers[i];
+    header.msg_iovlen = 1;
+  }
+}
+#endif
+
+size_t Socket::SendToBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+#if defined(__linux__)
+  // Translate platform-specific enums as necessary
+  TRANSLATE_TO_PLATFORM_ENUM_OR_RETURN_FAILURE_VALUE(flags, 0);
+
+  // Send datagrams over socket in batches
+  size_t datagramsAttempted = 0;
+  size_t datagramsSent = 0;
+  while (datagramsAttempted < datagramCount)
+  {
+    mmsghdr messages[cMaxDatagramBatchSize];
+    iovec buffers[cMaxDatagramBatchSize];
+    size_t batchSize = datagramCount - datagramsAttempted;
+    if (batchSize > cMaxDatagramBatchSize)
+      batchSize = cMaxDatagramBatchSize;
+    FillDatagramMessages(datagrams + datagramsAttempted, batchSize, messages, buffers);
+
+    // (Sends fewer datagrams than requested if a later datagram fails, the
+    // next call will then report the error)
+    int result = sendmmsg(CAST_HANDLE_TO_SOCKET(mHandle), messages, (unsigned int)batchSize, (int)flags);
+    if (result == SOCKET_ERROR) // Unable?
+    {
+      // Skip the datagram that failed and continue with the rest
+      FailOnLastError(status);
+      datagrams[datagramsAttempted].mBytesTransferred = 0;
+      ++datagramsAttempted;
+      continue;
+    }
+
+    for (int i = 0; i < result; ++i)
+      datagrams[datagramsAttempted + i].mBytesTransferred = messages[i].msg_len;
+    datagramsAttempted += result;
+    datagramsSent += result;
+  }
+
+  return datagramsSent;
+#else
+  // Send each datagram individually
+  size_t datagramsSent = 0;
+  for (size_t i = 0; i < datagramCount; ++i)
+  {
+    // (Failed datagrams are skipped, status will contain the last error)
+    SocketDatagram& datagram = datagrams[i];
+    datagram.mBytesTransferred = SendTo(status, datagram.mData, datagram.mDataLength, datagram.mAddress, flags);
+    if (datagram.mBytesTransferred != 0) // Successful?
+      ++datagramsSent;
+  }
+
+  return datagramsSent;
+#endif
+}
+
+size_t
+Socket::ReceiveFromBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+#if defined(__linux__)
+  // Translate platform-specific enums as necessary
+  TRANSLATE_TO_PLATFORM_ENUM_OR_RETURN_FAILURE_VALUE(flags, 0);
+
+  if (datagramCount == 0)
+    return 0;
+
+  // Receive datagrams over socket from any remote address
+  // (Blocks for the first datagram, then takes only those already available)
+  mmsghdr messages[cMaxDatagramBatchSize];
+  iovec buffers[cMaxDatagramBatchSize];
+  size_t batchSize = datagramCount;
+  if (batchSize > cMaxDatagramBatchSize)
+    batchSize = cMaxDatagramBatchSize;
+  FillDatagramMessages(datagrams, batchSize, messages, buffers);
+
+  int result =
+      recvmmsg(CAST_HANDLE_TO_SOCKET(mHandle), messages, (unsigned int)batchSize, (int)flags | MSG_WAITFORONE, nullptr);
+  if (result == SOCKET_ERROR) // Unable?
+  {
+    FailOnLastError(status);
+    return 0;
+  }
+
+  for (int i = 0; i < result; ++i)
+    datagrams[i].mBytesTransferred = messages[i].msg_len;
+
+  // Success
+  return result;
+#else
+  // Receive a single datagram
+  if (datagramCount == 0)
+    return 0;
+
+  SocketDatagram& datagram = datagrams[0];
+  datagram.mBytesTransferred = ReceiveFrom(status, datagram.mData, datagram.mDataLength, datagram.mAddress, flags);
+  if (status.Failed()) // Unable?
+    return 0;
+
+  // Success
+  return 1;
+#endif
+}
+
 bool Socket::Select(Status& status, SocketSelect::Enum selectMode, float timeoutSeconds) const
 {
   // Configure select timeout
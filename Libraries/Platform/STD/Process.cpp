@@ -2,6 +2,8 @@
 
 #include "Precompiled.hpp"
 
+#include <unistd.h>
+
 // For platforms where we haven't ported the executables over, but they have an
 // emulator, we can fill this string out (must have a trailing space, e.g. "wine
 // ");
@@ -128,6 +130,11 @@ bool Process::IsStandardInRedirected()
   return false;
 }
 
+OsInt Process::GetCurrentProcessId()
+{
+  return (OsInt)getpid();
+}
+
 void GetProcesses(Array<ProcessInfo>& results)
 {
   // Unsupported. When we get our current executable from the
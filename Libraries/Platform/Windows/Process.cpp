@@ -272,6 +272,11 @@ bool Process::IsStandardInRedirected()
   return self->mStandardIn == cInvalidHandle;
 }
 
+OsInt Process::GetCurrentProcessId()
+{
+  return (OsInt)::GetCurrentProcessId();
+}
+
 // Global Functions/Helpers
 inline void GetProcessNameAndId(DWORD processID, String& processName, String& processPath)
 {
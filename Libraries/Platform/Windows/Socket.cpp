@@ -986,6 +986,11 @@ bool Socket::IsCommonConnectError(int extendedErrorCode)
   }
 }
 
+bool Socket::SupportsDatagramBatching()
+{
+  return false;
+}
+
 bool Socket::IsSocketLibraryInitialized()
 {
   return gSocketLibrary.IsInitialized();
@@ -1322,6 +1327,38 @@ Socket::ReceiveFrom(Status& status, byte* dataOut, size_t dataLength, SocketAddr
   return result;
 }
 
+size_t Socket::SendToBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+  // Send each datagram individually
+  size_t datagramsSent = 0;
+  for (size_t i = 0; i < datagramCount; ++i)
+  {
+    // (Failed datagrams are skipped, status will contain the last error)
+    SocketDatagram& datagram = datagrams[i];
+    datagram.mBytesTransferred = SendTo(status, datagram.mData, datagram.mDataLength, datagram.mAddress, flags);
+    if (datagram.mBytesTransferred != 0) // Successful?
+      ++datagramsSent;
+  }
+
+  return datagramsSent;
+}
+
+size_t
+Socket::ReceiveFromBatch(Status& status, SocketDatagram* datagrams, size_t datagramCount, SocketFlags::Enum flags)
+{
+  // Receive a single datagram
+  if (datagramCount == 0)
+    return 0;
+
+  SocketDatagram& datagram = datagrams[0];
+  datagram.mBytesTransferred = ReceiveFrom(status, datagram.mData, datagram.mDataLength, datagram.mAddress, flags);
+  if (status.Failed()) // Unable?
+    return 0;
+
+  // Success
+  return 1;
+}
+
 bool Socket::Select(Status& status, SocketSelect::Enum selectMode, float timeoutSeconds) const
 {
   // Configure select timeout
@@ -0,0 +1,172 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+//                              Delta Compression //
+
+/// Smallest three components are bound within [-1/sqrt(2), 1/sqrt(2)]
+/// (Any component smaller than the largest component must be within this
+/// range for a unit quaternion)
+static const float cSmallestThreeBound = 0.70710678f;
+static const uint32 cSmallestThreeMax = (uint32(1) << cSmallestThreeComponentBits) - 1;
+
+/// Returns the 32-bit word of the data at the specified byte offset
+/// (Bytes past the end of the data are treated as zero)
+static uint32 ReadDeltaWord(const byte* data, Bytes offset, Bytes dataBytes)
+{
+  uint32 word = 0;
+  for (Bytes i = 0; i < 4 && offset + i < dataBytes; ++i)
+    word |= uint32(data[offset + i]) << (i * 8);
+  return word;
+}
+
+Bits WriteSmallestThree(BitStream& bitStream, QuatParam value)
+{
+  const Bits bitsWrittenStart = bitStream.GetBitsWritten();
+
+  // Normalize rotation
+  // (A zero quaternion is written as the identity rotation)
+  Quat rotation = value;
+  if (rotation.LengthSq() == 0.0f)
+    rotation = Quat::cIdentity;
+  else
+    rotation.Normalize();
+
+  // Find the largest component
+  uint largestIndex = 0;
+  for (uint i = 1; i < 4; ++i)
+    if (Math::Abs(rotation[i]) > Math::Abs(rotation[largestIndex]))
+      largestIndex = i;
+
+  // Make the largest component positive so its sign can be omitted
+  // (q and -q represent the same rotation)
+  if (rotation[largestIndex] < 0.0f)
+    rotation = -rotation;
+
+  // Write largest component index
+  bitStream.WriteQuantized(uint32(largestIndex), uint32(0), uint32(3));
+
+  // Write the smallest three components
+  for (uint i = 0; i < 4; ++i)
+  {
+    if (i == largestIndex)
+      continue;
+
+    float component = Math::Clamp(rotation[i], -cSmallestThreeBound, cSmallestThreeBound);
+    float normalized = (component + cSmallestThreeBound) / (2.0f * cSmallestThreeBound);
+    uint32 quantized = uint32(Math::Round(normalized * float(cSmallestThreeMax)));
+    bitStream.WriteQuantized(quantized, uint32(0), cSmallestThreeMax);
+  }
+
+  // Success
+  return bitStream.GetBitsWritten() - bitsWrittenStart;
+}
+bool ReadSmallestThree(const BitStream& bitStream, Quat& value)
+{
+  // Read largest component index
+  uint32 largestIndex = 0;
+  if (!bitStream.ReadQuantized(largestIndex, uint32(0), uint32(3))) // Unable?
+    return false;
+
+  // Read the smallest three components
+  float sumSquared = 0.0f;
+  for (uint i = 0; i < 4; ++i)
+  {
+    if (i == largestIndex)
+      continue;
+
+    uint32 quantized = 0;
+    if (!bitStream.ReadQuantized(quantized, uint32(0), cSmallestThreeMax)) // Unable?
+      return false;
+
+    float normalized = float(quantized) / float(cSmallestThreeMax);
+    value[i] = normalized * (2.0f * cSmallestThreeBound) - cSmallestThreeBound;
+    sumSquared += value[i] * value[i];
+  }
+
+  // Reconstruct the largest component
+  value[largestIndex] = Math::Sqrt(Math::Max(1.0f - sumSquared, 0.0f));
+
+  // Success
+  return true;
+}
+
+Bits WriteDelta(BitStream& bitStream, const BitStream& baseline, const BitStream& state)
+{
+  // (States should be the same length)
+  Assert(baseline.GetBitsWritten() == state.GetBitsWritten());
+
+  const Bits bitsWrittenStart = bitStream.GetBitsWritten();
+
+  // For each 32-bit word
+  const byte* baselineData = baseline.GetData();
+  const byte* stateData = state.GetData();
+  Bytes dataBytes = state.GetBytesWritten();
+  for (Bytes offset = 0; offset < dataBytes; offset += 4)
+  {
+    // Get the bits that differ from the baseline
+    uint32 difference = ReadDeltaWord(stateData, offset, dataBytes) ^ ReadDeltaWord(baselineData, offset, dataBytes);
+
+    // Write 'Has Changed?' Flag
+    bool hasChanged = (difference != 0);
+    bitStream.Write(hasChanged);
+    if (hasChanged) // Has changed?
+    {
+      // Write only the significant bits of the difference
+      uint32 significantBits = uint32(BitsNeededToRepresent(difference));
+      bitStream.WriteQuantized(significantBits - 1, uint32(0), uint32(31));
+      bitStream.WriteQuantized(difference, uint32(0), uint32(0xFFFFFFFF >> (32 - significantBits)));
+    }
+  }
+
+  // Success
+  return bitStream.GetBitsWritten() - bitsWrittenStart;
+}
+bool ReadDelta(const BitStream& bitStream, const BitStream& baseline, BitStream& state)
+{
+  // For each 32-bit word
+  const byte* baselineData = baseline.GetData();
+  Bytes dataBytes = baseline.GetBytesWritten();
+  Array<byte> stateData;
+  stateData.Resize(dataBytes);
+  for (Bytes offset = 0; offset < dataBytes; offset += 4)
+  {
+    // Read 'Has Changed?' Flag
+    bool hasChanged = false;
+    if (!bitStream.Read(hasChanged)) // Unable?
+      return false;
+
+    // Read the bits that differ from the baseline
+    uint32 difference = 0;
+    if (hasChanged) // Has changed?
+    {
+      uint32 significantBits = 0;
+      if (!bitStream.ReadQuantized(significantBits, uint32(0), uint32(31))) // Unable?
+        return false;
+      ++significantBits;
+
+      if (!bitStream.ReadQuantized(difference, uint32(0), uint32(0xFFFFFFFF >> (32 - significantBits)))) // Unable?
+        return false;
+    }
+
+    // Apply the difference to the baseline
+    uint32 word = ReadDeltaWord(baselineData, offset, dataBytes) ^ difference;
+    for (Bytes i = 0; i < 4 && offset + i < dataBytes; ++i)
+      stateData[offset + i] = byte(word >> (i * 8));
+  }
+
+  // Write state
+  // (The state is exactly as long as the baseline, any padding bits are
+  // trimmed)
+  state.Clear(false);
+  if (dataBytes)
+    state.WriteBytes(stateData.Data(), dataBytes);
+  state.SetBitsWritten(baseline.GetBitsWritten());
+
+  // Success
+  return true;
+}
+
+} // namespace Zero
@@ -0,0 +1,140 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+//                              Delta Compression //
+
+/// Snapshot ID, identifies a delta compressed replica channel change
+/// (Wraps around, compared using IsSnapshotNewer)
+typedef uint16 SnapshotId;
+
+/// Maximum number of snapshots between a delta compressed snapshot and its
+/// baseline (Written as the baseline distance, 0 indicates a keyframe)
+static const uint cMaxBaselineDistance = 31;
+/// Number of bits used to write the baseline distance
+static const Bits cBaselineDistanceBits = 5;
+/// Number of snapshots kept for use as baselines
+/// (Must be greater than the maximum baseline distance)
+static const uint cSnapshotHistorySize = 32;
+/// Number of snapshots sent between keyframes
+/// (Keyframes let a link recover from snapshots lost after being acknowledged)
+static const uint cKeyframeInterval = 32;
+
+/// Number of bits used to write each of the smallest three quaternion
+/// components
+static const Bits cSmallestThreeComponentBits = 10;
+
+/// Returns true if snapshot ID a is newer than snapshot ID b, else false
+/// (Accounts for wrap around)
+inline bool IsSnapshotNewer(SnapshotId a, SnapshotId b)
+{
+  return int16(SnapshotId(a - b)) > 0;
+}
+
+/// Writes a rotation quaternion using the smallest three encoding (the index
+/// of the largest component followed by the other three components quantized
+/// within [-1/sqrt(2), 1/sqrt(2)])
+/// Returns the number of bits written
+Bits WriteSmallestThree(BitStream& bitStream, QuatParam value);
+/// Reads a rotation quaternion written using the smallest three encoding
+/// Returns true if successful, else false
+bool ReadSmallestThree(const BitStream& bitStream, Quat& value);
+
+/// Writes the state as the bitwise difference from the baseline state
+/// (Unchanged 32-bit words cost a single bit, changed words only write their
+/// significant bits) (The states must be the same length)
+/// Returns the number of bits written
+Bits WriteDelta(BitStream& bitStream, const BitStream& baseline, const BitStream& state);
+/// Reads a state written as the bitwise difference from the baseline state
+/// (The state will be the same length as the baseline)
+/// Returns true if successful, else false
+bool ReadDelta(const BitStream& bitStream, const BitStream& baseline, BitStream& state);
+
+//                             OutDeltaSnapshot //
+
+/// Outgoing Delta Snapshot
+/// Snapshot sent to a replicator link awaiting a receipt
+struct OutDeltaSnapshot
+{
+  /// Constructor
+  OutDeltaSnapshot() : mSnapshotId(0), mReceiptId(0), mState()
+  {
+  }
+
+  /// Data
+  SnapshotId mSnapshotId;      /// Snapshot ID
+  MessageReceiptId mReceiptId; /// Change message receipt ID
+  BitStream mState;            /// Full replica channel state
+};
+
+//                              OutDeltaChannel //
+
+/// Outgoing Delta Channel
+/// Delta compression state of a replica channel sent to a replicator link
+struct OutDeltaChannel
+{
+  /// Constructor
+  OutDeltaChannel() : mNextSnapshotId(0), mHasBaseline(false), mBaselineId(0), mBaseline(), mPendingSnapshots()
+  {
+  }
+
+  /// Data
+  SnapshotId mNextSnapshotId;                /// Next snapshot ID to send
+  bool mHasBaseline;                         /// Has an acknowledged baseline?
+  SnapshotId mBaselineId;                    /// Last acknowledged snapshot ID
+  BitStream mBaseline;                       /// Last acknowledged replica channel state
+  Array<OutDeltaSnapshot> mPendingSnapshots; /// Snapshots awaiting a receipt (oldest first)
+};
+
+//                              InDeltaChannel //
+
+/// Incoming Delta Channel
+/// Delta compression state of a replica channel received from a replicator link
+struct InDeltaChannel
+{
+  /// Constructor
+  InDeltaChannel() : mHasLatest(false), mLatestId(0)
+  {
+    for (uint i = 0; i < cSnapshotHistorySize; ++i)
+      mHasSnapshot[i] = false;
+  }
+
+  /// Returns the received snapshot state with the specified ID, else nullptr
+  const BitStream* GetSnapshot(SnapshotId snapshotId) const
+  {
+    uint index = snapshotId % cSnapshotHistorySize;
+    if (!mHasSnapshot[index] || mSnapshotIds[index] != snapshotId)
+      return nullptr;
+    return &mSnapshots[index];
+  }
+  /// Stores the received snapshot state (replaces the oldest snapshot)
+  /// Returns false if the snapshot is older than the snapshot it would
+  /// replace (arrived too late to be kept as a baseline), else true
+  bool SetSnapshot(SnapshotId snapshotId, const BitStream& state)
+  {
+    uint index = snapshotId % cSnapshotHistorySize;
+    if (mHasSnapshot[index] && !IsSnapshotNewer(snapshotId, mSnapshotIds[index])) // Older or the same?
+      return mSnapshotIds[index] == snapshotId;
+
+    mHasSnapshot[index] = true;
+    mSnapshotIds[index] = snapshotId;
+    mSnapshots[index] = state;
+    return true;
+  }
+
+  /// Data
+  bool mHasLatest;                               /// Has applied a snapshot?
+  SnapshotId mLatestId;                          /// Latest snapshot ID applied
+  bool mHasSnapshot[cSnapshotHistorySize];       /// Snapshot history slot used?
+  SnapshotId mSnapshotIds[cSnapshotHistorySize]; /// Snapshot history IDs
+  BitStream mSnapshots[cSnapshotHistorySize];    /// Snapshot history states (baselines)
+};
+
+/// Typedefs
+typedef HashMap<ReplicaChannel*, OutDeltaChannel> OutDeltaChannels;
+typedef HashMap<ReplicaChannel*, InDeltaChannel> InDeltaChannels;
+typedef ArrayMap<MessageReceiptId, ReplicaChannel*> DeltaReceipts;
+
+} // namespace Zero
@@ -24,7 +24,8 @@ LinkInbox::LinkInbox(PeerLink* link)
 
     /// Message Data
     mReleasedCustomMessages(),
-    mReleasedProtocolMessages()
+    mReleasedProtocolMessages(),
+    mChannelMessages()
 {
 }
 
@@ -48,7 +49,8 @@ LinkInbox::LinkInbox(MoveReference<LinkInbox> rhs)
 
     /// Message Data
     mReleasedCustomMessages(ZeroMove(rhs->mReleasedCustomMessages)),
-    mReleasedProtocolMessages(ZeroMove(rhs->mReleasedProtocolMessages))
+    mReleasedProtocolMessages(ZeroMove(rhs->mReleasedProtocolMessages)),
+    mChannelMessages(ZeroMove(rhs->mChannelMessages))
 {
 }
 
@@ -73,6 +75,7 @@ LinkInbox& LinkInbox::operator=(MoveReference<LinkInbox> rhs)
   /// Message Data
   mReleasedCustomMessages = ZeroMove(rhs->mReleasedCustomMessages);
   mReleasedProtocolMessages = ZeroMove(rhs->mReleasedProtocolMessages);
+  mChannelMessages = ZeroMove(rhs->mChannelMessages);
 
   return *this;
 }
@@ -131,6 +134,11 @@ void LinkInbox::ReceivePacket(MoveReference<InPacket> packet)
     // Process packet next inbox update
     mReceivedPackets.PushBack(ZeroMove(packet));
   }
+  else
+  {
+    // Recycle empty message list
+    mLink->GetBufferPool().ReleaseMessageList(packet->GetMessages());
+  }
 
   // Set last packet receive time
   mLastReceiveTime = mLink->GetLocalTime();
@@ -138,6 +146,8 @@ void LinkInbox::ReceivePacket(MoveReference<InPacket> packet)
 
 void LinkInbox::Update(ACKArray& remoteACKs, NAKArray& remoteNAKs)
 {
+  MessageBufferPool& bufferPool = mLink->GetBufferPool();
+
   //
   // Process Incoming Packets
   //
@@ -152,7 +162,11 @@ void LinkInbox::Update(ACKArray& remoteACKs, NAKArray& remoteNAKs)
 
     // Attempt to add packet to sequence
     if (!mIncomingPacketSequence.Add(packet.GetSequenceId())) // Is network-duplicate?
-      continue;                                               // Ignore packet
+    {
+      // Ignore packet
+      bufferPool.ReleaseMessageList(packet.GetMessages());
+      continue;
+    }
 
     //
     // Process Incoming Messages
@@ -283,7 +297,8 @@ void LinkInbox::Update(ACKArray& remoteACKs, NAKArray& remoteNAKs)
           break; // Ignore message
 
         // Attempt to push message into channel for later release
-        channel->Push(ZeroMove(message));
+        // (Fragments are reassembled using the link's buffer pool)
+        channel->Push(ZeroMove(message), &bufferPool);
       }
       break;
       }
@@ -303,8 +318,8 @@ void LinkInbox::Update(ACKArray& remoteACKs, NAKArray& remoteNAKs)
         if (updatedChannel != mChannels.End()) // Found?
         {
           // Release pending messages
-          Array<Message> releasedMessages = updatedChannel->Release();
-          ReleaseCustomMessages(releasedMessages);
+          updatedChannel->Release(mChannelMessages);
+          ReleaseCustomMessages(mChannelMessages);
 
           // Channel ready to delete?
           if (updatedChannel->ReadyToDelete())
@@ -321,16 +336,20 @@ void LinkInbox::Update(ACKArray& remoteACKs, NAKArray& remoteNAKs)
       else
       {
         // Release pending custom messages
-        Array<Message> customReleasedMessages = mCustomDefaultChannel.Release();
-        ReleaseCustomMessages(customReleasedMessages);
+        mCustomDefaultChannel.Release(mChannelMessages);
+        ReleaseCustomMessages(mChannelMessages);
 
         // Release pending protocol messages
-        Array<Message> protocolReleasedMessages = mProtocolDefaultChannel.Release();
-        ReleaseProtocolMessages(protocolReleasedMessages);
+        mProtocolDefaultChannel.Release(mChannelMessages);
+        ReleaseProtocolMessages(mChannelMessages);
       }
 
     } // (For every message)
 
+    // Recycle the packet's message list
+    // (Along with the buffers of any messages that were not taken)
+    bufferPool.ReleaseMessageList(packet.GetMessages());
+
   } // (For every packet)
   mReceivedPackets.Clear();
 
@@ -373,7 +392,10 @@ void LinkInbox::ReleaseCustomMessages(Array<Message>& messages)
 
     // [Link Plugin Event] Stop?
     if (!mLink->PluginEventOnMessageReceive(message))
+    {
+      mLink->GetBufferPool().ReleaseBuffer(message.GetData());
       continue;
+    }
 
     // Release custom message
     mReleasedCustomMessages.PushBack(ZeroMove(message));
@@ -390,7 +412,10 @@ void LinkInbox::ReleaseProtocolMessages(Array<Message>& messages)
 
     // [Link Plugin Event] Stop?
     if (!mLink->PluginEventOnMessageReceive(message))
+    {
+      mLink->GetBufferPool().ReleaseBuffer(message.GetData());
       continue;
+    }
 
     // Release protocol message
     mReleasedProtocolMessages.PushBack(ZeroMove(message));
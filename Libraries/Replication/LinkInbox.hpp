@@ -76,6 +76,7 @@ class LinkInbox
   /// Message Data
   Array<Message> mReleasedCustomMessages;   /// Released custom messages
   Array<Message> mReleasedProtocolMessages; /// Released protocol messages
+  Array<Message> mChannelMessages;          /// Messages released by a channel (reused scratch list)
 
   /// Friends
   friend class PeerLink;
@@ -360,6 +360,9 @@ void LinkOutbox::ACKSentPacket(const ArraySet<OutPacket>::iterator& sentPacketIt
   // Acknowledge packet
   AcknowledgePacket(*sentPacketIter, ACKState::ACKd);
 
+  // Recycle message list
+  mLink->GetBufferPool().ReleaseMessageList(sentPacketIter->GetMessages());
+
   // Remove packet
   mSentPackets.Erase(sentPacketIter);
 }
@@ -377,6 +380,8 @@ void LinkOutbox::NAKSentPacket(ArraySet<OutPacket>::iterator& sentPacketIter)
   // Still has messages?
   if (sentPacketIter->HasMessages())
     mResendPackets.PushBack(ZeroMove(*sentPacketIter)); // Move to resend packets
+  else
+    mLink->GetBufferPool().ReleaseMessageList(sentPacketIter->GetMessages()); // Recycle message list
 
   // Remove packet
   sentPacketIter = mSentPackets.Erase(sentPacketIter);
@@ -476,16 +481,18 @@ MessageReceiptId LinkOutbox::PushMessage(Status& status,
   // Reset message data read cursor (just in case it was touched)
   message->GetData().ClearBitsRead();
 
-  // Push new outgoing message to be sent later
-  mOutMessages.Insert(OutMessagePtr(new OutMessage(ZeroMove(message),
-                                                   reliable,
-                                                   channelId,
-                                                   sequenceId,
-                                                   transferMode,
-                                                   receiptId,
-                                                   priority,
-                                                   lifetime,
-                                                   mLink->GetLocalTime())));
+  // Push new (pooled) outgoing message to be sent later
+  OutMessage* outMessage = mLink->GetBufferPool().AcquireOutMessage();
+  *outMessage = OutMessage(ZeroMove(message),
+                           reliable,
+                           channelId,
+                           sequenceId,
+                           transferMode,
+                           receiptId,
+                           priority,
+                           lifetime,
+                           mLink->GetLocalTime());
+  mOutMessages.Insert(OutMessagePtr(outMessage));
 
   // Success
   return receiptId;
@@ -589,7 +596,7 @@ LinkOutbox::WriteMessage(OutPacket& packet, OutMessage& message, Bits& remBits,
     if (message.IsFragment())
     {
       // Make final fragment
-      message.mData.TrimFront();
+      mLink->GetBufferPool().TrimFront(message.mData);
       message.mIsFinalFragment = true;
 
       // Write final fragment message
@@ -621,7 +628,7 @@ LinkOutbox::WriteMessage(OutPacket& packet, OutMessage& message, Bits& remBits,
         return PacketWriteResult::Done_Rejected;
 
       // Take message fragment
-      OutMessage fragment = message.TakeFragment(remBits - messageAsFragmentHeaderSize);
+      OutMessage fragment = message.TakeFragment(remBits - messageAsFragmentHeaderSize, &mLink->GetBufferPool());
       Bits fragmentSize = fragment.GetTotalBits();
 
       // Update remaining bits
@@ -642,6 +649,7 @@ LinkOutbox::WriteMessage(OutPacket& packet, OutMessage& message, Bits& remBits,
 void LinkOutbox::Update(const ACKArray& remoteACKs, const NAKArray& remoteNAKs)
 {
   TimeMs now = mLink->GetLocalTime();
+  MessageBufferPool& bufferPool = mLink->GetBufferPool();
 
   //
   // Handle Packet Acknowledgements
@@ -691,6 +699,7 @@ void LinkOutbox::Update(const ACKArray& remoteACKs, const NAKArray& remoteNAKs)
     // Create Packet
     //
     OutPacket newPacket(mLink->GetTheirIpAddress(), false, ++mNextSequenceId);
+    bufferPool.AcquireMessageList(newPacket.GetMessages());
     const Bits packetDataSizeLimit = BYTES_TO_BITS(mLink->GetPacketDataBytes());
     Bits remBits = packetDataSizeLimit;
 
@@ -719,7 +728,12 @@ void LinkOutbox::Update(const ACKArray& remoteACKs, const NAKArray& remoteNAKs)
 
         // Write message to packet, done with this message?
         if (WriteMessageToPacket(newPacket, remBits, message, &resendPacket))
+        {
+          // Recycle buffer (if the packet did not take it)
+          bufferPool.ReleaseBuffer(message.GetData());
+
           resendMessageIter = resendMessages.Erase(resendMessageIter); // Erase and advance
+        }
         else
           ++resendMessageIter; // Advance
 
@@ -727,7 +741,12 @@ void LinkOutbox::Update(const ACKArray& remoteACKs, const NAKArray& remoteNAKs)
 
       // Resend packet is empty?
       if (resendMessages.Empty())
+      {
+        // Recycle message list
+        bufferPool.ReleaseMessageList(resendMessages);
+
         resendPacketIter = mResendPackets.Erase(resendPacketIter); // Erase and advance
+      }
       else
         ++resendPacketIter; // Advance
 
@@ -751,7 +770,12 @@ void LinkOutbox::Update(const ACKArray& remoteACKs, const NAKArray& remoteNAKs)
 
       // Write message to packet, done with this message?
       if (WriteMessageToPacket(newPacket, remBits, message))
+      {
+        // Recycle outgoing message
+        bufferPool.ReleaseOutMessage((iter - 1)->Release());
+
         iter = mOutMessages.Erase(iter - 1); // Erase and advance
+      }
       else
         --iter; // Advance
 
@@ -761,8 +785,13 @@ void LinkOutbox::Update(const ACKArray& remoteACKs, const NAKArray& remoteNAKs)
     if (newPacket.HasMessages() || GetDuration(mLastSendTime, now) > RATE_TO_INTERVAL(mLink->GetHeartbeatPacketRate()))
       SendPacket(ZeroMove(newPacket)); // Send new Packet
     else
+    {
       --mNextSequenceId; // Nothing to send, revert unused sequence ID
 
+      // Recycle message list
+      bufferPool.ReleaseMessageList(newPacket.GetMessages());
+    }
+
     // Advance
     --outPacketCount;
 
@@ -777,7 +806,10 @@ void LinkOutbox::RemoveUnreliableMessages(OutPacket& packet)
   {
     // Is unreliable message?
     if (!iter->IsReliable())
+    {
+      mLink->GetBufferPool().ReleaseBuffer(iter->GetData());
       iter = messages.Erase(iter); // Erase and advance
+    }
     else
       ++iter; // Advance
   }
@@ -799,6 +831,9 @@ void LinkOutbox::RemoveExpiredMessages(OutPacket& packet)
       if (iter->IsReceipted())
         ReceiptMessage(ZeroMove(*iter), Receipt::EXPIRED);
 
+      // Recycle buffer (if the receipt did not take it)
+      mLink->GetBufferPool().ReleaseBuffer(iter->GetData());
+
       // Erase and advance
       iter = messages.Erase(iter);
     }
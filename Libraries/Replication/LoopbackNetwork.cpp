@@ -0,0 +1,406 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+/// Host shared by every loopback network endpoint
+static const char* cLoopbackHost = "127.0.0.1";
+/// First port chosen for endpoints added on any port
+static const uint cLoopbackFirstPort = 49152;
+
+//                             LoopbackConditions //
+
+LoopbackConditions::LoopbackConditions() :
+    mLatency(0),
+    mJitter(0),
+    mPacketLoss(0),
+    mDuplication(0),
+    mBandwidth(0),
+    mMaxQueueDelay(cOneSecondTimeMs)
+{
+}
+
+//                               LoopbackStats //
+
+LoopbackStats::LoopbackStats() :
+    mPacketsSent(0),
+    mPacketsReceived(0),
+    mPacketsLost(0),
+    mPacketsDuplicated(0),
+    mPacketsDropped(0),
+    mBytesSent(0),
+    mBytesReceived(0)
+{
+}
+
+void LoopbackStats::Add(const LoopbackStats& rhs)
+{
+  mPacketsSent += rhs.mPacketsSent;
+  mPacketsReceived += rhs.mPacketsReceived;
+  mPacketsLost += rhs.mPacketsLost;
+  mPacketsDuplicated += rhs.mPacketsDuplicated;
+  mPacketsDropped += rhs.mPacketsDropped;
+  mBytesSent += rhs.mBytesSent;
+  mBytesReceived += rhs.mBytesReceived;
+}
+
+//                              LoopbackNetwork //
+
+LoopbackNetwork::LoopbackEndpoint::LoopbackEndpoint() :
+    mIpAddress(),
+    mHasConditions(false),
+    mConditions(),
+    mUplinkFreeTime(0),
+    mPackets(),
+    mStats()
+{
+}
+
+LoopbackNetwork::LoopbackNetwork(uint seed) :
+    mLock(),
+    mTimer(),
+    mRandom(seed),
+    mDefaultConditions(),
+    mEndpoints(),
+    mNextPort(cLoopbackFirstPort)
+{
+}
+
+LoopbackNetwork::~LoopbackNetwork()
+{
+  // (Peers should close before their network is destroyed)
+  Assert(mEndpoints.Empty());
+
+  forRange (LoopbackEndpoint* endpoint, mEndpoints.Values())
+    delete endpoint;
+}
+
+//
+// Endpoints
+//
+
+IpAddress LoopbackNetwork::AddEndpoint(Status& status, ushort port)
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  // Choose an unused port?
+  uint endpointPort = port;
+  if (endpointPort == AnyPort)
+  {
+    // Find the next unused port
+    for (uint attempts = 0; attempts <= ushort(-1); ++attempts)
+    {
+      if (mNextPort > ushort(-1))
+        mNextPort = cLoopbackFirstPort;
+
+      if (!mEndpoints.Contains(mNextPort))
+      {
+        endpointPort = mNextPort++;
+        break;
+      }
+      ++mNextPort;
+    }
+  }
+
+  // Port unavailable?
+  if (endpointPort == AnyPort || mEndpoints.Contains(endpointPort))
+  {
+    status.SetFailed("Loopback network port is already in use");
+    return IpAddress();
+  }
+
+  // Add endpoint
+  LoopbackEndpoint* endpoint = new LoopbackEndpoint();
+  endpoint->mIpAddress = IpAddress(cLoopbackHost, endpointPort, InternetProtocol::V4);
+  endpoint->mUplinkFreeTime = UpdateTime();
+  mEndpoints.Insert(endpointPort, endpoint);
+
+  return endpoint->mIpAddress;
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+void LoopbackNetwork::RemoveEndpoint(const IpAddress& ipAddress)
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  LoopbackEndpoint* endpoint = FindEndpoint(ipAddress);
+  if (!endpoint) // Unable?
+    return;
+
+  mEndpoints.EraseValue(ipAddress.GetPort());
+  delete endpoint;
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+
+bool LoopbackNetwork::HasEndpoint(const IpAddress& ipAddress) const
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  return FindEndpoint(ipAddress) != nullptr;
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+uint LoopbackNetwork::GetEndpointCount() const
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  return mEndpoints.Size();
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+
+//
+// Conditions
+//
+
+void LoopbackNetwork::SetDefaultConditions(const LoopbackConditions& conditions)
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  mDefaultConditions = conditions;
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+LoopbackConditions LoopbackNetwork::GetDefaultConditions() const
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  return mDefaultConditions;
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+
+void LoopbackNetwork::SetEndpointConditions(const IpAddress& ipAddress, const LoopbackConditions& conditions)
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  LoopbackEndpoint* endpoint = FindEndpoint(ipAddress);
+  if (!endpoint) // Unable?
+    return;
+
+  endpoint->mHasConditions = true;
+  endpoint->mConditions = conditions;
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+void LoopbackNetwork::ClearEndpointConditions(const IpAddress& ipAddress)
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  LoopbackEndpoint* endpoint = FindEndpoint(ipAddress);
+  if (!endpoint) // Unable?
+    return;
+
+  endpoint->mHasConditions = false;
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+
+//
+// Transport
+//
+
+bool LoopbackNetwork::Send(const IpAddress& source, const IpAddress& destination, const byte* data, Bytes dataBytes)
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  // Unknown source?
+  LoopbackEndpoint* sourceEndpoint = FindEndpoint(source);
+  if (!sourceEndpoint)
+    return false;
+
+  const LoopbackConditions& conditions =
+      sourceEndpoint->mHasConditions ? sourceEndpoint->mConditions : mDefaultConditions;
+  LoopbackStats& stats = sourceEndpoint->mStats;
+  ++stats.mPacketsSent;
+  stats.mBytesSent += dataBytes;
+
+  // Unknown destination?
+  LoopbackEndpoint* destinationEndpoint = FindEndpoint(destination);
+  if (!destinationEndpoint)
+  {
+    ++stats.mPacketsDropped;
+    return true;
+  }
+
+  // Wait for the uplink to finish sending the packets ahead of this one
+  double now = UpdateTime();
+  double sendTime = Math::Max(now, sourceEndpoint->mUplinkFreeTime);
+  if (conditions.mBandwidth)
+  {
+    // Queue full?
+    if (sendTime - now > double(conditions.mMaxQueueDelay))
+    {
+      ++stats.mPacketsDropped;
+      return true;
+    }
+
+    // Occupy the uplink while the packet is sent
+    sendTime += double(BYTES_TO_BITS(dataBytes)) * double(cOneSecondTimeMs) / double(conditions.mBandwidth);
+    sourceEndpoint->mUplinkFreeTime = sendTime;
+  }
+
+  // Lost?
+  if (conditions.mPacketLoss > 0 && mRandom.Float() < conditions.mPacketLoss)
+  {
+    ++stats.mPacketsLost;
+    return true;
+  }
+
+  // Deliver packet after the latency (and jitter)
+  double arrivalTime = sendTime + double(conditions.mLatency);
+  Deliver(*destinationEndpoint,
+          sourceEndpoint->mIpAddress,
+          data,
+          dataBytes,
+          arrivalTime + mRandom.DoubleRange(0, double(conditions.mJitter)));
+
+  // Duplicated?
+  if (conditions.mDuplication > 0 && mRandom.Float() < conditions.mDuplication)
+  {
+    // Deliver another copy (with its own jitter)
+    ++stats.mPacketsDuplicated;
+    Deliver(*destinationEndpoint,
+            sourceEndpoint->mIpAddress,
+            data,
+            dataBytes,
+            arrivalTime + mRandom.DoubleRange(0, double(conditions.mJitter)));
+  }
+
+  return true;
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+
+uint LoopbackNetwork::Receive(const IpAddress& destination, Array<RawPacket>& rawPackets)
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  // Unknown destination?
+  LoopbackEndpoint* endpoint = FindEndpoint(destination);
+  if (!endpoint)
+    return 0;
+
+  // Take arrived packets
+  // (Packets are ordered by arrival so the arrived ones are at the front)
+  double now = UpdateTime();
+  uint arrived = 0;
+  while (arrived < endpoint->mPackets.Size() && endpoint->mPackets[arrived].mDeliveryTime <= now)
+  {
+    RawPacket& rawPacket = endpoint->mPackets[arrived].mRawPacket;
+    ++endpoint->mStats.mPacketsReceived;
+    endpoint->mStats.mBytesReceived += rawPacket.mData.GetBytesWritten();
+    rawPackets.PushBack(ZeroMove(rawPacket));
+    ++arrived;
+  }
+  endpoint->mPackets.Erase(endpoint->mPackets.SubRange(0, arrived));
+
+  return arrived;
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+
+uint LoopbackNetwork::GetPacketsInFlight() const
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  uint result = 0;
+  forRange (LoopbackEndpoint* endpoint, mEndpoints.Values())
+    result += endpoint->mPackets.Size();
+  return result;
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+
+TimeMs LoopbackNetwork::GetTime() const
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  return mTimer.UpdateAndGetTimeMilliseconds();
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+
+//
+// Statistics
+//
+
+LoopbackStats LoopbackNetwork::GetStats(const IpAddress& ipAddress) const
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  LoopbackEndpoint* endpoint = FindEndpoint(ipAddress);
+  return endpoint ? endpoint->mStats : LoopbackStats();
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+LoopbackStats LoopbackNetwork::GetTotalStats() const
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  LoopbackStats result;
+  forRange (LoopbackEndpoint* endpoint, mEndpoints.Values())
+    result.Add(endpoint->mStats);
+  return result;
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+void LoopbackNetwork::ResetStats()
+{
+  //<>-<>-<>-<>-< Network Locked >-<>-<>-<>-<>-
+  Lock lock(mLock);
+
+  forRange (LoopbackEndpoint* endpoint, mEndpoints.Values())
+    endpoint->mStats = LoopbackStats();
+
+  //-<>-<>-<>-<>-< Network Unlocked >-<>-<>-<>-<>
+}
+
+LoopbackNetwork::LoopbackEndpoint* LoopbackNetwork::FindEndpoint(const IpAddress& ipAddress) const
+{
+  LoopbackEndpoint* endpoint = mEndpoints.FindValue(ipAddress.GetPort(), nullptr);
+  if (!endpoint || endpoint->mIpAddress != ipAddress) // Unable?
+    return nullptr;
+  return endpoint;
+}
+
+double LoopbackNetwork::UpdateTime()
+{
+  return mTimer.UpdateAndGetTime() * double(cOneSecondTimeMs);
+}
+
+void LoopbackNetwork::Deliver(
+    LoopbackEndpoint& destination, const IpAddress& source, const byte* data, Bytes dataBytes, double deliveryTime)
+{
+  // Find where the packet arrives
+  // (Usually at the back, unless jitter reorders it)
+  Array<LoopbackPacket>& packets = destination.mPackets;
+  uint index = packets.Size();
+  while (index && packets[index - 1].mDeliveryTime > deliveryTime)
+    --index;
+
+  // Insert packet
+  packets.InsertAt(index, LoopbackPacket());
+  LoopbackPacket& packet = packets[index];
+  packet.mDeliveryTime = deliveryTime;
+  packet.mRawPacket.mIpAddress = source;
+  packet.mRawPacket.mData.WriteBytes(data, dataBytes);
+}
+
+} // namespace Zero
@@ -0,0 +1,182 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+//                             LoopbackConditions //
+
+/// Loopback Conditions
+/// Simulated network conditions applied to the packets sent by a loopback
+/// network endpoint
+struct LoopbackConditions
+{
+  /// Constructor
+  LoopbackConditions();
+
+  /// Data
+  TimeMs mLatency;       /// One-way delay added to every packet
+  TimeMs mJitter;        /// Maximum random delay added on top of the latency (reorders packets)
+  float mPacketLoss;     /// Chance of a packet being lost, from 0 to 1
+  float mDuplication;    /// Chance of a packet being delivered twice, from 0 to 1
+  Bits mBandwidth;       /// Maximum bits sent per second (0 is unlimited)
+  TimeMs mMaxQueueDelay; /// Packets that would wait longer than this for bandwidth are dropped
+};
+
+//                               LoopbackStats //
+
+/// Loopback Statistics
+/// Packet counters of a loopback network endpoint
+struct LoopbackStats
+{
+  /// Constructor
+  LoopbackStats();
+
+  /// Adds the other statistics to these statistics
+  void Add(const LoopbackStats& rhs);
+
+  /// Data
+  uint64 mPacketsSent;       /// Packets sent by the endpoint
+  uint64 mPacketsReceived;   /// Packets delivered to the endpoint (including duplicates)
+  uint64 mPacketsLost;       /// Sent packets lost to simulated packet loss
+  uint64 mPacketsDuplicated; /// Sent packets delivered twice
+  uint64 mPacketsDropped;    /// Sent packets dropped (bandwidth queue full or unknown destination)
+  uint64 mBytesSent;         /// Bytes sent by the endpoint
+  uint64 mBytesReceived;     /// Bytes delivered to the endpoint (including duplicates)
+};
+
+//                              LoopbackNetwork //
+
+/// Loopback Network
+/// In-process network simulator used by peers in place of sockets
+/// Every endpoint is given a unique loopback IPv4 address, packets sent
+/// between endpoints are delayed, lost, duplicated and rate limited according
+/// to the sending endpoint's conditions, then held until their delivery time
+/// Lets many peers run in a single process without any network access
+/// (Thread safe, peers using the network may be updated on any thread)
+class LoopbackNetwork
+{
+public:
+  /// Constructor
+  /// (The seed makes the simulated conditions repeatable)
+  LoopbackNetwork(uint seed = 0);
+
+  /// Destructor
+  ~LoopbackNetwork();
+
+  //
+  // Endpoints
+  //
+
+  /// Adds an endpoint on the specified port (AnyPort chooses an unused port)
+  /// Returns the endpoint's address if successful, else IpAddress()
+  IpAddress AddEndpoint(Status& status, ushort port = AnyPort);
+  /// Removes the endpoint (discards any packets still on their way to it)
+  void RemoveEndpoint(const IpAddress& ipAddress);
+
+  /// Returns true if the endpoint exists, else false
+  bool HasEndpoint(const IpAddress& ipAddress) const;
+  /// Returns the number of endpoints
+  uint GetEndpointCount() const;
+
+  //
+  // Conditions
+  //
+
+  /// Conditions used by endpoints without their own conditions
+  void SetDefaultConditions(const LoopbackConditions& conditions);
+  LoopbackConditions GetDefaultConditions() const;
+
+  /// Sets the conditions applied to the packets sent by the endpoint
+  void SetEndpointConditions(const IpAddress& ipAddress, const LoopbackConditions& conditions);
+  /// Makes the endpoint use the default conditions again
+  void ClearEndpointConditions(const IpAddress& ipAddress);
+
+  //
+  // Transport
+  //
+
+  /// Sends a packet from the source endpoint to the destination endpoint
+  /// Returns true if the packet was sent (even if it is lost along the way),
+  /// else false (unknown source endpoint)
+  bool Send(const IpAddress& source, const IpAddress& destination, const byte* data, Bytes dataBytes);
+
+  /// Moves the packets that have arrived at the endpoint to the end of the
+  /// raw packets (in order of arrival)
+  /// Returns the number of packets received
+  uint Receive(const IpAddress& destination, Array<RawPacket>& rawPackets);
+
+  /// Returns the number of packets still on their way to any endpoint
+  uint GetPacketsInFlight() const;
+
+  /// Returns the network's current time
+  TimeMs GetTime() const;
+
+  //
+  // Statistics
+  //
+
+  /// Returns the statistics of the endpoint
+  LoopbackStats GetStats(const IpAddress& ipAddress) const;
+  /// Returns the statistics of all endpoints combined
+  LoopbackStats GetTotalStats() const;
+  /// Resets the statistics of all endpoints
+  void ResetStats();
+
+private:
+  /// Packet on its way to an endpoint
+  struct LoopbackPacket
+  {
+    /// Data
+    double mDeliveryTime; /// Time the packet arrives
+    RawPacket mRawPacket; /// Packet data and source address
+  };
+
+  /// Simulated network endpoint
+  struct LoopbackEndpoint
+  {
+    /// Constructor
+    LoopbackEndpoint();
+
+    /// Data
+    IpAddress mIpAddress;           /// Endpoint address
+    bool mHasConditions;            /// Uses its own conditions?
+    LoopbackConditions mConditions; /// Own conditions
+    double mUplinkFreeTime;         /// Time the endpoint is done sending queued packets
+    Array<LoopbackPacket> mPackets; /// Packets on their way to the endpoint (ordered by arrival)
+    LoopbackStats mStats;           /// Endpoint statistics
+  };
+
+  /// Returns the endpoint with the specified address, else nullptr
+  LoopbackEndpoint* FindEndpoint(const IpAddress& ipAddress) const;
+
+  /// Returns the current time (in milliseconds)
+  /// (Assumes the network is locked)
+  double UpdateTime();
+
+  /// Schedules the packet for delivery at the specified time
+  /// (Assumes the network is locked)
+  void Deliver(LoopbackEndpoint& destination,
+               const IpAddress& source,
+               const byte* data,
+               Bytes dataBytes,
+               double deliveryTime);
+
+  /// Typedefs
+  typedef ArrayMap<uint, LoopbackEndpoint*> EndpointMap;
+
+  /// Data
+  mutable ThreadLock mLock;              /// Network thread lock
+  mutable Timer mTimer;                  /// Network clock
+  Math::Random mRandom;                  /// Simulated conditions random number generator
+  LoopbackConditions mDefaultConditions; /// Conditions used by endpoints without their own
+  EndpointMap mEndpoints;                /// Endpoints by port
+  uint mNextPort;                        /// Next port to try when choosing an unused port
+
+  /// No Copy Constructor
+  LoopbackNetwork(const LoopbackNetwork&);
+  /// No Copy Assignment Operator
+  LoopbackNetwork& operator=(const LoopbackNetwork&);
+};
+
+} // namespace Zero
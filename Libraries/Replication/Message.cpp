@@ -369,70 +369,77 @@ Bits Serialize<Message>(SerializeDirection::Enum direction, BitStream& bitStream
   // Read operation?
   else
   {
-    const Bits bitsReadStart = bitStream.GetBitsRead();
+    return ReadMessage(bitStream, message, nullptr);
+  }
+}
 
-    //
-    // Read Message Header
-    //
+Bits ReadMessage(const BitStream& bitStream, Message& message, MessageBufferPool* bufferPool)
+{
+  const Bits bitsReadStart = bitStream.GetBitsRead();
 
-    // Read message type
-    ReturnIf(!bitStream.ReadQuantized(message.mType, MessageTypeMin, MessageTypeMax), 0, "");
+  //
+  // Read Message Header
+  //
 
-    // Read message sequence ID
-    ReturnIf(!bitStream.Read(message.mSequenceId), 0, "");
+  // Read message type
+  ReturnIf(!bitStream.ReadQuantized(message.mType, MessageTypeMin, MessageTypeMax), 0, "");
 
-    // Read message data size
-    Bits dataSize = 0;
-    ReturnIf(!bitStream.ReadQuantized(dataSize, MinMessageDataBits, MaxMessageDataBits), 0, "");
+  // Read message sequence ID
+  ReturnIf(!bitStream.Read(message.mSequenceId), 0, "");
 
-    // Read 'Has timestamp?' flag
-    bool hasTimestamp;
-    ReturnIf(!bitStream.Read(hasTimestamp), 0, "");
+  // Read message data size
+  Bits dataSize = 0;
+  ReturnIf(!bitStream.ReadQuantized(dataSize, MinMessageDataBits, MaxMessageDataBits), 0, "");
 
-    // Timestamped?
-    if (hasTimestamp)
-    {
-      // Read timestamp
-      ReturnIf(!bitStream.ReadQuantized(message.mTimestamp, MessageTimestampMin, MessageTimestampMax), 0, "");
-    }
+  // Read 'Has timestamp?' flag
+  bool hasTimestamp;
+  ReturnIf(!bitStream.Read(hasTimestamp), 0, "");
 
-    // Read 'Is channeled?' flag
-    bool isChanneled;
-    ReturnIf(!bitStream.Read(isChanneled), 0, "");
+  // Timestamped?
+  if (hasTimestamp)
+  {
+    // Read timestamp
+    ReturnIf(!bitStream.ReadQuantized(message.mTimestamp, MessageTimestampMin, MessageTimestampMax), 0, "");
+  }
 
-    // Channeled?
-    if (isChanneled)
-    {
-      // Read channel ID
-      ReturnIf(!bitStream.Read(message.mChannelId), 0, "");
-    }
+  // Read 'Is channeled?' flag
+  bool isChanneled;
+  ReturnIf(!bitStream.Read(isChanneled), 0, "");
 
-    // Has Data?
-    if (dataSize)
-    {
-      // Read 'Is fragment?' flag
-      ReturnIf(!bitStream.Read(message.mIsFragment), 0, "");
+  // Channeled?
+  if (isChanneled)
+  {
+    // Read channel ID
+    ReturnIf(!bitStream.Read(message.mChannelId), 0, "");
+  }
 
-      // Fragmented?
-      if (message.mIsFragment)
-      {
-        // Read FragmentIndex
-        ReturnIf(!bitStream.Read(message.mFragmentIndex), 0, "");
+  // Has Data?
+  if (dataSize)
+  {
+    // Read 'Is fragment?' flag
+    ReturnIf(!bitStream.Read(message.mIsFragment), 0, "");
 
-        // Read 'Is final fragment?' flag
-        ReturnIf(!bitStream.Read(message.mIsFinalFragment), 0, "");
-      }
+    // Fragmented?
+    if (message.mIsFragment)
+    {
+      // Read FragmentIndex
+      ReturnIf(!bitStream.Read(message.mFragmentIndex), 0, "");
 
-      //
-      // Read Message Data
-      //
-      Assert(message.mData.GetBitsWritten() == 0);
-      ReturnIf(message.mData.Append(bitStream, dataSize) != dataSize, 0, "");
+      // Read 'Is final fragment?' flag
+      ReturnIf(!bitStream.Read(message.mIsFinalFragment), 0, "");
     }
 
-    // Success
-    return bitStream.GetBitsRead() - bitsReadStart;
+    //
+    // Read Message Data
+    //
+    Assert(message.mData.GetBitsWritten() == 0);
+    if (bufferPool)
+      bufferPool->AcquireBuffer(message.mData, BITS_TO_BYTES(dataSize));
+    ReturnIf(message.mData.Append(bitStream, dataSize) != dataSize, 0, "");
   }
+
+  // Success
+  return bitStream.GetBitsRead() - bitsReadStart;
 }
 
 //                                 OutMessage //
@@ -571,7 +578,7 @@ TimeMs OutMessage::GetLifetime() const
   return mLifetime;
 }
 
-OutMessage OutMessage::TakeFragment(Bits dataSize)
+OutMessage OutMessage::TakeFragment(Bits dataSize, MessageBufferPool* bufferPool)
 {
   // Not already a fragment?
   if (!mIsFragment)
@@ -587,6 +594,8 @@ OutMessage OutMessage::TakeFragment(Bits dataSize)
 
   // Copy this message without it's data
   Message fragment(*this, true);
+  if (bufferPool)
+    bufferPool->AcquireBuffer(fragment.mData, BITS_TO_BYTES(dataSize));
 
   // Write desired data size to fragment,
   // using Append which updates the Read cursor
@@ -674,18 +683,31 @@ bool FragmentedMessage::IsComplete() const
   return (mFinalFragmentIndex != 0 && (mFragments.Size() == (mFinalFragmentIndex + 1).value()));
 }
 
-Message FragmentedMessage::Reconstruct()
+Message FragmentedMessage::Reconstruct(MessageBufferPool* bufferPool)
 {
   Assert(IsComplete());
 
   // Copy front fragment without it's data
   Message result(mFragments.Front(), true);
 
+  // Reassemble into a pooled slab large enough for all fragment data
+  if (bufferPool)
+  {
+    Bits totalBits = 0;
+    for (FragmentSet::iterator iter = mFragments.Begin(); iter != mFragments.End(); ++iter)
+      totalBits += iter->mData.GetBitsWritten();
+    bufferPool->AcquireBuffer(result.mData, BITS_TO_BYTES(totalBits));
+  }
+
   // Append all fragment data in order
   for (FragmentSet::iterator iter = mFragments.Begin(); iter != mFragments.End(); ++iter)
   {
     Bits bitsWritten = result.mData.AppendAll(iter->mData);
     ErrorIf(bitsWritten != iter->mData.GetBitsWritten());
+
+    // Release fragment buffer
+    if (bufferPool)
+      bufferPool->ReleaseBuffer(iter->mData);
   }
 
   // Clear fragments, no longer needed
@@ -131,6 +131,7 @@ protected:
 
   template <typename Message>
   friend Bits Serialize(SerializeDirection::Enum direction, BitStream& bitStream, Message& message);
+  friend Bits ReadMessage(const BitStream& bitStream, Message& message, MessageBufferPool* bufferPool);
 };
 
 /// Typedefs
@@ -151,6 +152,10 @@ struct MoveWithoutDestructionOperator<Message>
 template <>
 Bits Serialize<Message>(SerializeDirection::Enum direction, BitStream& bitStream, Message& message);
 
+/// Reads a message, taking its data buffer from the buffer pool (if provided)
+/// Returns the number of bits read if successful, else 0
+Bits ReadMessage(const BitStream& bitStream, Message& message, MessageBufferPool* bufferPool);
+
 //                                 OutMessage //
 
 /// Outgoing application data unit (message w/ additional send information)
@@ -210,7 +215,8 @@ public:
   TimeMs GetLifetime() const;
 
   /// Takes a message fragment of the specified dataSize + header size
-  OutMessage TakeFragment(Bits dataSize);
+  /// (The fragment's data buffer is taken from the buffer pool, if provided)
+  OutMessage TakeFragment(Bits dataSize, MessageBufferPool* bufferPool = nullptr);
 
 private:
   /// Message 'Is reliable?' flag
@@ -307,7 +313,9 @@ public:
   bool IsComplete() const;
 
   /// Reconstructs the collection into a whole message
-  Message Reconstruct();
+  /// (The whole message is reassembled into a slab taken from the buffer pool
+  /// and the fragment buffers are released to it, if provided)
+  Message Reconstruct(MessageBufferPool* bufferPool = nullptr);
 
 private:
   /// Adds a fragment to the collection
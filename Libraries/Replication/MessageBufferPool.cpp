@@ -0,0 +1,323 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+//                              MessageBufferPool //
+
+/// Byte capacity of each size class
+/// (Small messages, typical messages, whole packets, large messages and
+/// fragmented message reassembly slabs)
+static const Bytes cMessageBufferSizeClassBytes[cMessageBufferSizeClassCount] = {
+    POW2(6), POW2(8), POW2(11), POW2(14), POW2(17)};
+/// Maximum number of pooled buffers in each size class
+static const uint cMaxPooledBuffers[cMessageBufferSizeClassCount] = {256, 256, 128, 32, 8};
+
+/// Maximum number of pooled message lists of each type
+static const uint cMaxPooledMessageLists = 64;
+/// Message capacity reserved by newly allocated message lists
+static const uint cMessageListCapacity = 8;
+/// Maximum number of pooled outgoing messages
+static const uint cMaxPooledOutMessages = 256;
+
+/// Replaces the empty message list with a pooled list
+template <typename MessageType>
+static bool AcquireMessageListFromPool(Array<Array<MessageType>>& pool, Array<MessageType>& messages)
+{
+  Assert(messages.Empty());
+
+  // Already has capacity?
+  if (messages.capacity())
+    return true;
+
+  // Pool empty?
+  if (pool.Empty())
+  {
+    messages.Reserve(cMessageListCapacity);
+    return false;
+  }
+
+  messages = ZeroMove(pool.Back());
+  pool.PopBack();
+  return true;
+}
+/// Releases the empty message list to the pool
+/// Returns true if the list was kept, else false
+template <typename MessageType>
+static bool ReleaseMessageListToPool(Array<Array<MessageType>>& pool, Array<MessageType>& messages)
+{
+  Assert(messages.Empty());
+
+  // Pool full?
+  if (pool.Size() >= cMaxPooledMessageLists)
+  {
+    messages.Deallocate();
+    return false;
+  }
+
+  pool.PushBack(ZeroMove(messages));
+  return true;
+}
+
+MessageBufferPool::MessageBufferPool() :
+    mMessageLists(),
+    mOutMessageLists(),
+    mOutMessages(),
+    mPooledBufferBytes(0),
+    mAllocationCount(0),
+    mReuseCount(0),
+    mReleaseCount(0),
+    mDiscardCount(0)
+{
+}
+
+MessageBufferPool::~MessageBufferPool()
+{
+  Clear();
+}
+
+//
+// Buffers
+//
+
+Bytes MessageBufferPool::GetSizeClassBytes(uint sizeClass)
+{
+  Assert(sizeClass < cMessageBufferSizeClassCount);
+  return cMessageBufferSizeClassBytes[sizeClass];
+}
+
+void MessageBufferPool::AcquireBuffer(BitStream& bitStream, Bytes capacity)
+{
+  // Current buffer is large enough?
+  if (bitStream.GetByteCapacity() >= capacity && bitStream.GetByteCapacity())
+  {
+    bitStream.ResetCursors();
+    return;
+  }
+
+  // Release current buffer
+  ReleaseBuffer(bitStream);
+
+  // Larger than the largest size class?
+  uint sizeClass = GetAcquireSizeClass(capacity);
+  if (sizeClass == cMessageBufferSizeClassCount)
+  {
+    // Allocate exact buffer
+    bitStream.Reserve(capacity);
+    ++mAllocationCount;
+    return;
+  }
+
+  // Pool empty?
+  Array<BitStream>& buffers = mBuffers[sizeClass];
+  if (buffers.Empty())
+  {
+    // Allocate size class buffer
+    bitStream.Reserve(GetSizeClassBytes(sizeClass));
+    ++mAllocationCount;
+    return;
+  }
+
+  // Take pooled buffer
+  bitStream = ZeroMove(buffers.Back());
+  buffers.PopBack();
+  mPooledBufferBytes -= bitStream.GetByteCapacity();
+  ++mReuseCount;
+}
+void MessageBufferPool::ReleaseBuffer(BitStream& bitStream)
+{
+  // No buffer?
+  Bytes capacity = bitStream.GetByteCapacity();
+  if (!capacity)
+    return;
+
+  // Does not fit a size class or the size class is full?
+  uint sizeClass = GetReleaseSizeClass(capacity);
+  if (sizeClass == cMessageBufferSizeClassCount || mBuffers[sizeClass].Size() >= cMaxPooledBuffers[sizeClass])
+  {
+    // Free buffer
+    bitStream.Clear(true);
+    ++mDiscardCount;
+    return;
+  }
+
+  // Pool buffer (only the cursors are reset, writes overwrite stale bytes)
+  bitStream.ResetCursors();
+  mBuffers[sizeClass].PushBack(ZeroMove(bitStream));
+  mPooledBufferBytes += capacity;
+  ++mReleaseCount;
+}
+
+void MessageBufferPool::TrimFront(BitStream& bitStream)
+{
+  // Copy unread bits into a pooled buffer
+  Bits bitsUnread = bitStream.GetBitsUnread();
+  BitStream trimmed;
+  AcquireBuffer(trimmed, BITS_TO_BYTES(bitsUnread));
+  trimmed.Append(bitStream, bitsUnread);
+
+  // Replace the original buffer
+  ReleaseBuffer(bitStream);
+  bitStream = ZeroMove(trimmed);
+}
+
+//
+// Message Lists
+//
+
+void MessageBufferPool::AcquireMessageList(Array<Message>& messages)
+{
+  if (AcquireMessageListFromPool(mMessageLists, messages))
+    ++mReuseCount;
+  else
+    ++mAllocationCount;
+}
+void MessageBufferPool::AcquireMessageList(Array<OutMessage>& messages)
+{
+  if (AcquireMessageListFromPool(mOutMessageLists, messages))
+    ++mReuseCount;
+  else
+    ++mAllocationCount;
+}
+
+void MessageBufferPool::ReleaseMessageList(Array<Message>& messages)
+{
+  ReleaseMessages(messages);
+  if (!messages.capacity())
+    return;
+
+  if (ReleaseMessageListToPool(mMessageLists, messages))
+    ++mReleaseCount;
+  else
+    ++mDiscardCount;
+}
+void MessageBufferPool::ReleaseMessageList(Array<OutMessage>& messages)
+{
+  ReleaseMessages(messages);
+  if (!messages.capacity())
+    return;
+
+  if (ReleaseMessageListToPool(mOutMessageLists, messages))
+    ++mReleaseCount;
+  else
+    ++mDiscardCount;
+}
+
+//
+// Outgoing Messages
+//
+
+OutMessage* MessageBufferPool::AcquireOutMessage()
+{
+  // Pool empty?
+  if (mOutMessages.Empty())
+  {
+    ++mAllocationCount;
+    return new OutMessage();
+  }
+
+  // Take pooled outgoing message
+  OutMessage* message = mOutMessages.Back();
+  mOutMessages.PopBack();
+  ++mReuseCount;
+  return message;
+}
+void MessageBufferPool::ReleaseOutMessage(OutMessage* message)
+{
+  if (!message)
+    return;
+
+  // Release message buffer
+  ReleaseBuffer(message->GetData());
+
+  // Pool full?
+  if (mOutMessages.Size() >= cMaxPooledOutMessages)
+  {
+    delete message;
+    ++mDiscardCount;
+    return;
+  }
+
+  // Pool outgoing message
+  mOutMessages.PushBack(message);
+  ++mReleaseCount;
+}
+
+//
+// Counters
+//
+
+uint64 MessageBufferPool::GetAllocationCount() const
+{
+  return mAllocationCount;
+}
+uint64 MessageBufferPool::GetReuseCount() const
+{
+  return mReuseCount;
+}
+uint64 MessageBufferPool::GetReleaseCount() const
+{
+  return mReleaseCount;
+}
+uint64 MessageBufferPool::GetDiscardCount() const
+{
+  return mDiscardCount;
+}
+uint MessageBufferPool::GetPooledBufferCount() const
+{
+  uint result = 0;
+  for (uint i = 0; i < cMessageBufferSizeClassCount; ++i)
+    result += mBuffers[i].Size();
+  return result;
+}
+Bytes MessageBufferPool::GetPooledBufferBytes() const
+{
+  return mPooledBufferBytes;
+}
+
+void MessageBufferPool::ResetCounters()
+{
+  mAllocationCount = 0;
+  mReuseCount = 0;
+  mReleaseCount = 0;
+  mDiscardCount = 0;
+}
+
+void MessageBufferPool::Clear()
+{
+  for (uint i = 0; i < cMessageBufferSizeClassCount; ++i)
+    mBuffers[i].Deallocate();
+  mPooledBufferBytes = 0;
+
+  mMessageLists.Deallocate();
+  mOutMessageLists.Deallocate();
+
+  forRange (OutMessage* message, mOutMessages.All())
+    delete message;
+  mOutMessages.Deallocate();
+}
+
+uint MessageBufferPool::GetAcquireSizeClass(Bytes capacity)
+{
+  for (uint i = 0; i < cMessageBufferSizeClassCount; ++i)
+    if (capacity <= cMessageBufferSizeClassBytes[i])
+      return i;
+  return cMessageBufferSizeClassCount;
+}
+uint MessageBufferPool::GetReleaseSizeClass(Bytes capacity)
+{
+  // Too small for the smallest size class, or much larger than the largest
+  // size class (not worth holding on to)?
+  const uint largest = cMessageBufferSizeClassCount - 1;
+  if (capacity < cMessageBufferSizeClassBytes[0] || capacity > cMessageBufferSizeClassBytes[largest] * 2)
+    return cMessageBufferSizeClassCount;
+
+  uint result = 0;
+  for (uint i = 1; i < cMessageBufferSizeClassCount; ++i)
+    if (capacity >= cMessageBufferSizeClassBytes[i])
+      result = i;
+  return result;
+}
+
+} // namespace Zero
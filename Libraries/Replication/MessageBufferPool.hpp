@@ -0,0 +1,125 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+//                              MessageBufferPool //
+
+/// Number of message buffer size classes
+static const uint cMessageBufferSizeClassCount = 5;
+
+/// Message Buffer Pool
+/// Recycles the message data buffers, packet message lists and outgoing
+/// messages used by a peer link so that, once warmed up, sending and receiving
+/// messages does not touch the heap. Buffers are pooled by size class, the
+/// largest class is used as a slab to reassemble fragmented messages.
+/// A buffer taken from the pool is only an allocation if the pool was empty,
+/// so a steady state is reached once GetAllocationCount() stops increasing.
+class MessageBufferPool
+{
+public:
+  /// Constructor
+  MessageBufferPool();
+
+  /// Destructor
+  ~MessageBufferPool();
+
+  //
+  // Buffers
+  //
+
+  /// Returns the byte capacity of the specified size class
+  static Bytes GetSizeClassBytes(uint sizeClass);
+
+  /// Replaces the bit stream with an empty pooled buffer able to hold at least
+  /// the specified number of bytes (the previous buffer is released)
+  void AcquireBuffer(BitStream& bitStream, Bytes capacity);
+  /// Releases the bit stream's buffer to the pool (leaves the bit stream
+  /// empty) Buffers that do not fit a size class are freed
+  void ReleaseBuffer(BitStream& bitStream);
+
+  /// Trims the read bits from the front of the bit stream using a pooled buffer
+  void TrimFront(BitStream& bitStream);
+
+  /// Releases the data buffers of the messages and clears them (keeps the
+  /// list's capacity)
+  template <typename MessageType>
+  void ReleaseMessages(Array<MessageType>& messages)
+  {
+    forRange (MessageType& message, messages.All())
+      ReleaseBuffer(message.GetData());
+    messages.Clear();
+  }
+
+  //
+  // Message Lists
+  //
+
+  /// Replaces the empty message list with a pooled list
+  void AcquireMessageList(Array<Message>& messages);
+  void AcquireMessageList(Array<OutMessage>& messages);
+  /// Releases the message list (and its messages' buffers) to the pool
+  void ReleaseMessageList(Array<Message>& messages);
+  void ReleaseMessageList(Array<OutMessage>& messages);
+
+  //
+  // Outgoing Messages
+  //
+
+  /// Returns a pooled outgoing message
+  OutMessage* AcquireOutMessage();
+  /// Releases the outgoing message (and its buffer) to the pool
+  void ReleaseOutMessage(OutMessage* message);
+
+  //
+  // Counters
+  //
+
+  /// Returns the number of buffers, lists and messages allocated because the
+  /// pool was empty (or the request was larger than the largest size class)
+  uint64 GetAllocationCount() const;
+  /// Returns the number of buffers, lists and messages taken from the pool
+  uint64 GetReuseCount() const;
+  /// Returns the number of buffers, lists and messages released to the pool
+  uint64 GetReleaseCount() const;
+  /// Returns the number of released buffers, lists and messages freed because
+  /// the pool was full (or they did not fit a size class)
+  uint64 GetDiscardCount() const;
+  /// Returns the number of buffers currently held by the pool
+  uint GetPooledBufferCount() const;
+  /// Returns the bytes currently held by the pool's buffers
+  Bytes GetPooledBufferBytes() const;
+
+  /// Resets the counters
+  void ResetCounters();
+
+  /// Frees everything held by the pool (counters are kept)
+  void Clear();
+
+private:
+  /// Returns the smallest size class able to hold the capacity, else
+  /// cMessageBufferSizeClassCount
+  static uint GetAcquireSizeClass(Bytes capacity);
+  /// Returns the largest size class the capacity can hold, else
+  /// cMessageBufferSizeClassCount
+  static uint GetReleaseSizeClass(Bytes capacity);
+
+  /// Data
+  Array<BitStream> mBuffers[cMessageBufferSizeClassCount]; /// Pooled buffers by size class
+  Array<Array<Message>> mMessageLists;                     /// Pooled incoming packet message lists
+  Array<Array<OutMessage>> mOutMessageLists;               /// Pooled outgoing packet message lists
+  Array<OutMessage*> mOutMessages;                         /// Pooled outgoing messages
+  Bytes mPooledBufferBytes;                                /// Bytes held by the pooled buffers
+  uint64 mAllocationCount;                                 /// Allocations made because the pool was empty
+  uint64 mReuseCount;                                      /// Acquisitions served from the pool
+  uint64 mReleaseCount;                                    /// Releases kept by the pool
+  uint64 mDiscardCount;                                    /// Releases freed because the pool was full
+
+  /// No Copy Constructor
+  MessageBufferPool(const MessageBufferPool&);
+  /// No Copy Assignment Operator
+  MessageBufferPool& operator=(const MessageBufferPool&);
+};
+
+} // namespace Zero
@@ -168,7 +168,7 @@ bool InMessageChannel::IsDuplicate(const Message& message) const
   return false;
 }
 
-bool InMessageChannel::Push(MoveReference<Message> message)
+bool InMessageChannel::Push(MoveReference<Message> message, MessageBufferPool* bufferPool)
 {
   Assert(!IsDuplicate(*message));
 
@@ -185,14 +185,14 @@ bool InMessageChannel::Push(MoveReference<Message> message)
       if (iter->IsComplete())
       {
         // Reconstruct whole message
-        Message wholeMessage = iter->Reconstruct();
+        Message wholeMessage = iter->Reconstruct(bufferPool);
         Assert(!wholeMessage.IsFragment());
 
         // Erase from fragmented messages
         mFragmentedMessages.Erase(iter);
 
         // Push whole message
-        bool result = Push(ZeroMove(wholeMessage));
+        bool result = Push(ZeroMove(wholeMessage), bufferPool);
         Assert(result);
       }
 
@@ -250,9 +250,8 @@ bool InMessageChannel::Push(MoveReference<Message> message)
     return true;
   }
 }
-Array<Message> InMessageChannel::Release()
+void InMessageChannel::Release(Array<Message>& messages)
 {
-  Array<Message> result;
   switch (GetTransferMode())
   {
   default:
@@ -260,7 +259,9 @@ Array<Message> InMessageChannel::Release()
   case TransferMode::Immediate:
   case TransferMode::Sequenced:
     // Release all whole Messages
-    result = ZeroMove(static_cast<Array<Message>&>(mMessages));
+    // (Moved individually so both arrays keep their capacity)
+    forRange (Message& message, mMessages.All())
+      messages.PushBack(ZeroMove(message));
     mMessages.Clear();
     break;
 
@@ -269,14 +270,13 @@ Array<Message> InMessageChannel::Release()
     for (ArraySet<Message>::iterator iter = mMessages.Begin(); iter != mMessages.End();)
       if (mMessageSequence.IsVerified(iter->GetSequenceId()))
       {
-        result.PushBack(ZeroMove(*iter));
+        messages.PushBack(ZeroMove(*iter));
         iter = mMessages.Erase(iter);
       }
       else
         ++iter;
     break;
   }
-  return result;
 }
 
 void InMessageChannel::Open()
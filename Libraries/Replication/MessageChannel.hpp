@@ -102,10 +102,12 @@ private:
   bool IsDuplicate(const Message& message) const;
 
   /// Pushes a message for later release as appropriate
+  /// (Fragmented messages are reassembled using the buffer pool, if provided)
   /// Returns true if successful, else false
-  bool Push(MoveReference<Message> message);
-  /// Returns all appropriate messages ready for release
-  Array<Message> Release();
+  bool Push(MoveReference<Message> message, MessageBufferPool* bufferPool = nullptr);
+  /// Moves all appropriate messages ready for release to the end of the
+  /// specified messages
+  void Release(Array<Message>& messages);
 
   /// Opens the channel
   void Open();
@@ -42,6 +42,47 @@ RawPacket& RawPacket::operator=(MoveReference<RawPacket> rhs)
   return *this;
 }
 
+//                               RawPacketBatch //
+
+RawPacketBatch::RawPacketBatch() : mRawPackets(), mDatagrams(), mSize(0)
+{
+}
+
+void RawPacketBatch::Reserve(uint size)
+{
+  while (mRawPackets.Size() < size)
+  {
+    RawPacket& rawPacket = mRawPackets.PushBack();
+    rawPacket.mData.Reserve(EthernetMtuBytes);
+    mDatagrams.PushBack();
+  }
+}
+
+RawPacket& RawPacketBatch::Add()
+{
+  Reserve(mSize + 1);
+  return mRawPackets[mSize++];
+}
+
+uint RawPacketBatch::Size() const
+{
+  return mSize;
+}
+bool RawPacketBatch::Empty() const
+{
+  return mSize == 0;
+}
+
+void RawPacketBatch::Clear()
+{
+  for (uint i = 0; i < mSize; ++i)
+  {
+    mRawPackets[i].mIpAddress.Clear();
+    mRawPackets[i].mData.Clear(false);
+  }
+  mSize = 0;
+}
+
 //                                    Packet //
 
 Packet::Packet(const IpAddress& ipAddress, bool isStandalone, PacketSequenceId sequenceId) :
@@ -255,15 +296,21 @@ Bits Serialize<OutPacket>(SerializeDirection::Enum direction, BitStream& bitStre
 
 //                                   InPacket //
 
-InPacket::InPacket(const IpAddress& source) : Packet(source), mMessages()
+InPacket::InPacket(const IpAddress& source, MessageBufferPool* bufferPool) :
+    Packet(source),
+    mMessages(),
+    mBufferPool(bufferPool)
 {
 }
 
-InPacket::InPacket(const InPacket& rhs) : Packet(rhs), mMessages(rhs.mMessages)
+InPacket::InPacket(const InPacket& rhs) : Packet(rhs), mMessages(rhs.mMessages), mBufferPool(rhs.mBufferPool)
 {
 }
 
-InPacket::InPacket(MoveReference<InPacket> rhs) : Packet(*rhs), mMessages(ZeroMove(rhs->mMessages))
+InPacket::InPacket(MoveReference<InPacket> rhs) :
+    Packet(*rhs),
+    mMessages(ZeroMove(rhs->mMessages)),
+    mBufferPool(rhs->mBufferPool)
 {
 }
 
@@ -271,6 +318,7 @@ InPacket& InPacket::operator=(const InPacket& rhs)
 {
   Packet::operator=(rhs);
   mMessages = rhs.mMessages;
+  mBufferPool = rhs.mBufferPool;
 
   return *this;
 }
@@ -279,6 +327,7 @@ InPacket& InPacket::operator=(MoveReference<InPacket> rhs)
 {
   Packet::operator=(*rhs);
   mMessages = ZeroMove(rhs->mMessages);
+  mBufferPool = rhs->mBufferPool;
 
   return *this;
 }
@@ -346,12 +395,16 @@ Bits Serialize<InPacket>(SerializeDirection::Enum direction, BitStream& bitStrea
   // Read Messages
   //
 
+  // Using a buffer pool?
+  if (inPacket.mBufferPool)
+    inPacket.mBufferPool->AcquireMessageList(inPacket.mMessages);
+
   // Enough bits left to possibly read another message?
   while (bitStream.GetBitsUnread() >= MinMessageHeaderBits)
   {
-    // Read a message
+    // Read a message (into a pooled buffer, if possible)
     Message message(ProtocolMessageType::Invalid);
-    if (!bitStream.Read(message)) // Unable?
+    if (!ReadMessage(bitStream, message, inPacket.mBufferPool)) // Unable?
     {
       Assert(false);
       break;
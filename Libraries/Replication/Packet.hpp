@@ -43,6 +43,36 @@ struct MoveWithoutDestructionOperator<RawPacket>
   }
 };
 
+//                               RawPacketBatch //
+
+/// Reusable raw packet buffers sent or received with a single batched socket
+/// call (Buffers are kept between batches so they are only allocated once)
+class RawPacketBatch
+{
+public:
+  /// Constructor
+  RawPacketBatch();
+
+  /// Makes sure there are at least the specified number of raw packet buffers
+  void Reserve(uint size);
+
+  /// Returns the next unused raw packet buffer (adds a buffer as needed)
+  RawPacket& Add();
+
+  /// Returns the number of raw packet buffers in use
+  uint Size() const;
+  /// Returns true if there are no raw packet buffers in use, else false
+  bool Empty() const;
+
+  /// Clears the raw packet buffers in use (keeps their memory)
+  void Clear();
+
+  /// Data
+  Array<RawPacket> mRawPackets;     /// Raw packet buffers (each reserves an MTU)
+  Array<SocketDatagram> mDatagrams; /// Socket datagram for each raw packet buffer
+  uint mSize;                       /// Raw packet buffers in use
+};
+
 //                                    Packet //
 
 /// Network data unit
@@ -177,7 +207,8 @@ class InPacket : public Packet
 {
 public:
   /// Constructor
-  InPacket(const IpAddress& source = IpAddress());
+  /// (Message buffers are read into the buffer pool, if provided)
+  InPacket(const IpAddress& source = IpAddress(), MessageBufferPool* bufferPool = nullptr);
 
   /// Copy Constructor
   InPacket(const InPacket& rhs);
@@ -206,6 +237,8 @@ public:
 
   /// Contained messages
   Array<Message> mMessages;
+  /// Buffer pool used to read the contained messages (optional)
+  MessageBufferPool* mBufferPool;
 
   /// Friends
   template <typename InPacket>
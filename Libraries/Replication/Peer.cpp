@@ -6,11 +6,15 @@ namespace Zero
 
 //                                    Peer //
 
+/// Number of packets a receive thread can receive in a single batch
+static const uint cReceiveBatchSize = 32;
+
 void Peer::ResetSession()
 {
   /// Operating Data
   mIpv4Address.Clear();
   mIpv6Address.Clear();
+  mLoopbackNetwork = nullptr;
   mInternetProtocol = InternetProtocol::Unspecified;
   mTransportProtocol = TransportProtocol::Unspecified;
 
@@ -21,6 +25,9 @@ void Peer::ResetSession()
   mIpv4RawPackets.Clear();
   mIpv6RawPackets.Clear();
   mSendBitStream.Clear(false);
+  mBatchSends = false;
+  mIpv4SendBatch.Clear();
+  mIpv6SendBatch.Clear();
 
   InitializeStats();
 }
@@ -37,6 +44,7 @@ Peer::Peer(ProcessReceivedCustomPacketFn processReceivedCustomPacketFn,
     mIpv6Address(),
     mIpv4Socket(),
     mIpv6Socket(),
+    mLoopbackNetwork(nullptr),
     mInternetProtocol(InternetProtocol::Unspecified),
     mTransportProtocol(TransportProtocol::Unspecified),
     mUserData(nullptr),
@@ -60,6 +68,9 @@ Peer::Peer(ProcessReceivedCustomPacketFn processReceivedCustomPacketFn,
     mIpv6RawPackets(),
     mIpv6RawPacketsLock(),
     mSendBitStream(),
+    mBatchSends(false),
+    mIpv4SendBatch(),
+    mIpv6SendBatch(),
     mReceiveStatsLock(),
     mReleasedCustomPackets(),
     mReleasedCustomPacketsLock(),
@@ -140,7 +151,7 @@ const IpAddress& Peer::GetLocalIpv6Address() const
 
 bool Peer::IsOpen() const
 {
-  return mIpv4Socket.IsOpen() || mIpv6Socket.IsOpen() || !mIpv4ReceiveThread.IsCompleted() ||
+  return mIpv4Socket.IsOpen() || mIpv6Socket.IsOpen() || mLoopbackNetwork || !mIpv4ReceiveThread.IsCompleted() ||
          !mIpv6ReceiveThread.IsCompleted();
 }
 
@@ -299,6 +310,31 @@ void Peer::Open(Status& status,
   // Update once to initialize links and plugins
   Update();
 }
+void Peer::Open(Status& status, LoopbackNetwork& loopbackNetwork, ushort port)
+{
+  // Close peer if anything is open
+  Close();
+
+  // Add loopback network endpoint
+  IpAddress ipAddress = loopbackNetwork.AddEndpoint(status, port);
+  if (status.Failed()) // Unable?
+    return;
+
+  //
+  // Store Session Information
+  //
+  mLoopbackNetwork = &loopbackNetwork;
+  mInternetProtocol = InternetProtocol::V4;
+  mIpv4Address = ipAddress;
+
+  // Update once to initialize links and plugins
+  Update();
+}
+
+LoopbackNetwork* Peer::GetLoopbackNetwork() const
+{
+  return mLoopbackNetwork;
+}
 
 void Peer::Close()
 {
@@ -378,6 +414,14 @@ void Peer::Close()
     Assert(!mIpv6Socket.IsOpen());
   }
 
+  //
+  // Close Loopback Network Endpoint
+  //
+
+  // Using loopback network?
+  if (mLoopbackNetwork)
+    mLoopbackNetwork->RemoveEndpoint(mIpv4Address);
+
   //
   // Close Receive Threads
   //
@@ -695,6 +739,8 @@ void Peer::ResetStats()
   mConnectionsAvg = 0;
   mConnectionsMax = 0;
 
+  mFailedSends = 0;
+
   // For all links
   forRange (PeerLink* link, mLinks.All())
     link->ResetStats(); // Reset their stats
@@ -726,6 +772,11 @@ uint Peer::GetMaxConnections() const
   return mConnectionsMax;
 }
 
+uint Peer::GetFailedSends() const
+{
+  return mFailedSends;
+}
+
 Array<Pair<String, Array<String>>> Peer::GetStatsSummary() const
 {
   // TODO
@@ -798,12 +849,39 @@ bool Peer::SendPacket(OutPacket& outPacket)
   if (!PluginEventOnPacketSend(outPacket))
     return true;
 
+  bool isIpv4 = (outPacket.GetDestinationIpAddress().GetInternetProtocol() == InternetProtocol::V4);
+
+  // Batching sends?
+  if (mBatchSends)
+  {
+    // Queue packet to be sent at the end of the update
+    RawPacket& rawPacket = isIpv4 ? mIpv4SendBatch.Add() : mIpv6SendBatch.Add();
+    rawPacket.mIpAddress = outPacket.GetDestinationIpAddress();
+    rawPacket.mData.Write(outPacket);
+    return true;
+  }
+
   // Write packet to bitstream
   mSendBitStream.Write(outPacket);
 
+  // Using loopback network?
+  if (mLoopbackNetwork)
+  {
+    // Send packet over loopback network
+    bool result = mLoopbackNetwork->Send(mIpv4Address,
+                                         outPacket.GetDestinationIpAddress(),
+                                         mSendBitStream.GetData(),
+                                         mSendBitStream.GetBytesWritten());
+    if (result) // Successful?
+      UpdateSendStats(mSendBitStream.GetBytesWritten());
+
+    // Clear for next send
+    mSendBitStream.Clear(false);
+    return result;
+  }
+
   // Choose correct socket (IPv4 or IPv6)
-  Socket& socket =
-      outPacket.GetDestinationIpAddress().GetInternetProtocol() == InternetProtocol::V4 ? mIpv4Socket : mIpv6Socket;
+  Socket& socket = isIpv4 ? mIpv4Socket : mIpv6Socket;
 
   // Send packet over socket
   Status status;
@@ -817,12 +895,55 @@ bool Peer::SendPacket(OutPacket& outPacket)
     // Update stats
     UpdateSendStats(result);
   }
+  else
+  {
+    // Count the dropped packet
+    ++mFailedSends;
+  }
 
   // Clear for next send
   mSendBitStream.Clear(false);
   return (result != 0);
 }
 
+void Peer::SendRawPacketBatch(Socket& socket, RawPacketBatch& batch)
+{
+  if (batch.Empty())
+    return;
+
+  // Describe each queued packet as a datagram
+  for (uint i = 0; i < batch.Size(); ++i)
+  {
+    RawPacket& rawPacket = batch.mRawPackets[i];
+    SocketDatagram& datagram = batch.mDatagrams[i];
+    datagram.mData = rawPacket.mData.GetDataExposed();
+    datagram.mDataLength = rawPacket.mData.GetBytesWritten();
+    datagram.mBytesTransferred = 0;
+    datagram.mAddress = rawPacket.mIpAddress;
+  }
+
+  // Send packets over socket
+  Status status;
+  socket.SendToBatch(status, batch.mDatagrams.Data(), batch.Size());
+  for (uint i = 0; i < batch.Size(); ++i)
+  {
+    SocketDatagram& datagram = batch.mDatagrams[i];
+    if (datagram.mBytesTransferred == 0) // Unable?
+    {
+      // Count the dropped packet
+      ++mFailedSends;
+      continue;
+    }
+    Assert(datagram.mBytesTransferred == datagram.mDataLength);
+
+    // Update stats
+    UpdateSendStats(datagram.mBytesTransferred);
+  }
+
+  // Clear for next batch
+  batch.Clear();
+}
+
 void Peer::UpdateSendStats(Bytes sentPacketBytes)
 {
   // Update current send time
@@ -888,6 +1009,60 @@ bool Peer::IsValidRawPacket(RawPacket& rawPacket)
   return true;
 }
 
+void Peer::ReceiveRawPacketBatch(Socket& socket,
+                                 RawPacketBatch& batch,
+                                 ThreadLock& rawPacketsLock,
+                                 Array<RawPacket>& rawPackets)
+{
+  // Describe each raw packet buffer as a datagram
+  uint bufferCount = batch.mRawPackets.Size();
+  for (uint i = 0; i < bufferCount; ++i)
+  {
+    SocketDatagram& datagram = batch.mDatagrams[i];
+    datagram.mData = batch.mRawPackets[i].mData.GetDataExposed();
+    datagram.mDataLength = EthernetMtuBytes;
+    datagram.mBytesTransferred = 0;
+    datagram.mAddress.Clear();
+  }
+
+  // Wait to receive packets over socket
+  Status status;
+  size_t receivedCount = socket.ReceiveFromBatch(status, batch.mDatagrams.Data(), bufferCount);
+  batch.mSize = uint(receivedCount);
+
+  // Validate received packets
+  // (Invalid packets are left empty)
+  for (uint i = 0; i < batch.Size(); ++i)
+  {
+    RawPacket& rawPacket = batch.mRawPackets[i];
+    SocketDatagram& datagram = batch.mDatagrams[i];
+    rawPacket.mData.SetBytesWritten(datagram.mBytesTransferred);
+    rawPacket.mIpAddress = datagram.mAddress;
+    if (datagram.mBytesTransferred && IsValidRawPacket(rawPacket)) // Successful?
+      Assert(rawPacket.mIpAddress.IsValid());
+    else
+      rawPacket.mData.Clear(false);
+  }
+
+  { //<>-<>-<>-<>-< Raw Packets Locked >-<>-<>-<>-<>-
+    Lock lock(rawPacketsLock);
+
+    // Push valid raw packet copies
+    for (uint i = 0; i < batch.Size(); ++i)
+      if (!batch.mRawPackets[i].mData.IsEmpty())
+        rawPackets.PushBack(batch.mRawPackets[i]);
+
+  } //-<>-<>-<>-<>-< Raw Packets Unlocked >-<>-<>-<>-<>
+
+  // Update stats
+  for (uint i = 0; i < batch.Size(); ++i)
+    if (!batch.mRawPackets[i].mData.IsEmpty())
+      UpdateReceiveStats(batch.mRawPackets[i].mData.GetBytesWritten());
+
+  // Clear for next receive
+  batch.Clear();
+}
+
 OsInt Peer::Ipv4ReceiveThreadFn()
 {
   try
@@ -895,36 +1070,10 @@ OsInt Peer::Ipv4ReceiveThreadFn()
     //
     // Receive Loop
     //
-    RawPacket rawPacket;
-    rawPacket.mData.Reserve(EthernetMtuBytes);
+    RawPacketBatch batch;
+    batch.Reserve(cReceiveBatchSize);
     while (!mExitIpv4ReceiveThread)
-    {
-      // Wait to receive a packet over socket
-      Status status;
-      SocketAddress sourceAddress;
-      Bytes result = mIpv4Socket.ReceiveFrom(status, rawPacket.mData.GetDataExposed(), EthernetMtuBytes, sourceAddress);
-      rawPacket.mData.SetBytesWritten(result);
-      rawPacket.mIpAddress = sourceAddress;
-      if (result && IsValidRawPacket(rawPacket)) // Successful?
-      {
-        Assert(rawPacket.mIpAddress.IsValid());
-
-        { //<>-<>-<>-<>-< IPv4 Raw Packets Locked >-<>-<>-<>-<>-
-          Lock lock(mIpv4RawPacketsLock);
-
-          // Push raw packet copy
-          mIpv4RawPackets.PushBack(rawPacket);
-
-        } //-<>-<>-<>-<>-< IPv4 Raw Packets Unlocked >-<>-<>-<>-<>
-
-        // Update stats
-        UpdateReceiveStats(result);
-      }
-
-      // Clear for next receive
-      rawPacket.mIpAddress.Clear();
-      rawPacket.mData.Clear(false);
-    }
+      ReceiveRawPacketBatch(mIpv4Socket, batch, mIpv4RawPacketsLock, mIpv4RawPackets);
 
     // Success
     return 0;
@@ -949,35 +1098,10 @@ OsInt Peer::Ipv6ReceiveThreadFn()
     //
     // Receive Loop
     //
-    RawPacket rawPacket;
-    rawPacket.mData.Reserve(EthernetMtuBytes);
+    RawPacketBatch batch;
+    batch.Reserve(cReceiveBatchSize);
     while (!mExitIpv6ReceiveThread)
-    {
-      // Wait to receive a packet over socket
-      Status status;
-      Bytes result =
-          mIpv6Socket.ReceiveFrom(status, rawPacket.mData.GetDataExposed(), EthernetMtuBytes, rawPacket.mIpAddress);
-      rawPacket.mData.SetBytesWritten(result);
-      if (result && IsValidRawPacket(rawPacket)) // Successful?
-      {
-        Assert(rawPacket.mIpAddress.IsValid());
-
-        { //<>-<>-<>-<>-< IPv6 Raw Packets Locked >-<>-<>-<>-<>-
-          Lock lock(mIpv6RawPacketsLock);
-
-          // Push raw packet copy
-          mIpv6RawPackets.PushBack(rawPacket);
-
-        } //-<>-<>-<>-<>-< IPv6 Raw Packets Unlocked >-<>-<>-<>-<>
-
-        // Update stats
-        UpdateReceiveStats(result);
-      }
-
-      // Clear for next receive
-      rawPacket.mIpAddress.Clear();
-      rawPacket.mData.Clear(false);
-    }
+      ReceiveRawPacketBatch(mIpv6Socket, batch, mIpv6RawPacketsLock, mIpv6RawPackets);
 
     // Success
     return 0;
@@ -1119,6 +1243,26 @@ void Peer::UpdatePeerState()
 
   } //-<>-<>-<>-<>-< IPv4 Raw Packets Unlocked >-<>-<>-<>-<>
 
+  // Using loopback network?
+  if (mLoopbackNetwork)
+  {
+    // Get arrived loopback packets
+    uint index = rawPackets.Size();
+    mLoopbackNetwork->Receive(mIpv4Address, rawPackets);
+
+    // Validate received packets
+    while (index < rawPackets.Size())
+    {
+      if (IsValidRawPacket(rawPackets[index])) // Successful?
+      {
+        UpdateReceiveStats(rawPackets[index].mData.GetBytesWritten());
+        ++index;
+      }
+      else
+        rawPackets.EraseAt(index);
+    }
+  }
+
   // Translate raw IPv4 packets
   TranslateRawPackets(rawPackets, inPackets);
 
@@ -1196,6 +1340,12 @@ void Peer::UpdatePeerState()
   //
   // Update Links
   //
+
+  // Queue outgoing packets until the end of the update so they can be sent in
+  // a single batch per socket
+  // (The loopback network has no system calls to save)
+  mBatchSends = !mLoopbackNetwork && Socket::SupportsDatagramBatching();
+
   forRange (PeerLink* link, mLinks.All())
   {
     // Update link state and process received custom messages
@@ -1212,6 +1362,13 @@ void Peer::UpdatePeerState()
   //
   forRange (PeerPlugin* plugin, mPlugins.All())
     plugin->OnUpdate();
+
+  //
+  // Send Queued Packets
+  //
+  mBatchSends = false;
+  SendRawPacketBatch(mIpv4Socket, mIpv4SendBatch);
+  SendRawPacketBatch(mIpv6Socket, mIpv6SendBatch);
 }
 void Peer::ProcessReceivedCustomPackets()
 {
@@ -1243,8 +1400,12 @@ void Peer::TranslateRawPackets(Array<RawPacket>& rawPackets, Array<InPacket>& in
   // For all RawPackets
   forRange (RawPacket& rawPacket, rawPackets.All())
   {
+    // Get the link's buffer pool (if the link exists)
+    PeerLink* link = mLinks.FindValue(rawPacket.mIpAddress, nullptr);
+    MessageBufferPool* bufferPool = link ? &link->GetBufferPool() : nullptr;
+
     // Read as InPacket
-    InPacket inPacket(rawPacket.mIpAddress);
+    InPacket inPacket(rawPacket.mIpAddress, bufferPool);
     if (rawPacket.mData.Read(inPacket)) // Successful?
       inPackets.PushBack(ZeroMove(inPacket));
   }
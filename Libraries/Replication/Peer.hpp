@@ -79,6 +79,15 @@ public:
             ushort port = AnyPort,
             InternetProtocol::Enum internetProtocol = InternetProtocol::Both,
             TransportProtocol::Enum transportProtocol = TransportProtocol::Udp);
+  /// Opens the closed peer as an endpoint of the loopback network on the
+  /// specified port (closes the peer if already open)
+  /// Packets are sent and received through the loopback network instead of
+  /// sockets and no receive threads are launched
+  /// (The network must outlive the peer's session, close the peer first)
+  void Open(Status& status, LoopbackNetwork& loopbackNetwork, ushort port = AnyPort);
+
+  /// Returns the loopback network the open peer is using, else nullptr
+  LoopbackNetwork* GetLoopbackNetwork() const;
 
   /// Closes the peer (safe to call multiple times)
   /// Uninitializes any initialized links and plugins managed by this peer
@@ -220,6 +229,10 @@ public:
   /// Returns the maximum number of connected links
   uint GetMaxConnections() const;
 
+  /// Returns the number of outgoing packets that could not be sent over the
+  /// socket
+  uint GetFailedSends() const;
+
   /// Returns a summary of all peer statistics as an array of pairs containing
   /// the property name and array of minimum, average, and maximum values
   Array<Pair<String, Array<String>>> GetStatsSummary() const;
@@ -250,8 +263,11 @@ public:
   TimeMs UpdateAndGetReceiveTime();
 
   /// Sends an outgoing packet to the network
+  /// (Queued until the end of the peer update while batching sends)
   /// Returns true if successful, else false
   bool SendPacket(OutPacket& outPacket);
+  /// Sends all queued outgoing packets over the socket in a single batch
+  void SendRawPacketBatch(Socket& socket, RawPacketBatch& batch);
 
   /// Updates packet send statistics
   void UpdateSendStats(Bytes sentPacketBytes);
@@ -262,6 +278,13 @@ public:
   /// false
   static bool IsValidRawPacket(RawPacket& rawPacket);
 
+  /// Receives a batch of incoming packets from the socket and pushes the
+  /// valid ones to the raw packets (blocks until at least one is received)
+  void ReceiveRawPacketBatch(Socket& socket,
+                             RawPacketBatch& batch,
+                             ThreadLock& rawPacketsLock,
+                             Array<RawPacket>& rawPackets);
+
   /// Receives incoming IPv4 packets from the network
   OsInt Ipv4ReceiveThreadFn();
   /// Receives incoming IPv6 packets from the network
@@ -309,6 +332,7 @@ public:
   IpAddress mIpv6Address;                                         /// IPv6 peer address
   Socket mIpv4Socket;                                             /// IPv4 TCP/UDP socket
   Socket mIpv6Socket;                                             /// IPv6 TCP/UDP socket
+  LoopbackNetwork* mLoopbackNetwork;                              /// Loopback network used instead of sockets
   InternetProtocol::Enum mInternetProtocol;                       /// IP address protocol version
   TransportProtocol::Enum mTransportProtocol;                     /// Transport layer protocol
   void* mUserData;                                                /// Optional user data
@@ -332,6 +356,9 @@ public:
   Array<RawPacket> mIpv6RawPackets;              /// Raw incoming IPv6 packets
   mutable ThreadLock mIpv6RawPacketsLock;        /// Raw incoming IPv6 packets thread lock
   BitStream mSendBitStream;                      /// Reusable outgoing packet bitstream
+  bool mBatchSends;                              /// Queue outgoing packets until the end of the update?
+  RawPacketBatch mIpv4SendBatch;                 /// Queued outgoing IPv4 packets
+  RawPacketBatch mIpv6SendBatch;                 /// Queued outgoing IPv6 packets
   mutable ThreadLock mReceiveStatsLock;          /// Receive stats thread lock
   Array<InPacket> mReleasedCustomPackets;        /// Released incoming user packets
   mutable ThreadLock mReleasedCustomPacketsLock; /// Released incoming user packets thread lock
@@ -366,6 +393,8 @@ public:
   Atomic<float> mConnectionsAvg;    /// Average connections
   Atomic<uint32> mConnectionsMax;   /// Maximum connections
 
+  Atomic<uint32> mFailedSends; /// Outgoing packets that could not be sent
+
 private:
   /// No Copy Constructor
   Peer(const Peer&);
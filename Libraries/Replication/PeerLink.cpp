@@ -43,8 +43,11 @@ PeerLink::PeerLink(Peer* peer, const IpAddress& ipAddress, TransmissionDirection
     mTheirGuid(0),
     mTheirIpAddress(ipAddress),
     mOurIpAddress(),
+    mBufferPool(),
     mInbox(this),
     mOutbox(this),
+    mRemoteACKs(),
+    mRemoteNAKs(),
     mUserMessageTypeStart(CustomMessageTypeStart),
     mUserData(nullptr),
 
@@ -112,6 +115,11 @@ Peer* PeerLink::GetPeer() const
   return mPeer;
 }
 
+MessageBufferPool& PeerLink::GetBufferPool()
+{
+  return mBufferPool;
+}
+
 TimeMs PeerLink::GetCreationDuration() const
 {
   return GetDuration(mCreationTime, GetLocalTime());
@@ -906,9 +914,9 @@ void PeerLink::UpdateLinkState()
   //
   // Process Incoming Packets
   //
-  ACKArray remoteACKs;
-  NAKArray remoteNAKs;
-  mInbox.Update(remoteACKs, remoteNAKs);
+  mRemoteACKs.Clear();
+  mRemoteNAKs.Clear();
+  mInbox.Update(mRemoteACKs, mRemoteNAKs);
 
   //
   // Update Link State
@@ -1418,12 +1426,12 @@ UpdateLinkState:
   }
   break;
   } // (Update Link State)
-  protocolMessages.Clear();
+  mBufferPool.ReleaseMessages(protocolMessages);
 
   //
   // Send Outgoing Packets
   //
-  mOutbox.Update(remoteACKs, remoteNAKs);
+  mOutbox.Update(mRemoteACKs, mRemoteNAKs);
 
   //
   // Update Plugins
@@ -1450,7 +1458,9 @@ void PeerLink::ProcessReceivedCustomMessages()
     }
   }
 
-  // Erase processed messages
+  // Recycle and erase processed messages
+  for (Array<Message>::iterator processed = customMessages.Begin(); processed != iter; ++processed)
+    mBufferPool.ReleaseBuffer(processed->GetData());
   customMessages.Erase(Array<Message>::range(customMessages.Begin(), iter));
 }
 bool PeerLink::ProcessReceivedCustomMessage(Message& message, bool isEvent)
@@ -62,6 +62,10 @@ public:
   /// Returns the operating peer
   Peer* GetPeer() const;
 
+  /// Returns the link's message buffer pool
+  /// (Recycles the link's message buffers, see MessageBufferPool)
+  MessageBufferPool& GetBufferPool();
+
   /// Returns the duration that the link has existed
   TimeMs GetCreationDuration() const;
   /// Returns the direction in which the link was created (which peer initiated
@@ -526,8 +530,11 @@ public:
   Guid mTheirGuid;                   /// Their peer's permanent GUID
   IpAddress mTheirIpAddress;         /// Their peer's IP address as seen from our perspective
   IpAddress mOurIpAddress;           /// Our peer's IP address as seen from their perspective
+  MessageBufferPool mBufferPool;     /// Message buffer pool (used by the inbox and outbox)
   LinkInbox mInbox;                  /// Incoming packet manager
   LinkOutbox mOutbox;                /// Outgoing packet manager
+  ACKArray mRemoteACKs;              /// Remote ACKs received this update
+  NAKArray mRemoteNAKs;              /// Remote NAKs received this update
   MessageType mUserMessageTypeStart; /// User messages type start
   void* mUserData;                   /// Optional user data
 
@@ -0,0 +1,294 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+//                             OwnerRelevancyFilter //
+
+void OwnerRelevancyFilter::AddOwnerOnlyReplica(Replica* replica)
+{
+  mOwnerOnlyReplicas.Insert(replica);
+}
+void OwnerRelevancyFilter::RemoveOwnerOnlyReplica(Replica* replica)
+{
+  mOwnerOnlyReplicas.EraseValue(replica);
+}
+bool OwnerRelevancyFilter::IsOwnerOnlyReplica(Replica* replica) const
+{
+  return mOwnerOnlyReplicas.Contains(replica);
+}
+
+float OwnerRelevancyFilter::GetRelevancy(ReplicatorLink* link, Replica* replica)
+{
+  // Not an owner only replica?
+  if (!IsOwnerOnlyReplica(replica))
+    return 1.0f;
+
+  // Relevant only to the change authority client
+  return (link->GetReplicatorId() == replica->GetAuthorityClientReplicatorId()) ? 1.0f : 0.0f;
+}
+void OwnerRelevancyFilter::OnInvalidReplica(Replica* replica)
+{
+  RemoveOwnerOnlyReplica(replica);
+}
+
+//                              TeamRelevancyFilter //
+
+void TeamRelevancyFilter::SetLinkTeam(ReplicatorId replicatorId, uint team)
+{
+  if (team == cNoTeam)
+    mLinkTeams.EraseValue(replicatorId);
+  else
+    mLinkTeams.InsertOrAssign(replicatorId, team);
+}
+uint TeamRelevancyFilter::GetLinkTeam(ReplicatorId replicatorId) const
+{
+  return mLinkTeams.FindValue(replicatorId, cNoTeam);
+}
+
+void TeamRelevancyFilter::SetReplicaTeam(Replica* replica, uint team)
+{
+  if (team == cNoTeam)
+    mReplicaTeams.Erase(replica);
+  else
+    mReplicaTeams[replica] = team;
+}
+uint TeamRelevancyFilter::GetReplicaTeam(Replica* replica) const
+{
+  return mReplicaTeams.FindValue(replica, cNoTeam);
+}
+
+float TeamRelevancyFilter::GetRelevancy(ReplicatorLink* link, Replica* replica)
+{
+  // Replica or link has no team?
+  uint replicaTeam = GetReplicaTeam(replica);
+  uint linkTeam = GetLinkTeam(link->GetReplicatorId());
+  if (replicaTeam == cNoTeam || linkTeam == cNoTeam)
+    return 1.0f;
+
+  // Relevant only to the same team
+  return (replicaTeam == linkTeam) ? 1.0f : 0.0f;
+}
+void TeamRelevancyFilter::OnInvalidReplica(Replica* replica)
+{
+  mReplicaTeams.Erase(replica);
+}
+void TeamRelevancyFilter::OnRemovingLink(ReplicatorLink* link)
+{
+  mLinkTeams.EraseValue(link->GetReplicatorId());
+}
+
+//                            SpatialRelevancyFilter //
+
+/// Grid cell coordinates are packed into 21 bits per axis
+static const uint cCellKeyBits = 21;
+static const int cCellKeyOffset = 1 << (cCellKeyBits - 1);
+static const u64 cCellKeyMask = (u64(1) << cCellKeyBits) - 1;
+
+SpatialRelevancyFilter::SpatialRelevancyFilter() :
+    mRadius(100.0f),
+    mHysteresis(0.1f),
+    mMinRelevancy(0.1f),
+    mReplicaPositions(),
+    mUnplacedReplicas(),
+    mLinkViewers(),
+    mCells()
+{
+}
+
+void SpatialRelevancyFilter::SetRadius(float radius)
+{
+  // (The grid cell size changes with the radius so every replica must be
+  // re-bucketed)
+  mRadius = Math::Max(radius, 0.001f);
+
+  mCells.Clear();
+  forRange (PositionMap::value_type& entry, mReplicaPositions.All())
+    mCells[GetCellKey(GetCell(entry.second))].PushBack(entry.first);
+}
+float SpatialRelevancyFilter::GetRadius() const
+{
+  return mRadius;
+}
+
+void SpatialRelevancyFilter::SetHysteresis(float hysteresis)
+{
+  mHysteresis = Math::Max(hysteresis, 0.0f);
+}
+float SpatialRelevancyFilter::GetHysteresis() const
+{
+  return mHysteresis;
+}
+
+void SpatialRelevancyFilter::SetMinRelevancy(float minRelevancy)
+{
+  mMinRelevancy = Math::Clamp(minRelevancy, 0.001f, 1.0f);
+}
+float SpatialRelevancyFilter::GetMinRelevancy() const
+{
+  return mMinRelevancy;
+}
+
+void SpatialRelevancyFilter::SetReplicaPosition(Replica* replica, Vec3Param position)
+{
+  // Already placed?
+  Vec3* oldPosition = mReplicaPositions.FindPointer(replica);
+  if (oldPosition)
+  {
+    // Moved to another cell?
+    CellKey oldKey = GetCellKey(GetCell(*oldPosition));
+    CellKey newKey = GetCellKey(GetCell(position));
+    if (oldKey != newKey)
+    {
+      RemoveFromCell(replica);
+      mCells[newKey].PushBack(replica);
+    }
+
+    *oldPosition = position;
+    return;
+  }
+
+  // Place replica
+  mUnplacedReplicas.EraseValue(replica);
+  mReplicaPositions.Insert(replica, position);
+  mCells[GetCellKey(GetCell(position))].PushBack(replica);
+}
+void SpatialRelevancyFilter::ClearReplicaPosition(Replica* replica)
+{
+  // Not placed?
+  if (!mReplicaPositions.ContainsKey(replica))
+    return;
+
+  RemoveFromCell(replica);
+  mReplicaPositions.Erase(replica);
+
+  // (Live replicas without a position are relevant to every link)
+  if (replica->IsLive())
+    mUnplacedReplicas.Insert(replica);
+}
+
+void SpatialRelevancyFilter::SetLinkViewer(ReplicatorId replicatorId, Vec3Param position)
+{
+  mLinkViewers.InsertOrAssign(replicatorId, position);
+}
+void SpatialRelevancyFilter::ClearLinkViewer(ReplicatorId replicatorId)
+{
+  mLinkViewers.EraseValue(replicatorId);
+}
+
+float SpatialRelevancyFilter::GetRelevancy(ReplicatorLink* link, Replica* replica)
+{
+  // Replica has no position?
+  Vec3* position = mReplicaPositions.FindPointer(replica);
+  if (!position)
+    return 1.0f;
+
+  // Link has no viewer?
+  Vec3* viewer = mLinkViewers.FindPointer(link->GetReplicatorId());
+  if (!viewer)
+    return 1.0f;
+
+  // Replicas the link already knows about may move a little further away
+  // before they stop being relevant
+  float radius = mRadius;
+  if (link->HasReplica(replica))
+    radius *= 1.0f + mHysteresis;
+
+  // Outside the radius?
+  float distance = Math::Length(*position - *viewer);
+  if (distance > radius)
+    return 0.0f;
+
+  // Fall off linearly to the minimum relevancy at the radius
+  float ratio = Math::Min(distance / mRadius, 1.0f);
+  return Math::Lerp(1.0f, mMinRelevancy, ratio);
+}
+bool SpatialRelevancyFilter::GatherCandidates(ReplicatorLink* link, ReplicaArray& candidates)
+{
+  // Link has no viewer?
+  Vec3* viewer = mLinkViewers.FindPointer(link->GetReplicatorId());
+  if (!viewer)
+    return false; // (Every replica is relevant to it)
+
+  // Gather the cells around the viewer
+  // (Cells are as big as the radius so the neighboring cells cover it)
+  IntVec3 center = GetCell(*viewer);
+  for (int z = -1; z <= 1; ++z)
+    for (int y = -1; y <= 1; ++y)
+      for (int x = -1; x <= 1; ++x)
+      {
+        ReplicaArray* cell = mCells.FindPointer(GetCellKey(center + IntVec3(x, y, z)));
+        if (cell)
+          candidates.Append(cell->All());
+      }
+
+  // Gather the replicas without a position
+  candidates.Append(mUnplacedReplicas.All());
+  return true;
+}
+void SpatialRelevancyFilter::OnLiveReplica(Replica* replica)
+{
+  // Not yet placed?
+  if (!mReplicaPositions.ContainsKey(replica))
+    mUnplacedReplicas.Insert(replica);
+}
+void SpatialRelevancyFilter::OnInvalidReplica(Replica* replica)
+{
+  RemoveFromCell(replica);
+  mReplicaPositions.Erase(replica);
+  mUnplacedReplicas.EraseValue(replica);
+}
+void SpatialRelevancyFilter::OnRemovingLink(ReplicatorLink* link)
+{
+  ClearLinkViewer(link->GetReplicatorId());
+}
+
+IntVec3 SpatialRelevancyFilter::GetCell(Vec3Param position) const
+{
+  return IntVec3((int)Math::Floor(position.x / mRadius),
+                 (int)Math::Floor(position.y / mRadius),
+                 (int)Math::Floor(position.z / mRadius));
+}
+SpatialRelevancyFilter::CellKey SpatialRelevancyFilter::GetCellKey(const IntVec3& cell)
+{
+  // (Cells outside of the representable range wrap around, which only costs
+  // some extra candidates)
+  u64 x = u64(cell.x + cCellKeyOffset) & cCellKeyMask;
+  u64 y = u64(cell.y + cCellKeyOffset) & cCellKeyMask;
+  u64 z = u64(cell.z + cCellKeyOffset) & cCellKeyMask;
+  return x | (y << cCellKeyBits) | (z << (cCellKeyBits * 2));
+}
+void SpatialRelevancyFilter::RemoveFromCell(Replica* replica)
+{
+  // Not placed?
+  Vec3* position = mReplicaPositions.FindPointer(replica);
+  if (!position)
+    return;
+
+  // Find cell
+  CellKey key = GetCellKey(GetCell(*position));
+  ReplicaArray* cell = mCells.FindPointer(key);
+  if (!cell)
+  {
+    Assert(false);
+    return;
+  }
+
+  // Swap remove the replica (order doesn't matter)
+  for (size_t i = 0; i < cell->Size(); ++i)
+  {
+    if ((*cell)[i] == replica)
+    {
+      (*cell)[i] = cell->Back();
+      cell->PopBack();
+      break;
+    }
+  }
+
+  // Cell is empty?
+  if (cell->Empty())
+    mCells.Erase(key);
+}
+
+} // namespace Zero
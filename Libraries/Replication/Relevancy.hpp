@@ -0,0 +1,197 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+//                               RelevancyFilter //
+
+/// Relevancy Filter
+/// Decides which live replicas a replicator link should know about
+/// Filters are installed on a server replicator, which combines them by
+/// multiplying their relevancies together (every filter must find a replica
+/// relevant for the link to know about it). Only spawned replicas are
+/// filtered, emplaced replicas are always known by every link.
+class RelevancyFilter
+{
+public:
+  /// Destructor
+  virtual ~RelevancyFilter()
+  {
+  }
+
+  /// Called at the start of every replicator update, before any relevancy is
+  /// evaluated
+  virtual void UpdateStart()
+  {
+  }
+
+  /// Returns how relevant the replica is to the replicator link, from 0 to 1
+  /// 0 means the replica is not relevant (it will be forgotten remotely)
+  /// 1 means every change is sent as soon as it is observed, lower values send
+  /// full state changes less often (see ReplicatorLink::ShouldDeferChange)
+  virtual float GetRelevancy(ReplicatorLink* link, Replica* replica) = 0;
+
+  /// Optionally narrows down the replicas that need to be evaluated for the
+  /// link (replicas the link already knows about are always evaluated)
+  /// Returns true if the candidates were gathered, else false (every live
+  /// replica will be evaluated)
+  virtual bool GatherCandidates(ReplicatorLink* link, ReplicaArray& candidates)
+  {
+    return false;
+  }
+
+  /// Called after a replica is made live
+  virtual void OnLiveReplica(Replica* replica)
+  {
+  }
+  /// Called before a replica is made invalid
+  virtual void OnInvalidReplica(Replica* replica)
+  {
+  }
+  /// Called before a link is removed
+  virtual void OnRemovingLink(ReplicatorLink* link)
+  {
+  }
+};
+
+/// Typedefs
+typedef UniquePointer<RelevancyFilter> RelevancyFilterPtr;
+typedef Array<RelevancyFilterPtr> RelevancyFilterArray;
+
+//                             OwnerRelevancyFilter //
+
+/// Owner Relevancy Filter
+/// Makes selected replicas relevant only to their change authority client
+/// (All other replicas are left relevant)
+class OwnerRelevancyFilter : public RelevancyFilter
+{
+public:
+  /// Makes the replica relevant only to its change authority client
+  void AddOwnerOnlyReplica(Replica* replica);
+  /// Makes the replica relevant to every link again
+  void RemoveOwnerOnlyReplica(Replica* replica);
+  /// Returns true if the replica is relevant only to its change authority
+  /// client, else false
+  bool IsOwnerOnlyReplica(Replica* replica) const;
+
+  //
+  // Relevancy Filter Interface
+  //
+
+  float GetRelevancy(ReplicatorLink* link, Replica* replica) override;
+  void OnInvalidReplica(Replica* replica) override;
+
+  /// Data
+  ReplicaSet mOwnerOnlyReplicas; /// Replicas only relevant to their owner
+};
+
+//                              TeamRelevancyFilter //
+
+/// Team Relevancy Filter
+/// Makes replicas on a team relevant only to links on the same team
+/// (Replicas and links without a team are left relevant)
+class TeamRelevancyFilter : public RelevancyFilter
+{
+public:
+  /// Team ID representing no team
+  static const uint cNoTeam = 0;
+
+  /// Sets the team of the link's replicator (cNoTeam to clear it)
+  void SetLinkTeam(ReplicatorId replicatorId, uint team);
+  /// Returns the team of the link's replicator, else cNoTeam
+  uint GetLinkTeam(ReplicatorId replicatorId) const;
+
+  /// Sets the team of the replica (cNoTeam to clear it)
+  void SetReplicaTeam(Replica* replica, uint team);
+  /// Returns the team of the replica, else cNoTeam
+  uint GetReplicaTeam(Replica* replica) const;
+
+  //
+  // Relevancy Filter Interface
+  //
+
+  float GetRelevancy(ReplicatorLink* link, Replica* replica) override;
+  void OnInvalidReplica(Replica* replica) override;
+  void OnRemovingLink(ReplicatorLink* link) override;
+
+  /// Data
+  ArrayMap<ReplicatorId, uint> mLinkTeams; /// Team of each link's replicator
+  HashMap<Replica*, uint> mReplicaTeams;   /// Team of each replica
+};
+
+//                            SpatialRelevancyFilter //
+
+/// Spatial Relevancy Filter
+/// Makes replicas relevant to the links whose viewer is within a radius of
+/// them. Relevancy falls off linearly from 1 at the viewer to
+/// mMinRelevancy at the radius. Replicas are bucketed into a uniform grid so
+/// that only the cells around each viewer are gathered.
+/// (Replicas without a position and links without a viewer are left
+/// relevant)
+class SpatialRelevancyFilter : public RelevancyFilter
+{
+public:
+  /// Constructor
+  SpatialRelevancyFilter();
+
+  /// Controls the distance a replica becomes relevant within
+  /// (Also sets the grid cell size)
+  void SetRadius(float radius);
+  float GetRadius() const;
+
+  /// Controls how much further than the radius a relevant replica may move
+  /// before it stops being relevant (as a ratio of the radius)
+  /// Prevents replicas on the boundary from being forgotten and cloned
+  /// repeatedly
+  void SetHysteresis(float hysteresis);
+  float GetHysteresis() const;
+
+  /// Controls the relevancy of a replica at the edge of the radius
+  void SetMinRelevancy(float minRelevancy);
+  float GetMinRelevancy() const;
+
+  /// Sets the position of the replica
+  void SetReplicaPosition(Replica* replica, Vec3Param position);
+  /// Clears the position of the replica (it will be relevant to every link)
+  void ClearReplicaPosition(Replica* replica);
+
+  /// Sets the viewer position of the link's replicator
+  void SetLinkViewer(ReplicatorId replicatorId, Vec3Param position);
+  /// Clears the viewer position of the link's replicator (every replica will
+  /// be relevant to it)
+  void ClearLinkViewer(ReplicatorId replicatorId);
+
+  //
+  // Relevancy Filter Interface
+  //
+
+  float GetRelevancy(ReplicatorLink* link, Replica* replica) override;
+  bool GatherCandidates(ReplicatorLink* link, ReplicaArray& candidates) override;
+  void OnLiveReplica(Replica* replica) override;
+  void OnInvalidReplica(Replica* replica) override;
+  void OnRemovingLink(ReplicatorLink* link) override;
+
+  /// Grid cell coordinates packed into 21 bits per axis
+  typedef u64 CellKey;
+  typedef HashMap<CellKey, ReplicaArray> CellMap;
+  typedef HashMap<Replica*, Vec3> PositionMap;
+
+  /// Returns the coordinates of the cell containing the position
+  IntVec3 GetCell(Vec3Param position) const;
+  /// Returns the key of the cell with the given coordinates
+  static CellKey GetCellKey(const IntVec3& cell);
+  /// Removes the replica from its grid cell (if any)
+  void RemoveFromCell(Replica* replica);
+
+  /// Data
+  float mRadius;                             /// Relevancy radius (and grid cell size)
+  float mHysteresis;                         /// Extra radius ratio before a replica stops being relevant
+  float mMinRelevancy;                       /// Relevancy at the edge of the radius
+  PositionMap mReplicaPositions;             /// Position of each placed replica
+  ReplicaSet mUnplacedReplicas;              /// Live replicas without a position
+  ArrayMap<ReplicatorId, Vec3> mLinkViewers; /// Viewer position of each link's replicator
+  CellMap mCells;                            /// Placed replicas bucketed by grid cell
+};
+
+} // namespace Zero
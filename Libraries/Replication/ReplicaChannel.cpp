@@ -468,6 +468,38 @@ bool ReplicaChannel::ObserveForChange()
   }
 }
 
+bool ReplicaChannel::SerializesFullState() const
+{
+  // Serializes changed replica properties only?
+  if (GetReplicaChannelType()->GetSerializationMode() != SerializationMode::All && GetReplicaProperties().Size() != 1)
+    return false;
+
+  // For all replica properties
+  forRange (ReplicaProperty* replicaProperty, GetReplicaProperties().All())
+  {
+    // Serializes changed primitive-components only?
+    if (replicaProperty->GetReplicaPropertyType()->GetSerializationMode() != SerializationMode::All)
+      return false;
+  }
+
+  return true;
+}
+bool ReplicaChannel::UsesDeltaCompression() const
+{
+  // Get replica channel type
+  ReplicaChannelType* replicaChannelType = GetReplicaChannelType();
+
+  //    Delta compression is disabled?
+  // OR Changes must be released in order?
+  // (Delta compression discards late changes itself, which ordered changes
+  // would never be)
+  if (!replicaChannelType->GetUseDeltaCompression() || replicaChannelType->GetTransferMode() == TransferMode::Ordered)
+    return false;
+
+  // (Delta baselines must contain the complete replica channel state)
+  return SerializesFullState();
+}
+
 bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const
 {
   // Get replica channel type
@@ -924,6 +956,7 @@ void ReplicaChannelType::ResetConfig()
   SetReliabilityMode();
   SetTransferMode();
   SetAccurateTimestampOnChange();
+  SetUseDeltaCompression();
 }
 
 void ReplicaChannelType::SetDetectOutgoingChanges(bool detectOutgoingChanges)
@@ -1130,4 +1163,21 @@ bool ReplicaChannelType::GetAccurateTimestampOnChange() const
   return mAccurateTimestampOnChange;
 }
 
+void ReplicaChannelType::SetUseDeltaCompression(bool useDeltaCompression)
+{
+  // Already valid?
+  if (IsValid())
+  {
+    // Unable to modify configuration
+    Error("ReplicaChannelType is already valid, unable to modify configuration");
+    return;
+  }
+
+  mUseDeltaCompression = useDeltaCompression;
+}
+bool ReplicaChannelType::GetUseDeltaCompression() const
+{
+  return mUseDeltaCompression;
+}
+
 } // namespace Zero
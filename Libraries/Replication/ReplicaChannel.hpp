@@ -161,6 +161,14 @@ public:
   /// Returns true if a change was detected, else false
   bool ObserveForChange();
 
+  /// Returns true if every change serialization writes the complete state of
+  /// the replica channel (independent of previously sent changes), else false
+  bool SerializesFullState() const;
+  /// Returns true if changes are delta compressed against the last state
+  /// acknowledged by each link, else false
+  /// (Requires a full state serialization and a non-ordered transfer mode)
+  bool UsesDeltaCompression() const;
+
   /// Serializes the replica channel
   /// Returns true if successful, else false
   bool Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const;
@@ -387,6 +395,14 @@ public:
   void SetAccurateTimestampOnChange(bool accurateTimestampOnChange = false);
   bool GetAccurateTimestampOnChange() const;
 
+  /// Controls whether or not replica channel changes are delta compressed
+  /// against the last change acknowledged by each link (Only used with replica
+  /// channels that serialize their full state and a non-ordered transfer mode,
+  /// late changes are discarded as if sequenced) (Cannot be modified after the
+  /// replica channel type has been made valid)
+  void SetUseDeltaCompression(bool useDeltaCompression = false);
+  bool GetUseDeltaCompression() const;
+
   /// Data
   String mName;                                 /// Replica channel type name
   Replicator* mReplicator;                      /// Operating replicator
@@ -409,6 +425,7 @@ public:
   ReliabilityMode::Enum mReliabilityMode;       /// Change message reliability mode
   TransferMode::Enum mTransferMode;             /// Change message transfer mode
   bool mAccurateTimestampOnChange;              /// Accurate timestamp when changed?
+  bool mUseDeltaCompression;                    /// Use delta compression?
 };
 
 /// Typedefs
@@ -1061,6 +1061,14 @@ void ReplicaProperty::ReactToChanges(TimeMs timestamp,
 // Internal
 //
 
+/// Returns true if the replica property type should be serialized using the
+/// smallest three encoding, else false
+inline bool ShouldUseSmallestThree(const ReplicaPropertyType* replicaPropertyType)
+{
+  return replicaPropertyType->GetUseSmallestThree() &&
+         replicaPropertyType->GetNativeTypeId() == BasicNativeType::Quaternion;
+}
+
 /// (Arithmetic property type behavior)
 template <typename PropertyType, TF_ENABLE_IF(IsBasicNativeTypeArithmetic<PropertyType>::Value)>
 bool SerializeArithmetic(BitStream& bitStream,
@@ -1599,8 +1607,16 @@ bool ReplicaProperty::Serialize(BitStream& bitStream, ReplicationPhase::Enum rep
   bool shouldQuantize = (useQuantization && quantizationRangeMin.IsNotEmpty() && quantizationRangeMax.IsNotEmpty() &&
                          quantum.IsNotEmpty());
 
+  // Should use smallest three?
+  // (The whole quaternion is always serialized)
+  if (ShouldUseSmallestThree(replicaPropertyType))
+  {
+    // Write current value
+    Variant currentValue = GetValue();
+    return WriteSmallestThree(bitStream, currentValue.GetOrError<Quat>()) != 0;
+  }
   // Should not quantize?
-  if (!shouldQuantize)
+  else if (!shouldQuantize)
   {
     // Switch on property's native type
     switch (replicaPropertyType->GetNativeTypeId())
@@ -1664,10 +1680,19 @@ bool ReplicaProperty::Deserialize(const BitStream& bitStream, ReplicationPhase::
   bool shouldQuantize = (useQuantization && quantizationRangeMin.IsNotEmpty() && quantizationRangeMax.IsNotEmpty() &&
                          quantum.IsNotEmpty());
 
-  // Should not quantize?
+  // Should use smallest three?
   Variant newValue;
   bool result = false;
-  if (!shouldQuantize)
+  if (ShouldUseSmallestThree(replicaPropertyType))
+  {
+    // Read new value
+    Quat value;
+    result = ReadSmallestThree(bitStream, value);
+    if (result) // Successful?
+      newValue = value;
+  }
+  // Should not quantize?
+  else if (!shouldQuantize)
   {
     // Switch on property's native type
     switch (replicaPropertyType->GetNativeTypeId())
@@ -2167,6 +2192,7 @@ void ReplicaPropertyType::ResetConfig()
   SetSerializationMode();
   SetUseHalfFloats();
   SetUseQuantization();
+  SetUseSmallestThree();
   SetQuantizationRangeMin();
   SetQuantizationRangeMax();
   SetUseInterpolation();
@@ -2370,7 +2396,10 @@ void ReplicaPropertyType::SetUseHalfFloats(bool useHalfFloats)
 
   // Using half floats?
   if (mUseHalfFloats)
-    SetUseQuantization(false); // Disable quantization
+  {
+    SetUseQuantization(false);  // Disable quantization
+    SetUseSmallestThree(false); // Disable smallest three
+  }
 }
 bool ReplicaPropertyType::GetUseHalfFloats() const
 {
@@ -2403,6 +2432,7 @@ void ReplicaPropertyType::SetUseQuantization(bool useQuantization)
   {
     SetUseDeltaThreshold(true); // Enable delta threshold
     SetUseHalfFloats(false);    // Disable half floats
+    SetUseSmallestThree(false); // Disable smallest three
   }
 }
 bool ReplicaPropertyType::GetUseQuantization() const
@@ -2410,6 +2440,38 @@ bool ReplicaPropertyType::GetUseQuantization() const
   return mUseQuantization;
 }
 
+void ReplicaPropertyType::SetUseSmallestThree(bool useSmallestThree)
+{
+  // Attempting to use smallest three?
+  if (useSmallestThree)
+  {
+    // (Should only be used with quaternion replica property types)
+    Assert(GetNativeTypeId() == BasicNativeType::Quaternion);
+  }
+
+  // Already valid?
+  if (IsValid())
+  {
+    // Unable to modify configuration
+    Error("ReplicaPropertyType is already valid, unable to modify configuration");
+    return;
+  }
+
+  // Set use smallest three
+  mUseSmallestThree = useSmallestThree;
+
+  // Using smallest three?
+  if (mUseSmallestThree)
+  {
+    SetUseHalfFloats(false);   // Disable half floats
+    SetUseQuantization(false); // Disable quantization
+  }
+}
+bool ReplicaPropertyType::GetUseSmallestThree() const
+{
+  return mUseSmallestThree;
+}
+
 void ReplicaPropertyType::SetQuantizationRangeMin(const Variant& quantizationRangeMin)
 {
   // Attempting to use quantization?
@@ -338,6 +338,16 @@ public:
   void SetUseQuantization(bool useQuantization = false);
   bool GetUseQuantization() const;
 
+  /// Controls whether or not a quaternion replica property is serialized using
+  /// the smallest three encoding (the index of the largest component followed
+  /// by the other three components quantized, 32 bits in total) (Only used with
+  /// quaternion replica property types, the whole quaternion is always
+  /// serialized) (Using smallest three is mutually exclusive with using half
+  /// floats and quantization) (Cannot be modified after the replica property
+  /// type has been made valid)
+  void SetUseSmallestThree(bool useSmallestThree = false);
+  bool GetUseSmallestThree() const;
+
   /// Controls the minimum, inclusive value at which a replica property's
   /// primitive-components may be quantized during serialization (Only used with
   /// arithmetic replica property primitive-component types) (Cannot be modified
@@ -452,6 +462,7 @@ public:
   SerializationMode::Enum mSerializationMode; /// Serialization mode
   bool mUseHalfFloats;                        /// Use half floats?
   bool mUseQuantization;                      /// Use quantization?
+  bool mUseSmallestThree;                     /// Use smallest three?
   Variant mQuantizationRangeMin;              /// Quantization range minimum
   Variant mQuantizationRangeMax;              /// Quantization range maximum
   bool mUseInterpolation;                     /// Use interpolation?
@@ -0,0 +1,283 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+namespace
+{
+const float cFrameRate = 60.0f;
+const float cTimeStep = 1.0f / cFrameRate;
+// Acknowledgements arrive this many frames after a change is sent (100ms)
+const uint cAckLatency = 6;
+const float cPacketLoss = 0.05f;
+const uint cSeed = 1337;
+
+// Positions are quantized to centimeters within this extent
+const float cWorldExtent = 512.0f;
+const float cPositionQuantum = 0.01f;
+const float cRotationQuantum = 0.001f;
+const float cMaxSpeed = 10.0f;
+const float cMaxAngularSpeed = 3.0f;
+// Only some of the replicas rotate, the rest keep their rotation
+const float cRotatingRatio = 0.5f;
+
+DeclareEnum4(ReplicationEncoding, Float, HalfFloat, Quantized, SmallestThree);
+
+struct BenchmarkReplica
+{
+  Vec3 mPosition;
+  Vec3 mVelocity;
+  Quat mRotation;
+  Quat mSpin;
+  OutDeltaChannel mDeltaChannel;
+};
+
+/// Snapshot sent this frame, received (or lost) once the acknowledgement
+/// latency has passed
+struct BenchmarkAck
+{
+  uint mReplicaIndex;
+  uint mFrame;
+  bool mLost;
+};
+
+void WriteBenchmarkState(BitStream& bitStream,
+                         ReplicationEncoding::Enum encoding,
+                         Vec3Param position,
+                         QuatParam rotation)
+{
+  switch (encoding)
+  {
+  default:
+  case ReplicationEncoding::Float:
+    for (uint i = 0; i < 3; ++i)
+      bitStream.Write(position[i]);
+    for (uint i = 0; i < 4; ++i)
+      bitStream.Write(rotation[i]);
+    break;
+
+  case ReplicationEncoding::HalfFloat:
+    for (uint i = 0; i < 3; ++i)
+      bitStream.Write(HalfFloatConverter::ToHalfFloat(position[i]));
+    for (uint i = 0; i < 4; ++i)
+      bitStream.Write(HalfFloatConverter::ToHalfFloat(rotation[i]));
+    break;
+
+  case ReplicationEncoding::Quantized:
+    for (uint i = 0; i < 3; ++i)
+      bitStream.WriteQuantized(position[i], -cWorldExtent, cWorldExtent, cPositionQuantum);
+    for (uint i = 0; i < 4; ++i)
+      bitStream.WriteQuantized(rotation[i], -1.0f, 1.0f, cRotationQuantum);
+    break;
+
+  case ReplicationEncoding::SmallestThree:
+    for (uint i = 0; i < 3; ++i)
+      bitStream.WriteQuantized(position[i], -cWorldExtent, cWorldExtent, cPositionQuantum);
+    WriteSmallestThree(bitStream, rotation);
+    break;
+  }
+}
+
+/// Returns true if both states contain the same bits, else false
+/// (Ignores the unwritten bits of the last byte)
+bool BenchmarkStatesMatch(const BitStream& a, const BitStream& b)
+{
+  if (a.GetBitsWritten() != b.GetBitsWritten())
+    return false;
+
+  a.ClearBitsRead();
+  b.ClearBitsRead();
+  for (Bits i = 0; i < a.GetBitsWritten(); ++i)
+  {
+    bool bitA = false;
+    bool bitB = false;
+    a.Read(bitA);
+    b.Read(bitB);
+    if (bitA != bitB)
+      return false;
+  }
+  return true;
+}
+
+void CreateBenchmarkReplicas(uint replicaCount, Array<BenchmarkReplica>& replicas)
+{
+  // Use the same seed for each encoding so they send the same motion
+  Math::Random random(cSeed);
+
+  replicas.Resize(replicaCount);
+  forRange (BenchmarkReplica& replica, replicas.All())
+  {
+    float halfExtent = cWorldExtent * 0.5f;
+    replica.mPosition = Vec3(random.FloatRange(-halfExtent, halfExtent),
+                             random.FloatRange(-halfExtent, halfExtent),
+                             random.FloatRange(-halfExtent, halfExtent));
+    replica.mVelocity = Vec3(random.FloatRange(-cMaxSpeed, cMaxSpeed),
+                             random.FloatRange(-cMaxSpeed, cMaxSpeed),
+                             random.FloatRange(-cMaxSpeed, cMaxSpeed));
+
+    Vec3 axis = Math::Normalized(Vec3(random.FloatRange(-1, 1), random.FloatRange(-1, 1), random.FloatRange(1, 2)));
+    replica.mRotation = Math::ToQuaternion(axis, random.FloatRange(0, Math::cTwoPi));
+
+    float angularSpeed = (random.Float() < cRotatingRatio) ? random.FloatRange(0, cMaxAngularSpeed) : 0.0f;
+    replica.mSpin = Math::ToQuaternion(axis, angularSpeed * cTimeStep);
+  }
+}
+
+/// Returns the bits sent per replica per second
+float SimulateReplication(ReplicationEncoding::Enum encoding,
+                          bool useDelta,
+                          uint replicaCount,
+                          uint frames,
+                          double& msPerFrame,
+                          uint& decodeErrors)
+{
+  Math::Random random(cSeed);
+  Array<BenchmarkReplica> replicas;
+  CreateBenchmarkReplicas(replicaCount, replicas);
+
+  Array<BenchmarkAck> acks;
+  uint64 bitsSent = 0;
+  BenchmarkTimer timer;
+  decodeErrors = 0;
+
+  BitStream state;
+  BitStream decoded;
+  for (uint frame = 0; frame < frames; ++frame)
+  {
+    // Receive the acknowledgements that have arrived
+    // (Acks are queued in frame order so the arrived ones are at the front)
+    uint arrived = 0;
+    while (arrived < acks.Size() && acks[arrived].mFrame + cAckLatency <= frame)
+    {
+      BenchmarkAck& ack = acks[arrived++];
+      OutDeltaChannel& deltaChannel = replicas[ack.mReplicaIndex].mDeltaChannel;
+      OutDeltaSnapshot& snapshot = deltaChannel.mPendingSnapshots.Front();
+      if (!ack.mLost && (!deltaChannel.mHasBaseline || IsSnapshotNewer(snapshot.mSnapshotId, deltaChannel.mBaselineId)))
+      {
+        deltaChannel.mHasBaseline = true;
+        deltaChannel.mBaselineId = snapshot.mSnapshotId;
+        deltaChannel.mBaseline = ZeroMove(snapshot.mState);
+      }
+      deltaChannel.mPendingSnapshots.EraseAt(0);
+    }
+    acks.Erase(acks.SubRange(0, arrived));
+
+    // Move every replica
+    forRange (BenchmarkReplica& replica, replicas.All())
+    {
+      replica.mPosition += replica.mVelocity * cTimeStep;
+      for (uint i = 0; i < 3; ++i)
+      {
+        // Bounce off the edges of the world
+        if (Math::Abs(replica.mPosition[i]) > cWorldExtent * 0.5f)
+          replica.mVelocity[i] = -replica.mVelocity[i];
+      }
+      replica.mRotation = Math::Normalized(replica.mSpin * replica.mRotation);
+    }
+
+    // Send a change for every replica
+    timer.Start();
+    BitStream message;
+    for (uint i = 0; i < replicas.Size(); ++i)
+    {
+      BenchmarkReplica& replica = replicas[i];
+
+      state.Clear(false);
+      WriteBenchmarkState(state, encoding, replica.mPosition, replica.mRotation);
+
+      message.Clear(false);
+      if (!useDelta)
+      {
+        message.AppendAll(state);
+      }
+      else
+      {
+        // Same as ReplicatorLink::SendDeltaChange
+        OutDeltaChannel& deltaChannel = replica.mDeltaChannel;
+        SnapshotId snapshotId = deltaChannel.mNextSnapshotId++;
+
+        uint32 baselineDistance = 0;
+        if (deltaChannel.mHasBaseline && (snapshotId % cKeyframeInterval) != 0 &&
+            deltaChannel.mBaseline.GetBitsWritten() == state.GetBitsWritten())
+        {
+          SnapshotId distance = SnapshotId(snapshotId - deltaChannel.mBaselineId);
+          if (distance <= cMaxBaselineDistance)
+            baselineDistance = distance;
+        }
+
+        message.Write(snapshotId);
+        message.WriteQuantized(baselineDistance, uint32(0), uint32(cMaxBaselineDistance));
+        if (baselineDistance == 0)
+        {
+          message.AppendAll(state);
+        }
+        else
+        {
+          WriteDelta(message, deltaChannel.mBaseline, state);
+
+          // Make sure the delta decodes back to the same state
+          message.ClearBitsRead();
+          SnapshotId readSnapshotId = 0;
+          uint32 readBaselineDistance = 0;
+          message.Read(readSnapshotId);
+          message.ReadQuantized(readBaselineDistance, uint32(0), uint32(cMaxBaselineDistance));
+          if (!ReadDelta(message, deltaChannel.mBaseline, decoded) || !BenchmarkStatesMatch(decoded, state))
+            ++decodeErrors;
+        }
+
+        OutDeltaSnapshot snapshot;
+        snapshot.mSnapshotId = snapshotId;
+        snapshot.mState = state;
+        deltaChannel.mPendingSnapshots.PushBack(snapshot);
+
+        BenchmarkAck ack;
+        ack.mReplicaIndex = i;
+        ack.mFrame = frame;
+        ack.mLost = (random.Float() < cPacketLoss);
+        acks.PushBack(ack);
+      }
+
+      bitsSent += message.GetBitsWritten();
+    }
+    timer.Stop();
+  }
+
+  msPerFrame = timer.GetMsPerRun(frames);
+  float seconds = float(Math::Max(frames, 1u)) / cFrameRate;
+  return float(bitsSent) / float(Math::Max(replicaCount, 1u)) / seconds;
+}
+
+} // namespace
+
+void RunReplicationBenchmark(uint replicaCount, uint frames)
+{
+  for (uint encoding = 0; encoding < ReplicationEncoding::Size; ++encoding)
+  {
+    for (uint useDelta = 0; useDelta < 2; ++useDelta)
+    {
+      double msPerFrame = 0.0;
+      uint decodeErrors = 0;
+      float bitsPerSecond = SimulateReplication(
+          (ReplicationEncoding::Enum)encoding, useDelta != 0, replicaCount, frames, msPerFrame, decodeErrors);
+      PrintBenchmarkResult("ReplicationBenchmark",
+                           "%s%s, %u replicas, %.1f bits per replica per second, %.3f ms per frame, "
+                           "%u decode errors",
+                           ReplicationEncoding::Names[encoding],
+                           useDelta ? " delta" : "",
+                           replicaCount,
+                           bitsPerSecond,
+                           msPerFrame,
+                           decodeErrors);
+    }
+  }
+}
+
+void RunReplicationBenchmarks()
+{
+  RunReplicationBenchmark(100);
+  RunReplicationBenchmark(1000);
+  RunReplicationBenchmark(10000);
+}
+
+} // namespace Zero
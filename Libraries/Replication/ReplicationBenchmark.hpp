@@ -0,0 +1,19 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+/// Moves the given number of transforms (position and rotation) for the given
+/// number of 60Hz frames and sends each one as a replica channel change using
+/// every property encoding, both in full and delta compressed against the last
+/// acknowledged change (with a few frames of acknowledgement latency and some
+/// packet loss). Prints the bits sent per replica per second and the average
+/// time spent encoding each frame (delta compressed changes are also decoded
+/// to check that they round trip).
+void RunReplicationBenchmark(uint replicaCount, uint frames = 600);
+
+/// Runs the replication benchmark at 100, 1k and 10k replicas.
+void RunReplicationBenchmarks();
+
+} // namespace Zero
@@ -40,6 +40,8 @@ class OutPacket;
 class OutMessage;
 class FragmentedMessage;
 class InMessageChannel;
+class MessageBufferPool;
+class LoopbackNetwork;
 } // namespace Zero
 
 // Peer Includes
@@ -47,8 +49,10 @@ class InMessageChannel;
 #include "BandwidthStats.hpp"
 #include "MessageConfig.hpp"
 #include "Message.hpp"
+#include "MessageBufferPool.hpp"
 #include "PacketConfig.hpp"
 #include "Packet.hpp"
+#include "LoopbackNetwork.hpp"
 #include "MessageChannel.hpp"
 #include "ProtocolMessageData.hpp"
 #include "LinkInbox.hpp"
@@ -69,6 +73,7 @@ class ReplicaChannelType;
 class ReplicaProperty;
 class ReplicaPropertyType;
 class Route;
+class RelevancyFilter;
 } // namespace Zero
 
 // Replicator Includes
@@ -78,5 +83,8 @@ class Route;
 #include "ReplicaChannel.hpp"
 #include "Replica.hpp"
 #include "ReplicaStream.hpp"
+#include "Relevancy.hpp"
+#include "DeltaCompression.hpp"
 #include "ReplicatorLink.hpp"
 #include "Replicator.hpp"
+#include "ReplicationBenchmark.hpp"
@@ -25,6 +25,8 @@ void Replicator::ResetSession()
   // mFrameFillSkip = 0;
   // mReplicaChannelTypes.Clear();
   // mReplicaPropertyTypes.Clear();
+  // mRelevancyFilters.Clear();
+  mRelevancyFrameId = 0;
 }
 
 Replicator::Replicator(Role::Enum role) :
@@ -574,6 +576,7 @@ void Replicator::ResetConfig()
 {
   SetFrameFillWarning();
   SetFrameFillSkip();
+  SetRelevancyInterval();
 }
 
 void Replicator::SetFrameFillWarning(float frameFillWarning)
@@ -594,6 +597,89 @@ float Replicator::GetFrameFillSkip() const
   return mFrameFillSkip;
 }
 
+void Replicator::SetRelevancyInterval(uint relevancyInterval)
+{
+  mRelevancyInterval = Math::Max(relevancyInterval, uint(1));
+}
+uint Replicator::GetRelevancyInterval() const
+{
+  return mRelevancyInterval;
+}
+
+//
+// Relevancy Filter Management
+//
+
+RelevancyFilter* Replicator::AddRelevancyFilter(RelevancyFilterPtr relevancyFilter)
+{
+  Assert(GetRole() == Role::Server);
+
+  // Invalid relevancy filter?
+  if (!relevancyFilter)
+  {
+    Assert(false);
+    return nullptr;
+  }
+
+  // Inform the relevancy filter of all current live replicas
+  forRange (Replica* replica, mReplicaSet.All())
+    relevancyFilter->OnLiveReplica(replica);
+
+  // Add relevancy filter
+  mRelevancyFilters.PushBack(ZeroMove(relevancyFilter));
+  return mRelevancyFilters.Back();
+}
+bool Replicator::RemoveRelevancyFilter(RelevancyFilter* relevancyFilter)
+{
+  // For all relevancy filters
+  for (size_t i = 0; i < mRelevancyFilters.Size(); ++i)
+  {
+    // Found relevancy filter?
+    if (mRelevancyFilters[i] == relevancyFilter)
+    {
+      // Remove relevancy filter
+      mRelevancyFilters.EraseAt(i);
+      return true;
+    }
+  }
+
+  // Failure
+  return false;
+}
+void Replicator::ClearRelevancyFilters()
+{
+  mRelevancyFilters.Clear();
+}
+
+bool Replicator::HasRelevancyFilters() const
+{
+  return !mRelevancyFilters.Empty();
+}
+const RelevancyFilterArray& Replicator::GetRelevancyFilters() const
+{
+  return mRelevancyFilters;
+}
+
+float Replicator::GetReplicaRelevancy(ReplicatorLink* link, Replica* replica)
+{
+  // Not spawned?
+  // (Emplaced replicas exist remotely regardless, so they are always relevant)
+  if (!replica->IsSpawned())
+    return 1.0f;
+
+  // For all relevancy filters
+  float relevancy = 1.0f;
+  forRange (RelevancyFilterPtr& relevancyFilter, mRelevancyFilters.All())
+  {
+    // Combine relevancy
+    relevancy *= Math::Clamp(relevancyFilter->GetRelevancy(link, replica), 0.0f, 1.0f);
+    if (relevancy == 0.0f) // Not relevant?
+      break;
+  }
+
+  return relevancy;
+}
+
 //
 // Replica Channel Type Management
 //
@@ -735,6 +821,10 @@ void Replicator::LiveReplica(Replica* replica)
     // first change is received, so there's nothing to do here)
   }
 
+  // For all relevancy filters
+  forRange (RelevancyFilterPtr& relevancyFilter, mRelevancyFilters.All())
+    relevancyFilter->OnLiveReplica(replica);
+
   // User callback
   OnLiveReplica(replica);
 }
@@ -746,6 +836,23 @@ void Replicator::InvalidReplica(Replica* replica, bool isForget)
   // User callback
   OnInvalidReplica(replica, isForget);
 
+  // Is server?
+  if (GetRole() == Role::Server)
+  {
+    // For all relevancy filters
+    forRange (RelevancyFilterPtr& relevancyFilter, mRelevancyFilters.All())
+      relevancyFilter->OnInvalidReplica(replica);
+
+    // For all links
+    PeerLinkSet links = GetLinks();
+    forRange (PeerLink* link, links.All())
+    {
+      // Stop withholding replica (if withheld)
+      ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
+      replicatorLink->mWithheldReplicas.EraseValue(replica);
+    }
+  }
+
   // For all replica channels
   forRange (ReplicaChannel* replicaChannel, replica->GetReplicaChannels().All())
   {
@@ -1036,6 +1143,198 @@ void Replicator::RemoveEmplacedReplica(Replica* replica)
   Assert(replica->IsInvalid());
 }
 
+//
+// Relevancy Helpers
+//
+
+void Replicator::UpdateRelevancy(TimeMs now)
+{
+  Assert(GetRole() == Role::Server);
+
+  // For all relevancy filters
+  forRange (RelevancyFilterPtr& relevancyFilter, mRelevancyFilters.All())
+    relevancyFilter->UpdateStart();
+
+  ++mRelevancyFrameId;
+
+  // For all links
+  PeerLinkSet links = GetLinks();
+  forRange (PeerLink* link, links.All())
+  {
+    // Get replicator link
+    ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
+
+    // Nothing to evaluate?
+    if (!HasRelevancyFilters() && replicatorLink->mWithheldReplicas.Empty())
+      continue; // Skip link
+
+    // Not this link's turn?
+    // (Links are staggered across the interval to spread out the cost)
+    if ((mRelevancyFrameId + replicatorLink->GetReplicatorId().value()) % mRelevancyInterval != 0)
+      continue; // Skip link
+
+    // Evaluate replica relevancy
+    UpdateLinkRelevancy(replicatorLink, now);
+  }
+}
+void Replicator::UpdateLinkRelevancy(ReplicatorLink* link, TimeMs now)
+{
+  //
+  // Evaluate Known Replicas
+  //
+
+  // For all replicas expected remotely
+  ReplicaArray leavingReplicas;
+  forRange (Replica* replica, link->mReplicaSet.All())
+  {
+    // Not spawned?
+    if (!replica->IsSpawned())
+      continue; // Skip
+
+    // No longer relevant?
+    float relevancy = GetReplicaRelevancy(link, replica);
+    if (relevancy == 0.0f)
+      leavingReplicas.PushBack(replica);
+    else
+      link->SetReplicaRelevancy(replica, relevancy);
+  }
+
+  //
+  // Evaluate Withheld Replicas
+  //
+
+  // Gather candidates (as narrowed down by the first relevancy filter able to)
+  ReplicaArray candidates;
+  bool gathered = false;
+  forRange (RelevancyFilterPtr& relevancyFilter, mRelevancyFilters.All())
+  {
+    if (relevancyFilter->GatherCandidates(link, candidates))
+    {
+      gathered = true;
+      break;
+    }
+  }
+  if (!gathered) // Not narrowed down?
+    candidates.Assign(link->mWithheldReplicas.All());
+
+  // For all candidates
+  ReplicaArray enteringReplicas;
+  Array<float> enteringRelevancies;
+  forRange (Replica* replica, candidates.All())
+  {
+    // Not withheld?
+    if (!link->mWithheldReplicas.Contains(replica))
+      continue; // Skip
+
+    // Now relevant?
+    float relevancy = GetReplicaRelevancy(link, replica);
+    if (relevancy != 0.0f)
+    {
+      enteringReplicas.PushBack(replica);
+      enteringRelevancies.PushBack(relevancy);
+    }
+  }
+
+  //
+  // Forget Leaving Replicas
+  //
+
+  if (!leavingReplicas.Empty() && link->SendForget(leavingReplicas, now))
+  {
+    // Withhold replicas until they are relevant again
+    forRange (Replica* replica, leavingReplicas.All())
+      link->mWithheldReplicas.Insert(replica);
+    link->mRelevancyForgetCount += leavingReplicas.Size();
+  }
+
+  //
+  // Clone Entering Replicas
+  //
+
+  // (A clone command serializes a single initialization timestamp, so replicas
+  // are cloned in batches sharing the same one)
+  while (!enteringReplicas.Empty())
+  {
+    // Gather replicas sharing the first replica's initialization timestamp
+    TimeMs timestamp = enteringReplicas.Front()->GetInitializationTimestamp();
+    ReplicaArray batchReplicas;
+    Array<float> batchRelevancies;
+    for (size_t i = 0; i < enteringReplicas.Size();)
+    {
+      // Different initialization timestamp?
+      if (enteringReplicas[i]->GetInitializationTimestamp() != timestamp)
+      {
+        ++i;
+        continue; // Skip
+      }
+
+      batchReplicas.PushBack(enteringReplicas[i]);
+      batchRelevancies.PushBack(enteringRelevancies[i]);
+      enteringReplicas.EraseAt(i);
+      enteringRelevancies.EraseAt(i);
+    }
+
+    // Send clone command
+    if (!link->SendClone(batchReplicas, timestamp)) // Unable?
+      continue;
+
+    // No longer withhold replicas
+    forRange (Replica* replica, batchReplicas.All())
+      link->mWithheldReplicas.EraseValue(replica);
+    link->mRelevancyCloneCount += batchReplicas.Size();
+
+    SetReplicaRelevancies(link, batchReplicas, batchRelevancies);
+  }
+}
+
+void Replicator::FilterRelevantReplicas(ReplicatorLink* link,
+                                        const ReplicaArray& replicas,
+                                        ReplicaArray& relevantReplicas,
+                                        Array<float>& relevancies)
+{
+  // For all replicas
+  forRange (Replica* replica, replicas.All())
+  {
+    // Relevant?
+    float relevancy = GetReplicaRelevancy(link, replica);
+    if (relevancy != 0.0f)
+    {
+      relevantReplicas.PushBack(replica);
+      relevancies.PushBack(relevancy);
+    }
+    // Not relevant?
+    else
+    {
+      // Withhold replica until it is relevant
+      link->mWithheldReplicas.Insert(replica);
+    }
+  }
+}
+void Replicator::FilterKnownReplicas(ReplicatorLink* link, const ReplicaArray& replicas, ReplicaArray& knownReplicas)
+{
+  // For all replicas
+  forRange (Replica* replica, replicas.All())
+  {
+    // Expected remotely?
+    if (link->HasReplica(replica))
+      knownReplicas.PushBack(replica);
+    // Withheld?
+    else
+      link->mWithheldReplicas.EraseValue(replica);
+  }
+}
+void Replicator::SetReplicaRelevancies(ReplicatorLink* link,
+                                       const ReplicaArray& replicas,
+                                       const Array<float>& relevancies)
+{
+  Assert(replicas.Size() == relevancies.Size());
+
+  // For all spawned replicas now expected remotely
+  for (size_t i = 0; i < replicas.Size(); ++i)
+    if (replicas[i]->IsSpawned() && link->HasReplica(replicas[i]))
+      link->SetReplicaRelevancy(replicas[i], relevancies[i]);
+}
+
 //
 // ID Helpers
 //
@@ -1472,8 +1771,20 @@ bool Replicator::RouteSpawn(const ReplicaArray& replicas, const Route& route, Ti
     // Get replicator link
     ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
-    // Send spawn command
-    replicatorLink->SendSpawn(replicas, timestamp);
+    // No relevancy filters?
+    if (!HasRelevancyFilters())
+    {
+      // Send spawn command
+      replicatorLink->SendSpawn(replicas, timestamp);
+      continue;
+    }
+
+    // Send spawn command (relevant replicas only)
+    ReplicaArray relevantReplicas;
+    Array<float> relevancies;
+    FilterRelevantReplicas(replicatorLink, replicas, relevantReplicas, relevancies);
+    if (!relevantReplicas.Empty() && replicatorLink->SendSpawn(relevantReplicas, timestamp))
+      SetReplicaRelevancies(replicatorLink, relevantReplicas, relevancies);
   }
 
   // Success
@@ -1564,8 +1875,20 @@ bool Replicator::RouteClone(const ReplicaArray& replicas, const Route& route, Ti
     // Get replicator link
     ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
-    // Send clone command
-    replicatorLink->SendClone(replicas, timestamp);
+    // No relevancy filters?
+    if (!HasRelevancyFilters())
+    {
+      // Send clone command
+      replicatorLink->SendClone(replicas, timestamp);
+      continue;
+    }
+
+    // Send clone command (relevant replicas only)
+    ReplicaArray relevantReplicas;
+    Array<float> relevancies;
+    FilterRelevantReplicas(replicatorLink, replicas, relevantReplicas, relevancies);
+    if (!relevantReplicas.Empty() && replicatorLink->SendClone(relevantReplicas, timestamp))
+      SetReplicaRelevancies(replicatorLink, relevantReplicas, relevancies);
   }
 
   // Success
@@ -1674,8 +1997,19 @@ bool Replicator::RouteForget(const ReplicaArray& replicas, const Route& route, T
     // Get replicator link
     ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
-    // Send forget command
-    replicatorLink->SendForget(replicas, timestamp);
+    // Not withholding any replicas?
+    if (replicatorLink->mWithheldReplicas.Empty())
+    {
+      // Send forget command
+      replicatorLink->SendForget(replicas, timestamp);
+      continue;
+    }
+
+    // Send forget command (known replicas only)
+    ReplicaArray knownReplicas;
+    FilterKnownReplicas(replicatorLink, replicas, knownReplicas);
+    if (!knownReplicas.Empty())
+      replicatorLink->SendForget(knownReplicas, timestamp);
   }
 
   // Success
@@ -1783,8 +2117,19 @@ bool Replicator::RouteDestroy(const ReplicaArray& replicas, const Route& route,
     // Get replicator link
     ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
-    // Send destroy command
-    replicatorLink->SendDestroy(replicas, timestamp);
+    // Not withholding any replicas?
+    if (replicatorLink->mWithheldReplicas.Empty())
+    {
+      // Send destroy command
+      replicatorLink->SendDestroy(replicas, timestamp);
+      continue;
+    }
+
+    // Send destroy command (known replicas only)
+    ReplicaArray knownReplicas;
+    FilterKnownReplicas(replicatorLink, replicas, knownReplicas);
+    if (!knownReplicas.Empty())
+      replicatorLink->SendDestroy(knownReplicas, timestamp);
   }
 
   // Success
@@ -1826,8 +2171,14 @@ bool Replicator::RouteChange(ReplicaChannel* replicaChannel, const Route& route,
 
       // Has replica remotely?
       if (replicatorLink->HasReplica(replica))
+      {
+        // Should defer change? (Not enough priority accumulated)
+        if (replicatorLink->ShouldDeferChange(replicaChannel))
+          continue; // Skip link
+
         replicatorLink->SendChange(replicaChannel,
                                    message); // Send replica channel change
+      }
     }
   }
 
@@ -1956,6 +2307,13 @@ void Replicator::OnUpdate()
     replicatorLink->UpdateStart(now);
   }
 
+  // Is server?
+  if (GetRole() == Role::Server)
+  {
+    // Update replica relevancy (forgetting and cloning replicas as needed)
+    UpdateRelevancy(now);
+  }
+
   //
   // Update
   //
@@ -2009,6 +2367,11 @@ bool Replicator::OnLinkAdd(PeerLink* link)
 }
 void Replicator::OnLinkRemove(PeerLink* link)
 {
+  // For all relevancy filters
+  ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
+  forRange (RelevancyFilterPtr& relevancyFilter, mRelevancyFilters.All())
+    relevancyFilter->OnRemovingLink(replicatorLink);
+
   // User callback
   RemovingLink(link);
 }
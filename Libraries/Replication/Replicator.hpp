@@ -215,6 +215,37 @@ public:
   void SetFrameFillSkip(float frameFillSkip = 0.9);
   float GetFrameFillSkip() const;
 
+  /// [Server] Controls how many frames pass between relevancy evaluations of
+  /// any given link (links are staggered across the interval)
+  void SetRelevancyInterval(uint relevancyInterval = 10);
+  uint GetRelevancyInterval() const;
+
+  //
+  // Relevancy Filter Management
+  //
+
+  /// [Server] Adds the relevancy filter (the replicator takes ownership)
+  /// Routed spawned replicas are only sent to the links they are relevant to,
+  /// other links receive them once they become relevant
+  /// Returns the relevancy filter
+  RelevancyFilter* AddRelevancyFilter(RelevancyFilterPtr relevancyFilter);
+  /// [Server] Removes the specified relevancy filter
+  /// Returns true if successful, else false
+  bool RemoveRelevancyFilter(RelevancyFilter* relevancyFilter);
+  /// [Server] Removes all relevancy filters
+  /// (Withheld replicas are cloned on the next relevancy evaluation)
+  void ClearRelevancyFilters();
+
+  /// Returns true if the replicator has any relevancy filters, else false
+  bool HasRelevancyFilters() const;
+  /// Returns all relevancy filters
+  const RelevancyFilterArray& GetRelevancyFilters() const;
+
+  /// Returns the relevancy of the live replica to the link, from 0 to 1
+  /// (The product of every relevancy filter, emplaced replicas are always
+  /// fully relevant)
+  float GetReplicaRelevancy(ReplicatorLink* link, Replica* replica);
+
   //
   // Replica Channel Type Management
   //
@@ -425,6 +456,29 @@ public:
   /// Removes the emplaced replica from being known locally
   void RemoveEmplacedReplica(Replica* replica);
 
+  //
+  // Relevancy Helpers
+  //
+
+  /// [Server] Evaluates the relevancy of replicas to every link whose turn it
+  /// is, forgetting replicas that stopped being relevant and cloning withheld
+  /// replicas that became relevant
+  void UpdateRelevancy(TimeMs now);
+  /// [Server] Evaluates the relevancy of replicas to the link
+  void UpdateLinkRelevancy(ReplicatorLink* link, TimeMs now);
+
+  /// [Server] Gathers the replicas relevant to the link (and their relevancy),
+  /// withholding the rest
+  void FilterRelevantReplicas(ReplicatorLink* link,
+                              const ReplicaArray& replicas,
+                              ReplicaArray& relevantReplicas,
+                              Array<float>& relevancies);
+  /// [Server] Gathers the replicas expected remotely by the link, no longer
+  /// withholding the rest
+  void FilterKnownReplicas(ReplicatorLink* link, const ReplicaArray& replicas, ReplicaArray& knownReplicas);
+  /// [Server] Sets the relevancy of replicas just sent to the link
+  void SetReplicaRelevancies(ReplicatorLink* link, const ReplicaArray& replicas, const Array<float>& relevancies);
+
   //
   // ID Helpers
   //
@@ -790,6 +844,10 @@ public:
                                                 /// bandwidth utilization ratio on any given link
   ReplicaChannelTypeSet mReplicaChannelTypes;   /// Replica channel type set
   ReplicaPropertyTypeSet mReplicaPropertyTypes; /// Replica property type set
+  RelevancyFilterArray mRelevancyFilters;       /// [Server] Relevancy filters
+  uint mRelevancyInterval;                      /// [Server] Frames between relevancy evaluations of
+                                                /// any given link
+  uint64 mRelevancyFrameId;                     /// [Server] Relevancy update counter
 
 private:
   /// No copy constructor
@@ -21,7 +21,16 @@ ReplicatorLink::ReplicatorLink(Replicator* replicator) :
     mLastConnectResponseData(),
     mShouldSkipChangeReplication(false),
     mLastFrameFillSkipNotificationTime(0),
-    mLastFrameFillWarningNotificationTime(0)
+    mLastFrameFillWarningNotificationTime(0),
+    mReplicaRelevancy(),
+    mWithheldReplicas(),
+    mDeferredChangeCount(0),
+    mRelevancyCloneCount(0),
+    mRelevancyForgetCount(0),
+    mOutDeltaChannels(),
+    mInDeltaChannels(),
+    mDeltaReceipts(),
+    mDeltaBitsSaved(0)
 {
 }
 
@@ -178,6 +187,34 @@ bool ReplicatorLink::ShouldSkipChangeReplication() const
   return mShouldSkipChangeReplication;
 }
 
+float ReplicatorLink::GetReplicaRelevancy(Replica* replica) const
+{
+  const ReplicaRelevancy* replicaRelevancy = mReplicaRelevancy.FindPointer(replica);
+  return replicaRelevancy ? replicaRelevancy->mRelevancy : 1.0f;
+}
+size_t ReplicatorLink::GetWithheldReplicaCount() const
+{
+  return mWithheldReplicas.Size();
+}
+
+uint64 ReplicatorLink::GetDeferredChangeCount() const
+{
+  return mDeferredChangeCount;
+}
+uint64 ReplicatorLink::GetRelevancyCloneCount() const
+{
+  return mRelevancyCloneCount;
+}
+uint64 ReplicatorLink::GetRelevancyForgetCount() const
+{
+  return mRelevancyForgetCount;
+}
+
+uint64 ReplicatorLink::GetDeltaBitsSaved() const
+{
+  return mDeltaBitsSaved;
+}
+
 //
 // Internal
 //
@@ -224,9 +261,21 @@ void ReplicatorLink::UpdateStart(TimeMs now)
     //   }
     // }
   }
+
+  // Accumulate replica priorities
+  // (A replica's full state changes are sent once its priority reaches 1, so a
+  // replica with a relevancy of 0.25 sends them at most every 4 frames)
+  forRange (ReplicaRelevancyMap::value_type& entry, mReplicaRelevancy.All())
+  {
+    ReplicaRelevancy& replicaRelevancy = entry.second;
+    replicaRelevancy.mPriority = Math::Min(replicaRelevancy.mPriority + replicaRelevancy.mRelevancy, 1.0f);
+  }
 }
 void ReplicatorLink::UpdateEnd(TimeMs now)
 {
+  // Send deferred changes (as applicable)
+  SendDeferredChanges(now);
+
   // See if we should warn the user about their outgoing bandwidth utilization
   // this frame
   {
@@ -263,6 +312,86 @@ void ReplicatorLink::UpdateEnd(TimeMs now)
   }
 }
 
+//
+// Relevancy Helpers
+//
+
+void ReplicatorLink::SetReplicaRelevancy(Replica* replica, float relevancy)
+{
+  Assert(HasReplica(replica));
+
+  mReplicaRelevancy[replica].mRelevancy = relevancy;
+}
+
+bool ReplicatorLink::ShouldDeferChange(ReplicaChannel* replicaChannel)
+{
+  // Replica has not been evaluated?
+  ReplicaRelevancy* replicaRelevancy = mReplicaRelevancy.FindPointer(replicaChannel->GetReplica());
+  if (!replicaRelevancy)
+    return false;
+
+  // Change depends on previous changes?
+  // (Skipping it would desynchronize the remote replica)
+  if (!replicaChannel->SerializesFullState())
+    return false;
+
+  // Not enough priority accumulated?
+  if (replicaRelevancy->mPriority < 1.0f)
+  {
+    // Defer change until there is
+    if (!replicaRelevancy->mDeferredChannels.Contains(replicaChannel))
+      replicaRelevancy->mDeferredChannels.PushBack(replicaChannel);
+    ++mDeferredChangeCount;
+    return true;
+  }
+
+  // Send change now (supersedes any deferred change)
+  replicaRelevancy->mDeferredChannels.EraseValue(replicaChannel);
+  replicaRelevancy->mSentChange = true;
+  return false;
+}
+void ReplicatorLink::SendDeferredChanges(TimeMs now)
+{
+  // For all evaluated replicas
+  forRange (ReplicaRelevancyMap::value_type& entry, mReplicaRelevancy.All())
+  {
+    ReplicaRelevancy& replicaRelevancy = entry.second;
+
+    // Has deferred changes and accumulated enough priority?
+    // (Skipping change replication leaves them deferred until the next frame)
+    if (!replicaRelevancy.mDeferredChannels.Empty() && replicaRelevancy.mPriority >= 1.0f &&
+        !ShouldSkipChangeReplication())
+    {
+      // For all deferred replica channels
+      forRange (ReplicaChannel* replicaChannel, replicaRelevancy.mDeferredChannels.All())
+      {
+        // Serialize the current replica channel state
+        Message message(ReplicatorMessageType::Change);
+        if (!GetReplicator()->SerializeChange(replicaChannel, message, now)) // Unable?
+          continue;
+
+        // Should include an accurate timestamp with this message?
+        if (Replicator::ShouldIncludeAccurateTimestampOnChange(replicaChannel))
+          message.SetTimestamp(now);
+
+        // Send replica channel change
+        SendChange(replicaChannel, message);
+      }
+
+      replicaRelevancy.mDeferredChannels.Clear();
+      replicaRelevancy.mSentChange = true;
+    }
+
+    // Sent a change this frame?
+    if (replicaRelevancy.mSentChange)
+    {
+      // Spend accumulated priority
+      replicaRelevancy.mPriority = 0.0f;
+      replicaRelevancy.mSentChange = false;
+    }
+  }
+}
+
 //
 // Replica Helpers
 //
@@ -427,6 +556,9 @@ void ReplicatorLink::RemoveLiveReplica(Replica* replica)
     bool result = RemoveReplicaFromLiveSet(replica);
     Assert(result); // (Erase should have succeeded)
   }
+
+  // Remove replica relevancy (if any)
+  mReplicaRelevancy.Erase(replica);
 }
 
 //
@@ -1160,6 +1292,30 @@ bool ReplicatorLink::DeserializeChange(const Message& message, TimeMs timestamp)
     return false;
   }
 
+  // Uses delta compression?
+  // (Read before anything else so that every acknowledged change is available
+  // as a baseline, even if it is ignored)
+  BitStream deltaState;
+  const BitStream* changeBitStream = &bitStream;
+  if (replicaChannel->UsesDeltaCompression())
+  {
+    // Read full replica channel state
+    bool isLatest = false;
+    if (!ReadDeltaChange(replicaChannel, bitStream, deltaState, isLatest)) // Unable?
+      return false;
+
+    // Late change?
+    // (Delta compressed changes are sequenced, newer changes have already been
+    // applied)
+    if (!isLatest)
+    {
+      // Ignore
+      return true;
+    }
+
+    changeBitStream = &deltaState;
+  }
+
   // Get replica channel type
   ReplicaChannelType* replicaChannelType = replicaChannel->GetReplicaChannelType();
   ReturnIf(!replicaChannelType, false, "ReplicaChannelType was null");
@@ -1190,7 +1346,7 @@ bool ReplicatorLink::DeserializeChange(const Message& message, TimeMs timestamp)
   }
 
   // Read replica channel
-  bool result = replicaChannel->Deserialize(bitStream, ReplicationPhase::Change, timestamp);
+  bool result = replicaChannel->Deserialize(*changeBitStream, ReplicationPhase::Change, timestamp);
   if (!result) // Unable?
   {
     // Assert(false);
@@ -1251,6 +1407,10 @@ bool ReplicatorLink::SendChange(ReplicaChannel* replicaChannel, Message& message
     return false;
   }
 
+  // Uses delta compression?
+  if (replicaChannel->UsesDeltaCompression())
+    return SendDeltaChange(replicaChannel, message, channelId);
+
   // Send change message
   Status status;
   LinkPlugin::Send(
@@ -1272,6 +1432,159 @@ bool ReplicatorLink::ReceiveChange(const Message& message)
   return DeserializeChange(message, timestamp);
 }
 
+//
+// Delta Compression Helpers
+//
+
+bool ReplicatorLink::SendDeltaChange(ReplicaChannel* replicaChannel, const Message& message, MessageChannelId channelId)
+{
+  // (The change message contains the full replica channel state)
+  const BitStream& state = message.GetData();
+
+  // Get delta channel
+  OutDeltaChannel& deltaChannel = mOutDeltaChannels[replicaChannel];
+  SnapshotId snapshotId = deltaChannel.mNextSnapshotId++;
+
+  //    Has an acknowledged baseline?
+  // AND Not a keyframe?
+  // AND Baseline is the same length? (Else the state layout changed)
+  uint32 baselineDistance = 0;
+  if (deltaChannel.mHasBaseline && (snapshotId % cKeyframeInterval) != 0 &&
+      deltaChannel.mBaseline.GetBitsWritten() == state.GetBitsWritten())
+  {
+    // Baseline is recent enough?
+    SnapshotId distance = SnapshotId(snapshotId - deltaChannel.mBaselineId);
+    if (distance <= cMaxBaselineDistance)
+      baselineDistance = distance;
+  }
+
+  // Write snapshot ID and baseline distance
+  Message deltaMessage(ReplicatorMessageType::Change);
+  BitStream& bitStream = deltaMessage.GetData();
+  bitStream.Write(snapshotId);
+  bitStream.WriteQuantized(baselineDistance, uint32(0), uint32(cMaxBaselineDistance));
+
+  // Keyframe?
+  if (baselineDistance == 0)
+  {
+    // Write full state
+    bitStream.AppendAll(state);
+  }
+  // Delta?
+  else
+  {
+    // Write state as the difference from the baseline
+    WriteDelta(bitStream, deltaChannel.mBaseline, state);
+
+    // Update bits saved
+    if (state.GetBitsWritten() > bitStream.GetBitsWritten())
+      mDeltaBitsSaved += state.GetBitsWritten() - bitStream.GetBitsWritten();
+  }
+
+  // Has timestamp?
+  if (message.HasTimestamp())
+    deltaMessage.SetTimestamp(message.GetTimestamp());
+
+  // Send change message
+  // (A receipt is requested so acknowledged changes can become the baseline)
+  ReplicaChannelType* replicaChannelType = replicaChannel->GetReplicaChannelType();
+  Status status;
+  MessageReceiptId receiptId = LinkPlugin::Send(status,
+                                                ZeroMove(deltaMessage),
+                                                (replicaChannelType->GetReliabilityMode() == ReliabilityMode::Reliable),
+                                                channelId,
+                                                true);
+  if (status.Failed()) // Unable?
+    return false;
+
+  // Await receipt
+  OutDeltaSnapshot snapshot;
+  snapshot.mSnapshotId = snapshotId;
+  snapshot.mReceiptId = receiptId;
+  snapshot.mState = state;
+  deltaChannel.mPendingSnapshots.PushBack(snapshot);
+  mDeltaReceipts.InsertOrAssign(receiptId, replicaChannel);
+
+  // Too many snapshots awaiting a receipt?
+  // (The oldest could never be used as a baseline anyway)
+  if (deltaChannel.mPendingSnapshots.Size() > cSnapshotHistorySize)
+  {
+    mDeltaReceipts.EraseValue(deltaChannel.mPendingSnapshots.Front().mReceiptId);
+    deltaChannel.mPendingSnapshots.EraseAt(0);
+  }
+
+  // Success
+  return true;
+}
+bool ReplicatorLink::ReadDeltaChange(ReplicaChannel* replicaChannel,
+                                     const BitStream& bitStream,
+                                     BitStream& state,
+                                     bool& isLatest)
+{
+  // Get delta channel
+  InDeltaChannel& deltaChannel = mInDeltaChannels[replicaChannel];
+
+  // Read snapshot ID and baseline distance
+  SnapshotId snapshotId = 0;
+  uint32 baselineDistance = 0;
+  if (!bitStream.Read(snapshotId) ||
+      !bitStream.ReadQuantized(baselineDistance, uint32(0), uint32(cMaxBaselineDistance))) // Unable?
+    return false;
+
+  // Keyframe?
+  if (baselineDistance == 0)
+  {
+    // Read full state
+    state.AssignRemainder(bitStream);
+  }
+  // Delta?
+  else
+  {
+    // Get baseline
+    const BitStream* baseline = deltaChannel.GetSnapshot(SnapshotId(snapshotId - baselineDistance));
+    if (!baseline) // Unable?
+    {
+      // (The baseline was acknowledged but never applied, the next keyframe
+      // will recover)
+      return false;
+    }
+
+    // Read state as the difference from the baseline
+    if (!ReadDelta(bitStream, *baseline, state)) // Unable?
+      return false;
+  }
+
+  // Store state as a future baseline
+  // (Late snapshots older than every stored baseline are still applied below,
+  // but never replace a newer baseline)
+  deltaChannel.SetSnapshot(snapshotId, state);
+
+  // Newer than every change read before it?
+  isLatest = (!deltaChannel.mHasLatest || IsSnapshotNewer(snapshotId, deltaChannel.mLatestId));
+  if (isLatest)
+  {
+    deltaChannel.mHasLatest = true;
+    deltaChannel.mLatestId = snapshotId;
+  }
+
+  // Success
+  return true;
+}
+void ReplicatorLink::ClearOutgoingDeltaChannel(ReplicaChannel* replicaChannel)
+{
+  // Find delta channel
+  OutDeltaChannel* deltaChannel = mOutDeltaChannels.FindPointer(replicaChannel);
+  if (!deltaChannel) // Unable?
+    return;
+
+  // Forget receipts awaited
+  forRange (OutDeltaSnapshot& snapshot, deltaChannel->mPendingSnapshots.All())
+    mDeltaReceipts.EraseValue(snapshot.mReceiptId);
+
+  // Remove delta channel
+  mOutDeltaChannels.Erase(replicaChannel);
+}
+
 bool ReplicatorLink::SendInterrupt(Message& message)
 {
   Assert(GetReplicator()->GetRole() == Role::Server);
@@ -1437,8 +1750,14 @@ MessageChannelId ReplicatorLink::OpenOutgoingReplicaChannel(ReplicaChannel* repl
   // Get replica channel type
   ReplicaChannelType* replicaChannelType = replicaChannel->GetReplicaChannelType();
 
+  // Determine transfer mode
+  // (Delta compressed changes are sent immediately, the receiver discards late
+  // changes itself using their snapshot IDs)
+  TransferMode::Enum transferMode = replicaChannel->UsesDeltaCompression() ? TransferMode::Immediate
+                                                                           : replicaChannelType->GetTransferMode();
+
   // Open outgoing message channel
-  OutMessageChannel* channel = LinkPlugin::GetLink()->OpenOutgoingChannel(replicaChannelType->GetTransferMode());
+  OutMessageChannel* channel = LinkPlugin::GetLink()->OpenOutgoingChannel(transferMode);
   if (!channel) // Unable?
   {
     Assert(false);
@@ -1473,6 +1792,9 @@ void ReplicatorLink::CloseOutgoingReplicaChannel(ReplicaChannel* replicaChannel)
 
   // Remove outgoing message channel
   mOutReplicaChannels.Erase(iter);
+
+  // Forget delta compression state (if any)
+  ClearOutgoingDeltaChannel(replicaChannel);
 }
 MessageChannelId ReplicatorLink::GetOutgoingReplicaChannel(ReplicaChannel* replicaChannel) const
 {
@@ -1523,6 +1845,9 @@ void ReplicatorLink::ClearIncomingReplicaChannel(ReplicaChannel* replicaChannel)
 
   // Remove incoming message channel (in regular map)
   mInReplicaChannels.EraseValue(channelId);
+
+  // Forget delta compression state (if any)
+  mInDeltaChannels.Erase(replicaChannel);
 }
 ReplicaChannel* ReplicatorLink::GetIncomingReplicaChannel(MessageChannelId channelId) const
 {
@@ -1815,6 +2140,42 @@ void ReplicatorLink::OnStateChange(LinkState::Enum prevState)
   }
 }
 
+void ReplicatorLink::OnPluginMessageReceipt(MoveReference<OutMessage> message, Receipt::Enum receipt)
+{
+  // Get delta compressed replica channel (if any)
+  MessageReceiptId receiptId = message->GetReceiptID();
+  ReplicaChannel* replicaChannel = mDeltaReceipts.FindValue(receiptId, nullptr);
+  if (!replicaChannel) // Not a delta compressed change?
+    return;
+  mDeltaReceipts.EraseValue(receiptId);
+
+  // Get delta channel
+  OutDeltaChannel* deltaChannel = mOutDeltaChannels.FindPointer(replicaChannel);
+  if (!deltaChannel) // Unable?
+    return;
+
+  // Find snapshot awaiting this receipt
+  for (size_t i = 0; i < deltaChannel->mPendingSnapshots.Size(); ++i)
+  {
+    OutDeltaSnapshot& snapshot = deltaChannel->mPendingSnapshots[i];
+    if (snapshot.mReceiptId != receiptId)
+      continue;
+
+    //    Acknowledged?
+    // AND Newer than the current baseline?
+    if (receipt == Receipt::ACK &&
+        (!deltaChannel->mHasBaseline || IsSnapshotNewer(snapshot.mSnapshotId, deltaChannel->mBaselineId)))
+    {
+      // Use as the new baseline
+      deltaChannel->mHasBaseline = true;
+      deltaChannel->mBaselineId = snapshot.mSnapshotId;
+      deltaChannel->mBaseline = ZeroMove(snapshot.mState);
+    }
+
+    deltaChannel->mPendingSnapshots.EraseAt(i);
+    break;
+  }
+}
 void ReplicatorLink::OnPluginMessageReceive(MoveReference<Message> message, bool& continueProcessingCustomMessages)
 {
   // Is link in any disconnected state?
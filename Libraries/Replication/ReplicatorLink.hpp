@@ -4,6 +4,27 @@
 namespace Zero
 {
 
+//                             ReplicaRelevancy //
+
+/// Replica Relevancy
+/// Relevancy state of a live replica expected remotely by a replicator link
+struct ReplicaRelevancy
+{
+  /// Constructor
+  ReplicaRelevancy() : mRelevancy(1.0f), mPriority(1.0f), mSentChange(false), mDeferredChannels()
+  {
+  }
+
+  /// Data
+  float mRelevancy;                         /// Last evaluated relevancy (0 to 1)
+  float mPriority;                          /// Accumulated priority (full state changes are sent at 1)
+  bool mSentChange;                         /// Sent a change this frame?
+  Array<ReplicaChannel*> mDeferredChannels; /// Replica channels with deferred full state changes
+};
+
+/// Typedefs
+typedef HashMap<Replica*, ReplicaRelevancy> ReplicaRelevancyMap;
+
 //                               ReplicatorLink //
 
 /// Replicator Link Plugin
@@ -80,6 +101,25 @@ public:
   /// Returns true if change replication should be skipped for this link
   bool ShouldSkipChangeReplication() const;
 
+  /// Returns the relevancy of the live replica to this link as last evaluated
+  /// by the replicator's relevancy filters (1 if it has not been evaluated)
+  float GetReplicaRelevancy(Replica* replica) const;
+  /// Returns the number of routed live replicas currently withheld from this
+  /// link because they are not relevant
+  size_t GetWithheldReplicaCount() const;
+
+  /// Returns the number of full state changes deferred due to low relevancy
+  uint64 GetDeferredChangeCount() const;
+  /// Returns the number of replicas cloned because they became relevant
+  uint64 GetRelevancyCloneCount() const;
+  /// Returns the number of replicas forgotten because they stopped being
+  /// relevant
+  uint64 GetRelevancyForgetCount() const;
+
+  /// Returns the number of bits saved by delta compressing replica channel
+  /// changes sent to this link
+  uint64 GetDeltaBitsSaved() const;
+
   //
   // Internal
   //
@@ -89,6 +129,22 @@ public:
   /// Called at the end of the operating replicator's update
   void UpdateEnd(TimeMs now);
 
+  //
+  // Relevancy Helpers
+  //
+
+  /// Sets the relevancy of the live replica to this link
+  void SetReplicaRelevancy(Replica* replica, float relevancy);
+
+  /// Returns true if the replica channel change should be deferred because
+  /// the replica has not accumulated enough priority, else false
+  /// (Only full state changes may be deferred, since they can be sent later
+  /// without depending on any changes in between)
+  bool ShouldDeferChange(ReplicaChannel* replicaChannel);
+  /// Sends the deferred changes of every replica that has accumulated enough
+  /// priority
+  void SendDeferredChanges(TimeMs now);
+
   //
   // Replica Helpers
   //
@@ -231,6 +287,22 @@ public:
   /// Returns true if successful, else false
   bool ReceiveChange(const Message& message);
 
+  //
+  // Delta Compression Helpers
+  //
+
+  /// Sends a replica channel change delta compressed against the last state
+  /// acknowledged by this link (or in full as a keyframe)
+  /// Returns true if successful, else false
+  bool SendDeltaChange(ReplicaChannel* replicaChannel, const Message& message, MessageChannelId channelId);
+  /// Reads a delta compressed replica channel change into the full replica
+  /// channel state, storing it for use as a future baseline
+  /// Sets isLatest if the change is newer than every change read before it
+  /// Returns true if successful, else false (the baseline is unavailable)
+  bool ReadDeltaChange(ReplicaChannel* replicaChannel, const BitStream& bitStream, BitStream& state, bool& isLatest);
+  /// Forgets the delta compression state of the outgoing replica channel
+  void ClearOutgoingDeltaChannel(ReplicaChannel* replicaChannel);
+
   /// [Server] Sends an interrupt command
   /// Returns true if successful, else false
   bool SendInterrupt(Message& message);
@@ -309,6 +381,8 @@ public:
   /// Called after the link state is changed
   void OnStateChange(LinkState::Enum prevState) override;
 
+  /// Called after a plugin message is receipted
+  void OnPluginMessageReceipt(MoveReference<OutMessage> message, Receipt::Enum receipt) override;
   /// Called after a plugin message is received
   void OnPluginMessageReceive(MoveReference<Message> message, bool& continueProcessingCustomMessages) override;
 
@@ -333,6 +407,18 @@ public:
                                                       /// notification time
   TimeMs mLastFrameFillWarningNotificationTime;       /// Last frame fill warning
                                                       /// notification time
+  ReplicaRelevancyMap mReplicaRelevancy;              /// Relevancy of remotely expected live replicas
+                                                      /// (Only evaluated replicas)
+  ReplicaSet mWithheldReplicas;                       /// [Server] Routed live replicas withheld because
+                                                      /// they are not relevant (cloned once they are)
+  uint64 mDeferredChangeCount;                        /// Full state changes deferred due to low relevancy
+  uint64 mRelevancyCloneCount;                        /// Replicas cloned because they became relevant
+  uint64 mRelevancyForgetCount;                       /// Replicas forgotten because they stopped being relevant
+  OutDeltaChannels mOutDeltaChannels;                 /// Delta compression state of outgoing replica channels
+  InDeltaChannels mInDeltaChannels;                   /// Delta compression state of incoming replica channels
+  DeltaReceipts mDeltaReceipts;                       /// Delta compressed change receipts (receipt ID to
+                                                      /// replica channel)
+  uint64 mDeltaBitsSaved;                             /// Bits saved by delta compressing changes
 
 private:
   /// No copy constructor
@@ -0,0 +1,727 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+namespace LoopbackBenchmark
+{
+const uint cFrameRate = 60;
+const float cTimeStep = 1.0f / float(cFrameRate);
+const TimeMs cFrameDuration = RATE_TO_INTERVAL(cFrameRate);
+// Give up waiting for the clients to connect or converge after this long
+const TimeMs cTimeout = cOneSecondTimeMs * 60;
+
+const float cWorldExtent = 512.0f;
+const float cMaxSpeed = 10.0f;
+const float cMaxAngularSpeed = 3.0f;
+// Only some of the replicas rotate, the rest keep their rotation
+const float cRotatingRatio = 0.5f;
+
+// Every replica is created in the same context with the same type
+const uint cCreateContext = 1;
+const uint cReplicaType = 1;
+} // namespace LoopbackBenchmark
+
+//                           LoopbackBenchmarkOptions //
+
+/// Benchmark options (parsed from the command line)
+struct LoopbackBenchmarkOptions
+{
+  /// Constructor
+  LoopbackBenchmarkOptions() : mClients(200), mReplicas(2000), mFrames(600), mSeed(1337), mConditions()
+  {
+    mConditions.mLatency = 50;
+    mConditions.mJitter = 10;
+    mConditions.mPacketLoss = 0.01f;
+    mConditions.mDuplication = 0.001f;
+  }
+
+  /// Data
+  uint mClients;                  /// Number of clients connected to the server
+  uint mReplicas;                 /// Number of replicas spawned by the server
+  uint mFrames;                   /// Number of frames the replicas move for
+  uint mSeed;                     /// Random seed (motion and network conditions)
+  LoopbackConditions mConditions; /// Network conditions of every peer
+};
+
+/// Parses "-name value" pairs from the command line
+/// Returns true if successful, else false
+bool ParseBenchmarkOptions(int argc, char* argv[], LoopbackBenchmarkOptions& options)
+{
+  for (int i = 1; i + 1 < argc; i += 2)
+  {
+    String name = argv[i];
+    StringRange value = argv[i + 1];
+
+    if (name == "-clients")
+      ToValue(value, options.mClients);
+    else if (name == "-replicas")
+      ToValue(value, options.mReplicas);
+    else if (name == "-frames")
+      ToValue(value, options.mFrames);
+    else if (name == "-seed")
+      ToValue(value, options.mSeed);
+    else if (name == "-latency")
+      ToValue(value, options.mConditions.mLatency);
+    else if (name == "-jitter")
+      ToValue(value, options.mConditions.mJitter);
+    else if (name == "-loss")
+      ToValue(value, options.mConditions.mPacketLoss);
+    else if (name == "-duplication")
+      ToValue(value, options.mConditions.mDuplication);
+    else if (name == "-bandwidth") // (Kilobits per second)
+    {
+      ToValue(value, options.mConditions.mBandwidth);
+      options.mConditions.mBandwidth *= 1000;
+    }
+    else // Unknown option?
+    {
+      ZPrint("ReplicationBenchmark: Unknown option '%s'\n", name.c_str());
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//                               LoopbackReplica //
+
+/// Replicated transform
+struct LoopbackEntity
+{
+  Vec3 mPosition;
+  Quat mRotation;
+  Vec3 mVelocity;
+  Quat mSpin;
+};
+
+/// Replica property data (points the property at its entity)
+struct LoopbackPropertyData
+{
+  LoopbackPropertyData(LoopbackEntity* entity = nullptr) : mEntity(entity)
+  {
+  }
+
+  LoopbackEntity* mEntity;
+};
+
+Variant GetLoopbackPosition(const Variant& propertyData)
+{
+  return Variant(propertyData.GetOrError<LoopbackPropertyData>().mEntity->mPosition);
+}
+void SetLoopbackPosition(const Variant& value, Variant& propertyData)
+{
+  propertyData.GetOrError<LoopbackPropertyData>().mEntity->mPosition = value.GetOrError<Vec3>();
+}
+
+Variant GetLoopbackRotation(const Variant& propertyData)
+{
+  return Variant(propertyData.GetOrError<LoopbackPropertyData>().mEntity->mRotation);
+}
+void SetLoopbackRotation(const Variant& value, Variant& propertyData)
+{
+  propertyData.GetOrError<LoopbackPropertyData>().mEntity->mRotation = value.GetOrError<Quat>();
+}
+
+/// Replica with a transform channel
+class LoopbackReplica : public Replica
+{
+public:
+  /// Constructor
+  LoopbackReplica() :
+      Replica(CreateContext(LoopbackBenchmark::cCreateContext), ReplicaType(LoopbackBenchmark::cReplicaType)),
+      mEntity()
+  {
+  }
+
+  /// Data
+  LoopbackEntity mEntity; /// Replicated transform
+};
+
+//                             LoopbackReplicator //
+
+/// Replicator that creates transform replicas
+class LoopbackReplicator : public Replicator
+{
+public:
+  /// Constructor
+  LoopbackReplicator(Role::Enum role) :
+      Replicator(role),
+      mTransformChannelType(nullptr),
+      mPositionPropertyType(nullptr),
+      mRotationPropertyType(nullptr),
+      mReplicas()
+  {
+    // Transforms change every frame, only the latest change matters
+    ReplicaChannelTypePtr channelType = new ReplicaChannelType("Transform");
+    channelType->SetDetectionMode(DetectionMode::Automatic);
+    channelType->SetReliabilityMode(ReliabilityMode::Unreliable);
+    channelType->SetTransferMode(TransferMode::Sequenced);
+    channelType->SetUseDeltaCompression(true);
+    mTransformChannelType = AddReplicaChannelType(ZeroMove(channelType));
+
+    mPositionPropertyType = AddReplicaPropertyType(ReplicaPropertyTypePtr(new ReplicaPropertyType(
+        "Position", NativeTypeOf(Vec3), SerializeKnownBasicVariant, GetLoopbackPosition, SetLoopbackPosition)));
+    mRotationPropertyType = AddReplicaPropertyType(ReplicaPropertyTypePtr(new ReplicaPropertyType(
+        "Rotation", NativeTypeOf(Quat), SerializeKnownBasicVariant, GetLoopbackRotation, SetLoopbackRotation)));
+  }
+
+  /// Destructor
+  /// (The peer must be closed first so no replicas are still known)
+  ~LoopbackReplicator()
+  {
+    forRange (LoopbackReplica* replica, mReplicas.All())
+      delete replica;
+  }
+
+  /// Creates a replica owned by the replicator
+  LoopbackReplica* CreateReplica()
+  {
+    LoopbackReplica* replica = new LoopbackReplica();
+
+    ReplicaChannel* channel =
+        replica->AddReplicaChannel(ReplicaChannelPtr(new ReplicaChannel("Transform", mTransformChannelType)));
+    Variant propertyData(LoopbackPropertyData(&replica->mEntity));
+    channel->AddReplicaProperty(
+        ReplicaPropertyPtr(new ReplicaProperty("Position", mPositionPropertyType, propertyData)));
+    channel->AddReplicaProperty(
+        ReplicaPropertyPtr(new ReplicaProperty("Rotation", mRotationPropertyType, propertyData)));
+
+    mReplicas.PushBack(replica);
+    return replica;
+  }
+
+  /// Deletes a replica owned by the replicator
+  void DeleteReplica(Replica* replica)
+  {
+    for (uint i = 0; i < mReplicas.Size(); ++i)
+    {
+      if (mReplicas[i] == replica)
+      {
+        delete mReplicas[i];
+        mReplicas.EraseAt(i);
+        return;
+      }
+    }
+  }
+
+  /// Returns the replicas owned by the replicator
+  const Array<LoopbackReplica*>& GetOwnedReplicas() const
+  {
+    return mReplicas;
+  }
+
+  //
+  // Replicator Interface
+  //
+
+  bool SerializeReplicas(const ReplicaArray& replicas, ReplicaStream& replicaStream) override
+  {
+    ReplicaStreamMode::Enum mode = replicaStream.GetReplicaStreamMode();
+
+    // Is a spawn or clone replica stream?
+    // (Every replica is spawned, so clones are always clones-from-spawn)
+    if (mode == ReplicaStreamMode::Spawn || mode == ReplicaStreamMode::Clone)
+    {
+      // Write creation info
+      if (!replicaStream.WriteCreationInfo(CreateContext(LoopbackBenchmark::cCreateContext),
+                                           ReplicaType(LoopbackBenchmark::cReplicaType))) // Unable?
+        return false;
+    }
+
+    forRange (Replica* replica, replicas.All())
+    {
+      // (Transform replicas do not use reverse replica channels)
+      if (mode == ReplicaStreamMode::ReverseReplicaChannels)
+        continue;
+
+      // Write identification info and channel data
+      if (!replicaStream.WriteIdentificationInfo(replica == nullptr, replica)) // Unable?
+        return false;
+      if (replica && !replicaStream.WriteChannelData(replica)) // Unable?
+        return false;
+    }
+
+    return true;
+  }
+
+  bool DeserializeReplicas(const ReplicaStream& replicaStream, ReplicaArray& replicas) override
+  {
+    ReplicaStreamMode::Enum mode = replicaStream.GetReplicaStreamMode();
+
+    // Is a spawn or clone replica stream?
+    if (mode == ReplicaStreamMode::Spawn || mode == ReplicaStreamMode::Clone)
+    {
+      // Read creation info
+      CreateContext createContext;
+      ReplicaType replicaType;
+      if (!replicaStream.ReadCreationInfo(createContext, replicaType)) // Unable?
+        return false;
+
+      // Create replicas
+      while (replicaStream.GetBitStream().GetBitsUnread())
+      {
+        LoopbackReplica* replica = CreateReplica();
+
+        // Read identification info
+        bool isAbsent = false;
+        if (!replicaStream.ReadIdentificationInfo(isAbsent, replica)) // Unable?
+        {
+          DeleteReplica(replica);
+          return false;
+        }
+
+        // Absent replica?
+        if (isAbsent)
+        {
+          DeleteReplica(replica);
+          continue;
+        }
+
+        // Read channel data
+        if (!replicaStream.ReadChannelData(replica)) // Unable?
+        {
+          DeleteReplica(replica);
+          return false;
+        }
+
+        replicas.PushBack(replica);
+      }
+      return true;
+    }
+
+    // Find existing replicas
+    while (replicaStream.GetBitStream().GetBitsUnread())
+    {
+      // Read identification info
+      bool isAbsent = false;
+      ReplicaId replicaId = 0;
+      bool isCloned = false;
+      bool isEmplaced = false;
+      EmplaceContext emplaceContext;
+      EmplaceId emplaceId = 0;
+      if (!replicaStream.ReadIdentificationInfo(
+              isAbsent, replicaId, isCloned, isEmplaced, emplaceContext, emplaceId)) // Unable?
+        return false;
+
+      // Absent replica?
+      if (isAbsent)
+        continue;
+
+      // Find replica
+      Replica* replica = GetReplica(replicaId);
+      if (!replica) // Unable?
+        return false;
+
+      // Read channel data
+      if (!replicaStream.ReadChannelData(replica)) // Unable?
+        return false;
+
+      replicas.PushBack(replica);
+    }
+    return true;
+  }
+
+  bool ReleaseReplicas(const ReplicaArray& replicas) override
+  {
+    forRange (Replica* replica, replicas.All())
+      if (replica)
+        DeleteReplica(replica);
+    return true;
+  }
+
+private:
+  /// Data
+  ReplicaChannelType* mTransformChannelType;  /// Transform replica channel type
+  ReplicaPropertyType* mPositionPropertyType; /// Position replica property type
+  ReplicaPropertyType* mRotationPropertyType; /// Rotation replica property type
+  Array<LoopbackReplica*> mReplicas;          /// Replicas owned by the replicator
+};
+
+//                                LoopbackNode //
+
+/// Ignores custom packets (the benchmark only sends replication traffic)
+void IgnoreCustomPacket(Peer* peer, InPacket& packet)
+{
+  UnusedParameter(peer);
+  UnusedParameter(packet);
+}
+/// Ignores custom messages (the benchmark only sends replication traffic)
+bool IgnoreCustomMessage(PeerLink* link, Message& message)
+{
+  UnusedParameter(link);
+  UnusedParameter(message);
+  return true;
+}
+
+/// Simulated process (a peer with a replicator)
+class LoopbackNode
+{
+public:
+  /// Constructor
+  LoopbackNode(Role::Enum role) : mPeer(IgnoreCustomPacket, IgnoreCustomMessage), mReplicator(role)
+  {
+  }
+
+  /// Destructor
+  ~LoopbackNode()
+  {
+    // Close the peer while the replicator still exists
+    mPeer.Close();
+  }
+
+  /// Opens the node on the loopback network
+  /// Returns true if successful, else false
+  bool Open(LoopbackNetwork& network)
+  {
+    if (!mPeer.AddPlugin(&mReplicator, "Replicator")) // Unable?
+      return false;
+
+    Status status;
+    mPeer.Open(status, network);
+    return status.Succeeded();
+  }
+
+  /// Returns true if every owned replica matches the server replica with the
+  /// same ID, else false
+  bool MatchesServer(const Replicator& server) const
+  {
+    forRange (LoopbackReplica* replica, mReplicator.GetOwnedReplicas().All())
+    {
+      LoopbackReplica* serverReplica = static_cast<LoopbackReplica*>(server.GetReplica(replica->GetReplicaId()));
+      if (!serverReplica || serverReplica->mEntity.mPosition != replica->mEntity.mPosition ||
+          serverReplica->mEntity.mRotation != replica->mEntity.mRotation)
+        return false;
+    }
+    return true;
+  }
+
+  /// Data
+  Peer mPeer;                     /// Peer (owns the replicator plugin while open)
+  LoopbackReplicator mReplicator; /// Replicator
+
+private:
+  /// No Copy Constructor
+  LoopbackNode(const LoopbackNode&);
+  /// No Copy Assignment Operator
+  LoopbackNode& operator=(const LoopbackNode&);
+};
+
+//                            LoopbackBenchmark //
+
+/// Server and clients sharing a loopback network
+class LoopbackBenchmarkSession
+{
+public:
+  /// Constructor
+  LoopbackBenchmarkSession(const LoopbackBenchmarkOptions& options) :
+      mOptions(options),
+      mNetwork(options.mSeed),
+      mServer(Role::Server),
+      mClients(),
+      mServerTime(0),
+      mMaxServerTime(0),
+      mClientTime(0),
+      mFrames(0)
+  {
+    mNetwork.SetDefaultConditions(options.mConditions);
+  }
+
+  /// Destructor
+  ~LoopbackBenchmarkSession()
+  {
+    forRange (LoopbackNode* client, mClients.All())
+      delete client;
+  }
+
+  /// Opens the server and connects every client
+  /// Returns true if successful, else false
+  bool Connect()
+  {
+    if (!mServer.Open(mNetwork)) // Unable?
+    {
+      ZPrint("ReplicationBenchmark: Unable to open the server\n");
+      return false;
+    }
+
+    for (uint i = 0; i < mOptions.mClients; ++i)
+    {
+      LoopbackNode* client = new LoopbackNode(Role::Client);
+      mClients.PushBack(client);
+      if (!client->Open(mNetwork)) // Unable?
+      {
+        ZPrint("ReplicationBenchmark: Unable to open client %u\n", i);
+        return false;
+      }
+
+      PeerLink* link = client->mPeer.CreateLink(mServer.mPeer.GetLocalIpv4Address());
+      if (!link || !link->Connect()) // Unable?
+      {
+        ZPrint("ReplicationBenchmark: Unable to connect client %u\n", i);
+        return false;
+      }
+    }
+
+    // Wait for every client to connect
+    return RunUntil(&LoopbackBenchmarkSession::AllConnected) != TimeMs(-1);
+  }
+
+  /// Spawns the replicas on the server
+  void Spawn(Math::Random& random)
+  {
+    using namespace LoopbackBenchmark;
+
+    ReplicaArray replicas;
+    for (uint i = 0; i < mOptions.mReplicas; ++i)
+    {
+      LoopbackReplica* replica = mServer.mReplicator.CreateReplica();
+      LoopbackEntity& entity = replica->mEntity;
+
+      float halfExtent = cWorldExtent * 0.5f;
+      entity.mPosition = Vec3(random.FloatRange(-halfExtent, halfExtent),
+                              random.FloatRange(-halfExtent, halfExtent),
+                              random.FloatRange(-halfExtent, halfExtent));
+      entity.mVelocity = Vec3(random.FloatRange(-cMaxSpeed, cMaxSpeed),
+                              random.FloatRange(-cMaxSpeed, cMaxSpeed),
+                              random.FloatRange(-cMaxSpeed, cMaxSpeed));
+
+      Vec3 axis = Math::Normalized(Vec3(random.FloatRange(-1, 1), random.FloatRange(-1, 1), random.FloatRange(1, 2)));
+      entity.mRotation = Math::ToQuaternion(axis, random.FloatRange(0, Math::cTwoPi));
+
+      float angularSpeed = (random.Float() < cRotatingRatio) ? random.FloatRange(0, cMaxAngularSpeed) : 0.0f;
+      entity.mSpin = Math::ToQuaternion(axis, angularSpeed * cTimeStep);
+
+      // Spawn each replica on its own, as game objects are
+      replicas.Clear();
+      replicas.PushBack(replica);
+      mServer.mReplicator.SpawnReplicas(replicas);
+    }
+  }
+
+  /// Moves every replica on the server
+  void Move()
+  {
+    using namespace LoopbackBenchmark;
+
+    forRange (LoopbackReplica* replica, mServer.mReplicator.GetOwnedReplicas().All())
+    {
+      LoopbackEntity& entity = replica->mEntity;
+      entity.mPosition += entity.mVelocity * cTimeStep;
+      for (uint i = 0; i < 3; ++i)
+      {
+        // Bounce off the edges of the world
+        if (Math::Abs(entity.mPosition[i]) > cWorldExtent * 0.5f)
+          entity.mVelocity[i] = -entity.mVelocity[i];
+      }
+      entity.mRotation = Math::Normalized(entity.mSpin * entity.mRotation);
+    }
+  }
+
+  /// Updates every peer once, then sleeps for the rest of the frame
+  void Step()
+  {
+    using namespace LoopbackBenchmark;
+
+    Timer frameTimer;
+
+    // Update server
+    Timer timer;
+    mServer.mPeer.Update();
+    double serverTime = timer.UpdateAndGetTime();
+    mServerTime += serverTime;
+    mMaxServerTime = Math::Max(mMaxServerTime, serverTime);
+
+    // Update clients
+    timer.Reset();
+    forRange (LoopbackNode* client, mClients.All())
+      client->mPeer.Update();
+    mClientTime += timer.UpdateAndGetTime();
+
+    ++mFrames;
+
+    // Run in real time, the network delivers packets by the wall clock
+    TimeMs elapsed = frameTimer.UpdateAndGetTimeMilliseconds();
+    if (elapsed < cFrameDuration)
+      Os::Sleep(uint(cFrameDuration - elapsed));
+  }
+
+  /// Steps until the condition is met
+  /// Returns the time taken, else TimeMs(-1) (timed out)
+  TimeMs RunUntil(bool (LoopbackBenchmarkSession::*condition)() const)
+  {
+    Timer timer;
+    while (!(this->*condition)())
+    {
+      TimeMs elapsed = timer.UpdateAndGetTimeMilliseconds();
+      if (elapsed > LoopbackBenchmark::cTimeout) // Timed out?
+        return TimeMs(-1);
+      Step();
+    }
+    return timer.UpdateAndGetTimeMilliseconds();
+  }
+
+  /// Returns true if every client is connected, else false
+  bool AllConnected() const
+  {
+    forRange (LoopbackNode* client, mClients.All())
+      if (!client->mReplicator.HasLinks())
+        return false;
+    return true;
+  }
+  /// Returns true if every client knows every replica, else false
+  bool AllSpawned() const
+  {
+    forRange (LoopbackNode* client, mClients.All())
+      if (client->mReplicator.GetReplicaCount() != mOptions.mReplicas)
+        return false;
+    return true;
+  }
+  /// Returns true if every client's replicas match the server, else false
+  bool AllConverged() const
+  {
+    if (!AllSpawned())
+      return false;
+
+    forRange (LoopbackNode* client, mClients.All())
+      if (!client->MatchesServer(mServer.mReplicator))
+        return false;
+    return true;
+  }
+
+  /// Resets the frame timings
+  void ResetTimings()
+  {
+    mServerTime = 0;
+    mMaxServerTime = 0;
+    mClientTime = 0;
+    mFrames = 0;
+  }
+
+  /// Data
+  LoopbackBenchmarkOptions mOptions; /// Benchmark options
+  LoopbackNetwork mNetwork;          /// Network shared by every peer
+  LoopbackNode mServer;              /// Server
+  Array<LoopbackNode*> mClients;     /// Clients
+  double mServerTime;                /// Seconds spent updating the server
+  double mMaxServerTime;             /// Longest server update in seconds
+  double mClientTime;                /// Seconds spent updating every client
+  uint mFrames;                      /// Frames stepped
+
+private:
+  /// No Copy Constructor
+  LoopbackBenchmarkSession(const LoopbackBenchmarkSession&);
+  /// No Copy Assignment Operator
+  LoopbackBenchmarkSession& operator=(const LoopbackBenchmarkSession&);
+};
+
+/// Prints the bytes sent and received per link per second
+void PrintBandwidth(cstr phase, const LoopbackBenchmarkSession& session, double seconds)
+{
+  if (!session.mClients.Size() || seconds <= 0)
+    return;
+
+  LoopbackStats serverStats = session.mNetwork.GetStats(session.mServer.mPeer.GetLocalIpv4Address());
+  LoopbackStats totalStats = session.mNetwork.GetTotalStats();
+  double linkCount = double(session.mClients.Size());
+
+  ZPrint("ReplicationBenchmark: %s: %.1f bytes per link per second down, %.1f up "
+         "(%llu packets sent, %llu lost, %llu duplicated, %llu dropped)\n",
+         phase,
+         double(serverStats.mBytesSent) / linkCount / seconds,
+         double(serverStats.mBytesReceived) / linkCount / seconds,
+         (unsigned long long)totalStats.mPacketsSent,
+         (unsigned long long)totalStats.mPacketsLost,
+         (unsigned long long)totalStats.mPacketsDuplicated,
+         (unsigned long long)totalStats.mPacketsDropped);
+}
+
+/// Runs the benchmark, returns the process exit code
+int RunLoopbackBenchmark(const LoopbackBenchmarkOptions& options)
+{
+  using namespace LoopbackBenchmark;
+
+  ZPrint("ReplicationBenchmark: %u clients, %u replicas, %u frames, %ums latency, %ums jitter, %.1f%% loss, "
+         "%.1f%% duplication, %u bits per second bandwidth\n",
+         options.mClients,
+         options.mReplicas,
+         options.mFrames,
+         uint(options.mConditions.mLatency),
+         uint(options.mConditions.mJitter),
+         options.mConditions.mPacketLoss * 100.0f,
+         options.mConditions.mDuplication * 100.0f,
+         options.mConditions.mBandwidth);
+
+  LoopbackBenchmarkSession session(options);
+  Math::Random random(options.mSeed);
+
+  // Connect
+  if (!session.Connect()) // Unable?
+  {
+    ZPrint("ReplicationBenchmark: Clients did not connect\n");
+    return 1;
+  }
+
+  // Spawn
+  session.mNetwork.ResetStats();
+  session.ResetTimings();
+  session.Spawn(random);
+  TimeMs spawnTime = session.RunUntil(&LoopbackBenchmarkSession::AllConverged);
+  if (spawnTime == TimeMs(-1)) // Timed out?
+  {
+    ZPrint("ReplicationBenchmark: Replicas did not spawn on every client\n");
+    return 1;
+  }
+  ZPrint("ReplicationBenchmark: Spawn: converged in %ums\n", uint(spawnTime));
+  PrintBandwidth("Spawn", session, TimeMsToFloatSeconds(spawnTime));
+
+  // Move
+  session.mNetwork.ResetStats();
+  session.ResetTimings();
+  Timer moveTimer;
+  for (uint frame = 0; frame < options.mFrames; ++frame)
+  {
+    session.Move();
+    session.Step();
+  }
+  double moveSeconds = moveTimer.UpdateAndGetTime();
+  uint frames = Math::Max(session.mFrames, 1u);
+  ZPrint("ReplicationBenchmark: Move: server %.3f ms per frame (%.3f ms max), clients %.3f ms per frame\n",
+         session.mServerTime * 1000.0 / frames,
+         session.mMaxServerTime * 1000.0,
+         session.mClientTime * 1000.0 / frames);
+  PrintBandwidth("Move", session, moveSeconds);
+
+  // Settle
+  TimeMs settleTime = session.RunUntil(&LoopbackBenchmarkSession::AllConverged);
+  if (settleTime == TimeMs(-1)) // Timed out?
+  {
+    ZPrint("ReplicationBenchmark: Replicas did not converge on every client\n");
+    return 1;
+  }
+  ZPrint("ReplicationBenchmark: Settle: converged in %ums\n", uint(settleTime));
+
+  return 0;
+}
+
+} // namespace Zero
+
+using namespace Zero;
+
+extern "C" int main(int argc, char* argv[])
+{
+  CommandLineToStringArray(gCommandLineArguments, argv, argc);
+
+  CommonLibrary::Initialize();
+  StdOutListener stdoutListener;
+  Zero::Console::Add(&stdoutListener);
+
+  int result = 1;
+  LoopbackBenchmarkOptions options;
+  if (ParseBenchmarkOptions(argc, argv, options))
+    result = RunLoopbackBenchmark(options);
+
+  Zero::Console::Remove(&stdoutListener);
+  CommonLibrary::Shutdown();
+  return result;
+}
@@ -0,0 +1,4 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+#include "Replication/ReplicationStandard.hpp"
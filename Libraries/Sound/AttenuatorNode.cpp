@@ -60,19 +60,19 @@ void AttenuatorNode::SetPosition(Math::Vec3Param position)
 void AttenuatorNode::SetStartDistance(float distance)
 {
   mAttenStartDist.Set(distance, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&AttenuatorNode::UpdateDistanceInterpolator, this), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&AttenuatorNode::UpdateDistanceInterpolator, this), this);
 }
 
 void AttenuatorNode::SetEndDistance(float distance)
 {
   mAttenEndDist.Set(distance, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&AttenuatorNode::UpdateDistanceInterpolator, this), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&AttenuatorNode::UpdateDistanceInterpolator, this), this);
 }
 
 void AttenuatorNode::SetMinimumVolume(float volume)
 {
   mMinimumVolume.Set(volume, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&AttenuatorNode::UpdateDistanceInterpolator, this), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&AttenuatorNode::UpdateDistanceInterpolator, this), this);
 }
 
 void AttenuatorNode::SetCurveType(const FalloffCurveType::Enum type, Array<Math::Vec3>* customCurveData)
@@ -80,12 +80,12 @@ void AttenuatorNode::SetCurveType(const FalloffCurveType::Enum type, Array<Math:
   if (customCurveData)
     // Interpolator will delete curve on destruction or when replaced with
     // another curve
-    Z::gSound->Mixer.AddTask(CreateFunctor(&InterpolatingObject::SetCustomCurve,
+    Z::gSound->Mixer.AddTask(MakeFunctor(&InterpolatingObject::SetCustomCurve,
                                            &DistanceInterpolator,
                                            new Array<Math::Vec3>(*customCurveData)),
                              this);
   else
-    Z::gSound->Mixer.AddTask(CreateFunctor(&InterpolatingObject::SetCurve, &DistanceInterpolator, type), this);
+    Z::gSound->Mixer.AddTask(MakeFunctor(&InterpolatingObject::SetCurve, &DistanceInterpolator, type), this);
 }
 
 void AttenuatorNode::SetUsingLowPass(const bool useLowPass)
@@ -96,13 +96,13 @@ void AttenuatorNode::SetUsingLowPass(const bool useLowPass)
 void AttenuatorNode::SetLowPassDistance(const float distance)
 {
   mLowPassDistance.Set(distance, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&AttenuatorNode::UpdateLowPassInterpolator, this), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&AttenuatorNode::UpdateLowPassInterpolator, this), this);
 }
 
 void AttenuatorNode::SetLowPassCutoffFreq(const float frequency)
 {
   mLowPassCutoff.Set(frequency, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&AttenuatorNode::UpdateLowPassInterpolator, this), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&AttenuatorNode::UpdateLowPassInterpolator, this), this);
 }
 
 bool AttenuatorNode::GetOutputSamples(BufferType* outputBuffer,
@@ -9,23 +9,77 @@ using namespace AudioConstants;
 
 // Audio Task
 
-AudioTask::AudioTask() : mFunction(nullptr), mObject(nullptr)
+AudioTask::AudioTask() : AudioTask(MakeFunctor(&AudioTask::DoNothing), nullptr)
 {
 }
 
-AudioTask::AudioTask(Functor* function, HandleOf<SoundNode> node) : mFunction(function), mObject(node)
+AudioTask::AudioTask(const AudioTask& other) : mCopyFunction(other.mCopyFunction), mObject(other.mObject)
 {
+  mFunction = mCopyFunction(other.mFunction, mFunctionData);
 }
 
-AudioTask::AudioTask(const AudioTask& other) : mFunction(other.mFunction), mObject(other.mObject)
+AudioTask::~AudioTask()
 {
-  const_cast<AudioTask&>(other).mFunction = nullptr;
+  // The functor lives in this task's data, it only needs to be destructed
+  mFunction->~Functor();
 }
 
-AudioTask::~AudioTask()
+AudioTask& AudioTask::operator=(const AudioTask& other)
+{
+  if (this == &other)
+    return *this;
+
+  mFunction->~Functor();
+  mCopyFunction = other.mCopyFunction;
+  mFunction = mCopyFunction(other.mFunction, mFunctionData);
+  mObject = other.mObject;
+  return *this;
+}
+
+void AudioTask::Execute()
 {
-  if (mFunction)
-    delete mFunction;
+  mFunction->Execute();
+}
+
+void AudioTask::DoNothing()
+{
+}
+
+// Audio Task Queue
+
+void AudioTaskQueue::Write(const AudioTask& task)
+{
+  // Tasks that overflowed have to run first
+  if (!mOverflow.Empty())
+    FlushOverflow();
+
+  if (!mOverflow.Empty() || !mTasks.Write(task))
+    mOverflow.PushBack(task);
+}
+
+void AudioTaskQueue::FlushOverflow()
+{
+  uint flushedCount = 0;
+  while (flushedCount < mOverflow.Size() && mTasks.Write(mOverflow[flushedCount]))
+    ++flushedCount;
+
+  if (flushedCount != 0)
+    mOverflow.Erase(mOverflow.SubRange(0, flushedCount));
+}
+
+void AudioTaskQueue::ExecuteTasks()
+{
+  // Only run as many tasks as fit on the queue so a task that adds more tasks
+  // can't keep the reader busy forever
+  for (uint i = 0; i < cCapacity; ++i)
+  {
+    AudioTask* task = mTasks.Peek();
+    if (task == nullptr)
+      return;
+
+    task->Execute();
+    mTasks.Pop();
+  }
 }
 
 // Audio Mixer
@@ -36,8 +90,6 @@ AudioMixer::AudioMixer() :
     mMinimumVolumeThresholdThreaded(0.015f),
     mSendMicrophoneInputData(cFalse),
     FinalOutputNode(nullptr),
-    mMixThreadTaskWriteIndex(0),
-    mGameThreadTaskWriteIndex(0),
     mShuttingDown(cFalse),
     mVolume(1.0f),
     mPeakVolumeLastMix(0.0f),
@@ -173,7 +225,7 @@ void AudioMixer::MixLoopThreaded()
     double timeDiff = (double)(clock() - time) / CLOCKS_PER_SEC;
     if (timeDiff > maxTime)
     {
-      AddTaskThreaded(Zero::CreateFunctor(&ExternalSystemInterface::SendAudioError,
+      AddTaskThreaded(Zero::MakeFunctor(&ExternalSystemInterface::SendAudioError,
                                           ExternalInterface,
                                           Zero::String("Mix took too long (informational message, not an error)")));
     }
@@ -192,23 +244,9 @@ void AudioMixer::MixLoopThreaded()
   } while (running && Zero::ThreadingEnabled);
 }
 
-void AudioMixer::AddTask(Functor* task, HandleOf<SoundNode> node)
-{
-  MixThreadTasksLock.Lock();
-  TasksForMixThread[mMixThreadTaskWriteIndex].PushBack(AudioTask(task, node));
-  MixThreadTasksLock.Unlock();
-}
-
-void AudioMixer::AddTaskThreaded(Functor* task, HandleOf<SoundNode> node)
-{
-  GameThreadTasksLock.Lock();
-  TasksForGameThread[mGameThreadTaskWriteIndex].PushBack(AudioTask(task, node));
-  GameThreadTasksLock.Unlock();
-}
-
 void AudioMixer::SetLatency(AudioLatency::Enum latency)
 {
-  AddTask(CreateFunctor(&AudioIOInterface::SetOutputLatencyThreaded, &AudioIO, latency), nullptr);
+  AddTask(MakeFunctor(&AudioIOInterface::SetOutputLatencyThreaded, &AudioIO, latency), nullptr);
 }
 
 bool AudioMixer::StartInput()
@@ -241,7 +279,7 @@ bool AudioMixer::GetMuteAllAudio()
 
 void AudioMixer::SetMuteAllAudio(const bool muteAudio)
 {
-  AddTask(CreateFunctor(&AudioMixer::SetMutedThreaded, this, muteAudio), nullptr);
+  AddTask(MakeFunctor(&AudioMixer::SetMutedThreaded, this, muteAudio), nullptr);
 }
 
 unsigned AudioMixer::GetOutputChannels()
@@ -272,7 +310,7 @@ float AudioMixer::GetRMSOutputVolume()
 
 void AudioMixer::SetMinimumVolumeThreshold(const float volume)
 {
-  AddTask(CreateFunctor(&AudioMixer::mMinimumVolumeThresholdThreaded, this, volume), nullptr);
+  AddTask(MakeFunctor(&AudioMixer::mMinimumVolumeThresholdThreaded, this, volume), nullptr);
 }
 
 void AudioMixer::SetSendUncompressedMicInput(const bool sendInput)
@@ -492,41 +530,18 @@ bool AudioMixer::MixCurrentInstancesThreaded()
   return true;
 }
 
-int SwapBufferIndexes(int* index)
-{
-  int current = *index;
-  *index = (current + 1) % 2;
-  return current;
-}
-
 void AudioMixer::HandleTasksThreaded()
 {
-  MixThreadTasksLock.Lock();
-  TaskListType& list = TasksForMixThread[SwapBufferIndexes(&mMixThreadTaskWriteIndex)];
-  MixThreadTasksLock.Unlock();
-
-  forRange (AudioTask& task, list.All())
-  {
-    ErrorIf(!task.mFunction, "Functor pointer is null");
-    task.mFunction->Execute();
-  }
-
-  list.Clear();
+  // The mix thread writes the game thread's tasks
+  TasksForGameThread.FlushOverflow();
+  TasksForMixThread.ExecuteTasks();
 }
 
 void AudioMixer::HandleTasks()
 {
-  GameThreadTasksLock.Lock();
-  TaskListType& list = TasksForGameThread[SwapBufferIndexes(&mGameThreadTaskWriteIndex)];
-  GameThreadTasksLock.Unlock();
-
-  forRange (AudioTask& task, list.All())
-  {
-    ErrorIf(!task.mFunction, "Functor pointer is null");
-    task.mFunction->Execute();
-  }
-
-  list.Clear();
+  // The game thread writes the mix thread's tasks
+  TasksForMixThread.FlushOverflow();
+  TasksForGameThread.ExecuteTasks();
 }
 
 void AudioMixer::CheckForResamplingThreaded()
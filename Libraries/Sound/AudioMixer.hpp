@@ -7,16 +7,75 @@ namespace Zero
 
 // Audio Task
 
+// A function to run on the other audio thread. The functor is stored inside the
+// task so creating and copying tasks never allocates.
 class AudioTask
 {
 public:
+  // The functor should come from MakeFunctor
+  template <typename FunctorType>
+  AudioTask(const FunctorType& function, HandleOf<SoundNode> node) :
+      mCopyFunction(&CopyFunctor<FunctorType>),
+      mObject(node)
+  {
+    static_assert(sizeof(FunctorType) <= sizeof(mFunctionData), "Functor is too large to store in an AudioTask");
+    mFunction = new (mFunctionData) FunctorType(function);
+  }
+  // A task that does nothing
   AudioTask();
-  AudioTask(Functor* function, HandleOf<SoundNode> node);
   AudioTask(const AudioTask& other);
   ~AudioTask();
 
+  AudioTask& operator=(const AudioTask& other);
+
+  // Runs the task's function
+  void Execute();
+
+private:
+  typedef Functor* (*CopyFunctorFn)(const Functor* function, void* destination);
+
+  static void DoNothing();
+
+  template <typename FunctorType>
+  static Functor* CopyFunctor(const Functor* function, void* destination)
+  {
+    return new (destination) FunctorType(*(const FunctorType*)function);
+  }
+
+  // The largest functor a task can store
+  static const size_t cMaxFunctorSize = 96;
+
+  // Points at the functor constructed in mFunctionData
   Functor* mFunction;
+  // Copies the functor to another task's data
+  CopyFunctorFn mCopyFunction;
+  // Keeps the node alive until the task has run
   HandleOf<SoundNode> mObject;
+  MaxAlignmentType mFunctionData[ZeroAlignCount(cMaxFunctorSize)];
+};
+
+// Audio Task Queue
+
+// Tasks written by one audio thread and executed by the other without any
+// locks or allocations. If the reader falls behind far enough for the queue to
+// fill up, tasks wait in an overflow list (only touched by the writer) until
+// the reader has made room.
+class AudioTaskQueue
+{
+public:
+  // Adds a task to the queue, only called by the writing thread
+  void Write(const AudioTask& task);
+  // Moves any overflowed tasks onto the queue, only called by the writing thread
+  void FlushOverflow();
+  // Executes the tasks currently on the queue, only called by the reading thread
+  void ExecuteTasks();
+
+  // The number of tasks that fit on the queue
+  static const unsigned cCapacity = 4096;
+
+private:
+  BoundedLockFreeQueue<AudioTask, cCapacity> mTasks;
+  Array<AudioTask> mOverflow;
 };
 
 // Audio Mixer
@@ -34,10 +93,20 @@ public:
   void Update();
   // Looping function on the mix thread to handle tasks and mix output
   void MixLoopThreaded();
-  // Adds a task from the main thread for the mix thread to handle
-  void AddTask(Functor* task, HandleOf<SoundNode> node);
-  // Adds a task from the mix thread for the main thread to handle
-  void AddTaskThreaded(Functor* task, HandleOf<SoundNode> node);
+  // Adds a task from the main thread for the mix thread to handle (the functor
+  // should come from MakeFunctor)
+  template <typename FunctorType>
+  void AddTask(const FunctorType& task, HandleOf<SoundNode> node)
+  {
+    TasksForMixThread.Write(AudioTask(task, node));
+  }
+  // Adds a task from the mix thread for the main thread to handle (the functor
+  // should come from MakeFunctor)
+  template <typename FunctorType>
+  void AddTaskThreaded(const FunctorType& task, HandleOf<SoundNode> node)
+  {
+    TasksForGameThread.Write(AudioTask(task, node));
+  }
   // Sets whether to use the high or low latency values
   void SetLatency(AudioLatency::Enum latency);
   // Starts the input stream if it is not already started. Returns false if
@@ -100,9 +169,9 @@ private:
   // Adds current sounds into the output buffer. Will return false when the
   // system can shut down.
   bool MixCurrentInstancesThreaded();
-  // Switches buffer pointers and executes all current tasks for the mix thread.
+  // Executes all current tasks for the mix thread.
   void HandleTasksThreaded();
-  // Switches buffer pointers and executes all tasks for the main thread.
+  // Executes all current tasks for the main thread.
   void HandleTasks();
   // Checks for resampling and resets variables if applicable
   void CheckForResamplingThreaded();
@@ -117,8 +186,6 @@ private:
   // Turns on and off sending microphone input
   void SetSendMicInput(bool turnOn);
 
-  typedef Array<AudioTask> TaskListType;
-
   // Array used to accumulate samples for output
   BufferType BufferForOutput;
   // Array for finished mixed output
@@ -130,14 +197,10 @@ private:
   // For low frequency channel on 5.1 or 7.1 mix
   // Must be pointer because relies on audio system in constructor
   LowPassFilter* LowPass;
-  // Read and write task buffers for the mix thread
-  TaskListType TasksForMixThread[2];
-  // Lock used for switching mix thread task buffers
-  ThreadLock MixThreadTasksLock;
-  // Read and write task buffers for the game thread
-  TaskListType TasksForGameThread[2];
-  // Lock used for switching game thread task buffers
-  ThreadLock GameThreadTasksLock;
+  // Tasks written by the game thread for the mix thread
+  AudioTaskQueue TasksForMixThread;
+  // Tasks written by the mix thread for the game thread
+  AudioTaskQueue TasksForGameThread;
   // Object to get MIDI data from the operating system.
   MidiInput MidiObject;
   // Resampler object used to resample mixed output
@@ -151,10 +214,6 @@ private:
   // Stored microphone input samples when sending compressed input
   Array<float> PreviousInputSamples;
 
-  // Index of the mix thread task buffer to write to
-  int mMixThreadTaskWriteIndex;
-  // Index of the game thread task buffer to write to
-  int mGameThreadTaskWriteIndex;
   // To tell the system to shut down once everything stops.
   ThreadedInt mShuttingDown;
   // Overall system volume.
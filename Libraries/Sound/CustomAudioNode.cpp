@@ -132,7 +132,7 @@ void CustomAudioNode::SendBuffer(SoundBuffer* buffer)
   if (!buffer)
     DoNotifyException("Audio Error", "Called SendBuffer on CustomAudioNode with a null SoundBuffer");
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&CustomAudioNode::AddBufferThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&CustomAudioNode::AddBufferThreaded,
                                          this,
                                          new SampleBuffer(buffer->mBuffer.Data(), buffer->mBuffer.Size())),
                            this);
@@ -145,7 +145,7 @@ void CustomAudioNode::SendPartialBuffer(SoundBuffer* buffer, int startAtIndex, i
   else if (startAtIndex < 0 || ((startAtIndex + howManySamples) > (int)buffer->mBuffer.Size()))
     DoNotifyException("Audio Error", "SendPartialBuffer parameters exceed size of the SoundBuffer");
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&CustomAudioNode::AddBufferThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&CustomAudioNode::AddBufferThreaded,
                                          this,
                                          new SampleBuffer(buffer->mBuffer.Data() + startAtIndex, howManySamples)),
                            this);
@@ -154,7 +154,7 @@ void CustomAudioNode::SendPartialBuffer(SoundBuffer* buffer, int startAtIndex, i
 void CustomAudioNode::SendMicUncompressedData(const HandleOf<ArrayClass<float>>& audioData)
 {
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&CustomAudioNode::AddBufferThreaded,
+      MakeFunctor(&CustomAudioNode::AddBufferThreaded,
                     this,
                     new SampleBuffer(audioData->NativeArray.Data(), audioData->NativeArray.Size())),
       this);
@@ -176,7 +176,7 @@ void CustomAudioNode::SendMicCompressedData(const HandleOf<ArrayClass<byte>>& au
       audioData->NativeArray.Data(), audioData->NativeArray.Size(), decodedSamples, sampleCount);
 
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&CustomAudioNode::AddBufferThreaded, this, new SampleBuffer(decodedSamples, sampleCount)), this);
+      MakeFunctor(&CustomAudioNode::AddBufferThreaded, this, new SampleBuffer(decodedSamples, sampleCount)), this);
 }
 
 bool CustomAudioNode::GetOutputSamples(BufferType* outputBuffer,
@@ -191,7 +191,7 @@ bool CustomAudioNode::GetOutputSamples(BufferType* outputBuffer,
     {
       mWaitingForSamplesThreaded = true;
       Z::gSound->Mixer.AddTaskThreaded(
-          CreateFunctor(&CustomAudioNode::DispatchSamplesEvent, this, mMinimumSamplesNeededInBuffersThreaded * 2),
+          MakeFunctor(&CustomAudioNode::DispatchSamplesEvent, this, mMinimumSamplesNeededInBuffersThreaded * 2),
           this);
     }
     return false;
@@ -264,7 +264,7 @@ bool CustomAudioNode::GetOutputSamples(BufferType* outputBuffer,
     unsigned samplesNeeded = mMinimumSamplesNeededInBuffersThreaded - mTotalSamplesInBuffersThreaded +
                              mMinimumSamplesNeededInBuffersThreaded;
     samplesNeeded -= samplesNeeded % channels;
-    Z::gSound->Mixer.AddTaskThreaded(CreateFunctor(&CustomAudioNode::DispatchSamplesEvent, this, samplesNeeded), this);
+    Z::gSound->Mixer.AddTaskThreaded(MakeFunctor(&CustomAudioNode::DispatchSamplesEvent, this, samplesNeeded), this);
   }
 
   return true;
@@ -284,7 +284,7 @@ void CustomAudioNode::AddBufferThreaded(SampleBuffer* newBuffer)
     unsigned samplesNeeded = mMinimumSamplesNeededInBuffersThreaded - mTotalSamplesInBuffersThreaded +
                              mMinimumSamplesNeededInBuffersThreaded;
     samplesNeeded -= samplesNeeded % mChannels.Get(AudioThreads::MixThread);
-    Z::gSound->Mixer.AddTaskThreaded(CreateFunctor(&CustomAudioNode::DispatchSamplesEvent, this, samplesNeeded), this);
+    Z::gSound->Mixer.AddTaskThreaded(MakeFunctor(&CustomAudioNode::DispatchSamplesEvent, this, samplesNeeded), this);
   }
 }
 
@@ -294,7 +294,7 @@ void CustomAudioNode::SetMinimumBufferSize()
       (unsigned)(AudioConstants::cSystemSampleRate * 0.01f * mChannels.Get(AudioThreads::MainThread) * 4);
 
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&CustomAudioNode::mMinimumSamplesNeededInBuffersThreaded, this, mMinimumBufferSize * 3), this);
+      MakeFunctor(&CustomAudioNode::mMinimumSamplesNeededInBuffersThreaded, this, mMinimumBufferSize * 3), this);
 }
 
 void CustomAudioNode::DispatchSamplesEvent(unsigned samplesNeeded)
@@ -43,7 +43,7 @@ void VolumeNode::InterpolateVolume(float volume, float time)
   {
     time = Math::Max(time, 0.02f);
 
-    Z::gSound->Mixer.AddTask(CreateFunctor(&VolumeNode::InterpolateVolumeThreaded, this, volume, time), this);
+    Z::gSound->Mixer.AddTask(MakeFunctor(&VolumeNode::InterpolateVolumeThreaded, this, volume, time), this);
   }
 }
 
@@ -98,7 +98,7 @@ bool VolumeNode::GetOutputSamples(BufferType* outputBuffer,
         if (firstRequest)
         {
           Z::gSound->Mixer.AddTaskThreaded(
-              CreateFunctor(&SoundNode::DispatchEventFromMixThread, (SoundNode*)this, Events::AudioInterpolationDone),
+              MakeFunctor(&SoundNode::DispatchEventFromMixThread, (SoundNode*)this, Events::AudioInterpolationDone),
               this);
         }
       }
@@ -181,7 +181,7 @@ void PanningNode::SetLeftVolume(float volume)
 
 void PanningNode::InterpolateLeftVolume(float volume, float time)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&PanningNode::SetVolumeThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&PanningNode::SetVolumeThreaded,
                                          this,
                                          true,
                                          Math::Clamp(volume, 0.0f, cMaxVolumeValue),
@@ -201,7 +201,7 @@ void PanningNode::SetRightVolume(float volume)
 
 void PanningNode::InterpolateRightVolume(float volume, float time)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&PanningNode::SetVolumeThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&PanningNode::SetVolumeThreaded,
                                          this,
                                          false,
                                          Math::Clamp(volume, 0.0f, cMaxVolumeValue),
@@ -211,13 +211,13 @@ void PanningNode::InterpolateRightVolume(float volume, float time)
 
 void PanningNode::InterpolateVolumes(float leftVolume, float rightVolume, float time)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&PanningNode::SetVolumeThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&PanningNode::SetVolumeThreaded,
                                          this,
                                          true,
                                          Math::Clamp(leftVolume, 0.0f, cMaxVolumeValue),
                                          Math::Max(time, 0.0f)),
                            this);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&PanningNode::SetVolumeThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&PanningNode::SetVolumeThreaded,
                                          this,
                                          false,
                                          Math::Clamp(rightVolume, 0.0f, cMaxVolumeValue),
@@ -281,7 +281,7 @@ bool PanningNode::GetOutputSamples(BufferType* outputBuffer,
           CurrentData.mInterpolating = false;
           if (firstRequest)
             Z::gSound->Mixer.AddTaskThreaded(
-                CreateFunctor(&SoundNode::DispatchEventFromMixThread, (SoundNode*)this, Events::AudioInterpolationDone),
+                MakeFunctor(&SoundNode::DispatchEventFromMixThread, (SoundNode*)this, Events::AudioInterpolationDone),
                 this);
         }
       }
@@ -405,7 +405,7 @@ void PitchNode::SetPitch(float pitchRatio)
 void PitchNode::InterpolatePitch(float pitchRatio, float time)
 {
   pitchRatio = Math::Clamp(pitchRatio, cMinPitchValue, cMaxPitchValue);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&PitchNode::SetPitchThreaded, this, PitchToSemitones(pitchRatio), time), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&PitchNode::SetPitchThreaded, this, PitchToSemitones(pitchRatio), time), this);
 }
 
 float PitchNode::GetSemitones()
@@ -421,7 +421,7 @@ void PitchNode::SetSemitones(float pitchSemitones)
 
 void PitchNode::InterpolateSemitones(float pitchSemitones, float time)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&PitchNode::SetPitchThreaded, this, pitchSemitones, time), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&PitchNode::SetPitchThreaded, this, pitchSemitones, time), this);
 }
 
 bool PitchNode::GetOutputSamples(BufferType* outputBuffer,
@@ -489,7 +489,7 @@ float LowPassNode::GetCutoffFrequency()
 void LowPassNode::SetCutoffFrequency(float frequency)
 {
   mCutoffFrequency.Set(frequency, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&LowPassNode::SetCutoffFrequencyThreaded, this, frequency), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&LowPassNode::SetCutoffFrequencyThreaded, this, frequency), this);
 }
 
 bool LowPassNode::GetOutputSamples(BufferType* outputBuffer,
@@ -584,7 +584,7 @@ float HighPassNode::GetCutoffFrequency()
 void HighPassNode::SetCutoffFrequency(float frequency)
 {
   mCutoffFrequency.Set(frequency, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&HighPassNode::SetCutoffFrequencyThreaded, this, frequency), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&HighPassNode::SetCutoffFrequencyThreaded, this, frequency), this);
 }
 
 bool HighPassNode::GetOutputSamples(BufferType* outputBuffer,
@@ -682,7 +682,7 @@ float BandPassNode::GetCentralFrequency()
 void BandPassNode::SetCentralFrequency(float frequency)
 {
   mCentralFrequency.Set(frequency, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&BandPassNode::SetCentralFrequencyThreaded, this, frequency), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&BandPassNode::SetCentralFrequencyThreaded, this, frequency), this);
 }
 
 float BandPassNode::GetQualityFactor()
@@ -693,7 +693,7 @@ float BandPassNode::GetQualityFactor()
 void BandPassNode::SetQualityFactor(float Q)
 {
   mQuality.Set(Q, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&BandPassNode::SetQualityFactorThreaded, this, Q), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&BandPassNode::SetQualityFactorThreaded, this, Q), this);
 }
 
 bool BandPassNode::GetOutputSamples(BufferType* outputBuffer,
@@ -797,7 +797,7 @@ float EqualizerNode::GetLowPassGain()
 void EqualizerNode::SetLowPassGain(float gain)
 {
   mLowPassGain.Set(Math::Clamp(gain, 0.0f, cMaxVolumeValue), AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&EqualizerNode::SetBandGainThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&EqualizerNode::SetBandGainThreaded,
                                          this,
                                          EqualizerBands::Below80,
                                          mLowPassGain.Get(AudioThreads::MainThread)),
@@ -812,7 +812,7 @@ float EqualizerNode::GetHighPassGain()
 void EqualizerNode::SetHighPassGain(float gain)
 {
   mHighPassGain.Set(Math::Clamp(gain, 0.0f, cMaxVolumeValue), AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&EqualizerNode::SetBandGainThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&EqualizerNode::SetBandGainThreaded,
                                          this,
                                          EqualizerBands::Above5000,
                                          mHighPassGain.Get(AudioThreads::MainThread)),
@@ -828,7 +828,7 @@ void EqualizerNode::SetBand1Gain(float gain)
 {
   mBand1Gain.Set(Math::Clamp(gain, 0.0f, cMaxVolumeValue), AudioThreads::MainThread);
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(
+      MakeFunctor(
           &EqualizerNode::SetBandGainThreaded, this, EqualizerBands::At150, mBand1Gain.Get(AudioThreads::MainThread)),
       this);
 }
@@ -842,7 +842,7 @@ void EqualizerNode::SetBand2Gain(float gain)
 {
   mBand2Gain.Set(Math::Clamp(gain, 0.0f, cMaxVolumeValue), AudioThreads::MainThread);
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(
+      MakeFunctor(
           &EqualizerNode::SetBandGainThreaded, this, EqualizerBands::At600, mBand2Gain.Get(AudioThreads::MainThread)),
       this);
 }
@@ -856,7 +856,7 @@ void EqualizerNode::SetBand3Gain(float gain)
 {
   mBand3Gain.Set(Math::Clamp(gain, 0.0f, cMaxVolumeValue), AudioThreads::MainThread);
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(
+      MakeFunctor(
           &EqualizerNode::SetBandGainThreaded, this, EqualizerBands::At2500, mBand3Gain.Get(AudioThreads::MainThread)),
       this);
 }
@@ -877,7 +877,7 @@ void EqualizerNode::InterpolateAllBands(
   values[EqualizerBands::At2500] = mBand3Gain.Get(AudioThreads::MainThread);
   values[EqualizerBands::Above5000] = mHighPassGain.Get(AudioThreads::MainThread);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&EqualizerNode::InterpolateAllThreaded, this, values, timeToInterpolate),
+  Z::gSound->Mixer.AddTask(MakeFunctor(&EqualizerNode::InterpolateAllThreaded, this, values, timeToInterpolate),
                            this);
 }
 
@@ -981,7 +981,7 @@ void ReverbNode::SetLength(float time)
 {
   time = Math::Clamp(time, 0.0f, 100.0f);
   mTimeSec.Set(time, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&ReverbNode::SetLengthMsThreaded, this, time * 1000.0f), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&ReverbNode::SetLengthMsThreaded, this, time * 1000.0f), this);
 }
 
 float ReverbNode::GetWetPercent()
@@ -993,7 +993,7 @@ void ReverbNode::SetWetPercent(float percent)
 {
   percent = Math::Clamp(percent, 0.0f, 100.0f) / 100.0f;
   mWetLevelValue.Set(percent, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&ReverbNode::SetWetValueThreaded, this, percent), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&ReverbNode::SetWetValueThreaded, this, percent), this);
 }
 
 float ReverbNode::GetWetValue()
@@ -1005,21 +1005,21 @@ void ReverbNode::SetWetValue(float value)
 {
   value = Math::Clamp(value, 0.0f, 1.0f);
   mWetLevelValue.Set(value, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&ReverbNode::SetWetValueThreaded, this, value), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&ReverbNode::SetWetValueThreaded, this, value), this);
 }
 
 void ReverbNode::InterpolateWetPercent(float percent, float time)
 {
   percent = Math::Clamp(percent, 0.0f, 100.0f) / 100.0f;
   mWetLevelValue.Set(percent, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&ReverbNode::InterpolateWetValueThreaded, this, percent, time), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&ReverbNode::InterpolateWetValueThreaded, this, percent, time), this);
 }
 
 void ReverbNode::InterpolateWetValue(float value, float time)
 {
   value = Math::Clamp(value, 0.0f, 1.0f);
   mWetLevelValue.Set(value, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&ReverbNode::InterpolateWetValueThreaded, this, value, time), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&ReverbNode::InterpolateWetValueThreaded, this, value, time), this);
 }
 
 bool ReverbNode::GetOutputSamples(BufferType* outputBuffer,
@@ -1126,7 +1126,7 @@ void DelayNode::SetDelay(float seconds)
 {
   seconds = Math::Max(seconds, 0.0f);
   mDelaySec.Set(seconds, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DelayNode::SetDelayMsThreaded, this, seconds * 1000.0f), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DelayNode::SetDelayMsThreaded, this, seconds * 1000.0f), this);
 }
 
 float DelayNode::GetFeedbackPercent()
@@ -1138,7 +1138,7 @@ void DelayNode::SetFeedbackPercent(float feedback)
 {
   feedback = Math::Clamp(feedback, 0.0f, 100.0f) / 100.0f;
   mFeedbackValue.Set(feedback, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DelayNode::SetFeedbackThreaded, this, feedback), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DelayNode::SetFeedbackThreaded, this, feedback), this);
 }
 
 float DelayNode::GetFeedbackValue()
@@ -1150,7 +1150,7 @@ void DelayNode::SetFeedbackValue(float feedback)
 {
   feedback = Math::Clamp(feedback, 0.0f, 1.0f);
   mFeedbackValue.Set(feedback, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DelayNode::SetFeedbackThreaded, this, feedback), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DelayNode::SetFeedbackThreaded, this, feedback), this);
 }
 
 float DelayNode::GetWetPercent()
@@ -1162,7 +1162,7 @@ void DelayNode::SetWetPercent(float wetLevel)
 {
   wetLevel = Math::Clamp(wetLevel, 0.0f, 100.0f) / 100.0f;
   mWetValue.Set(wetLevel, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DelayNode::SetWetValueThreaded, this, wetLevel), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DelayNode::SetWetValueThreaded, this, wetLevel), this);
 }
 
 float DelayNode::GetWetValue()
@@ -1174,20 +1174,20 @@ void DelayNode::SetWetValue(float wetLevel)
 {
   wetLevel = Math::Clamp(wetLevel, 0.0f, 1.0f);
   mWetValue.Set(wetLevel, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DelayNode::SetWetValueThreaded, this, wetLevel), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DelayNode::SetWetValueThreaded, this, wetLevel), this);
 }
 
 void DelayNode::InterpolateWetPercent(float percent, float time)
 {
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&DelayNode::InterpolateWetValueThreaded, this, Math::Clamp(percent, 0.0f, 100.0f) / 100.0f, time),
+      MakeFunctor(&DelayNode::InterpolateWetValueThreaded, this, Math::Clamp(percent, 0.0f, 100.0f) / 100.0f, time),
       this);
 }
 
 void DelayNode::InterpolateWetValue(float wetLevel, float time)
 {
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&DelayNode::InterpolateWetValueThreaded, this, Math::Clamp(wetLevel, 0.0f, 1.0f), time), this);
+      MakeFunctor(&DelayNode::InterpolateWetValueThreaded, this, Math::Clamp(wetLevel, 0.0f, 1.0f), time), this);
 }
 
 bool DelayNode::GetOutputSamples(BufferType* outputBuffer,
@@ -1307,7 +1307,7 @@ void FlangerNode::SetModulationFrequency(float frequency)
 {
   frequency = Math::Clamp(frequency, 0.0f, 20000.0f);
   mModFrequency.Set(frequency, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&FlangerNode::SetModFreqThreaded, this, frequency), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&FlangerNode::SetModFreqThreaded, this, frequency), this);
 }
 
 float FlangerNode::GetFeedbackPercent()
@@ -1319,7 +1319,7 @@ void FlangerNode::SetFeedbackPercent(float percent)
 {
   percent = Math::Clamp(percent, 0.0f, 100.0f) / 100.0f;
   mFeedback.Set(percent, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&FlangerNode::SetFeedbackThreaded, this, percent), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&FlangerNode::SetFeedbackThreaded, this, percent), this);
 }
 
 float FlangerNode::GetFeedbackValue()
@@ -1331,7 +1331,7 @@ void FlangerNode::SetFeedbackValue(float value)
 {
   value = Math::Clamp(value, 0.0f, 1.0f);
   mFeedback.Set(value, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&FlangerNode::SetFeedbackThreaded, this, value), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&FlangerNode::SetFeedbackThreaded, this, value), this);
 }
 
 bool FlangerNode::GetOutputSamples(BufferType* outputBuffer,
@@ -1478,7 +1478,7 @@ void ChorusNode::SetModulationFrequency(float frequency)
 {
   frequency = Math::Max(frequency, 0.0f);
   mModFrequency.Set(frequency, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&ChorusNode::SetModFreqThreaded, this, frequency), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&ChorusNode::SetModFreqThreaded, this, frequency), this);
 }
 
 float ChorusNode::GetFeedbackPercent()
@@ -1490,7 +1490,7 @@ void ChorusNode::SetFeedbackPercent(float percent)
 {
   percent = Math::Clamp(percent, 0.0f, 100.0f) / 100.0f;
   mFeedback.Set(percent, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&ChorusNode::SetFeedbackThreaded, this, percent), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&ChorusNode::SetFeedbackThreaded, this, percent), this);
 }
 
 float ChorusNode::GetFeedbackValue()
@@ -1502,7 +1502,7 @@ void ChorusNode::SetFeedbackValue(float value)
 {
   value = Math::Clamp(value, 0.0f, 1.0f);
   mFeedback.Set(value, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&ChorusNode::SetFeedbackThreaded, this, value), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&ChorusNode::SetFeedbackThreaded, this, value), this);
 }
 
 float ChorusNode::GetOffsetMillisec()
@@ -1613,7 +1613,7 @@ void CompressorNode::SetInputGainDecibels(float dB)
 {
   mInputGainDB = Math::Clamp(dB, cMinDecibelsValue, cMaxDecibelsValue);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetInputGain, &Filter, mInputGainDB), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetInputGain, &Filter, mInputGainDB), this);
 }
 
 float CompressorNode::GetThresholdDecibels()
@@ -1625,7 +1625,7 @@ void CompressorNode::SetThresholdDecibels(float dB)
 {
   mThresholdDB = Math::Clamp(dB, cMinDecibelsValue, cMaxDecibelsValue);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetThreshold, &Filter, mThresholdDB), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetThreshold, &Filter, mThresholdDB), this);
 }
 
 float CompressorNode::GetAttackMillisec()
@@ -1637,7 +1637,7 @@ void CompressorNode::SetAttackMillisec(float attack)
 {
   mAttackMSec = Math::Max(attack, 0.0f);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetAttackMSec, &Filter, mAttackMSec), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetAttackMSec, &Filter, mAttackMSec), this);
 }
 
 float CompressorNode::GetReleaseMillisec()
@@ -1649,7 +1649,7 @@ void CompressorNode::SetReleaseMillisec(float release)
 {
   mReleaseMSec = Math::Max(release, mReleaseMSec);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetReleaseMSec, &Filter, mReleaseMSec), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetReleaseMSec, &Filter, mReleaseMSec), this);
 }
 
 float CompressorNode::GetRatio()
@@ -1661,7 +1661,7 @@ void CompressorNode::SetRatio(float ratio)
 {
   mRatio = ratio;
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetRatio, &Filter, mRatio), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetRatio, &Filter, mRatio), this);
 }
 
 float CompressorNode::GetOutputGainDecibels()
@@ -1673,7 +1673,7 @@ void CompressorNode::SetOutputGainDecibels(float dB)
 {
   mOutputGainDB = Math::Clamp(dB, cMinDecibelsValue, cMaxDecibelsValue);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetOutputGain, &Filter, mOutputGainDB), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetOutputGain, &Filter, mOutputGainDB), this);
 }
 
 float CompressorNode::GetKneeWidth()
@@ -1685,7 +1685,7 @@ void CompressorNode::SetKneeWidth(float knee)
 {
   mKneeWidth = knee;
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetKneeWidth, &Filter, mKneeWidth), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetKneeWidth, &Filter, mKneeWidth), this);
 }
 
 bool CompressorNode::GetOutputSamples(BufferType* outputBuffer,
@@ -1745,7 +1745,7 @@ void ExpanderNode::SetInputGainDecibels(float dB)
 {
   mInputGainDB = Math::Clamp(dB, cMinDecibelsValue, cMaxDecibelsValue);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetInputGain, &Filter, mInputGainDB), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetInputGain, &Filter, mInputGainDB), this);
 }
 
 float ExpanderNode::GetThresholdDecibels()
@@ -1757,7 +1757,7 @@ void ExpanderNode::SetThresholdDecibels(float dB)
 {
   mThresholdDB = Math::Clamp(dB, cMinDecibelsValue, cMaxDecibelsValue);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetThreshold, &Filter, mThresholdDB), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetThreshold, &Filter, mThresholdDB), this);
 }
 
 float ExpanderNode::GetAttackMillisec()
@@ -1769,7 +1769,7 @@ void ExpanderNode::SetAttackMillisec(float attack)
 {
   mAttackMSec = Math::Max(attack, 0.0f);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetAttackMSec, &Filter, mAttackMSec), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetAttackMSec, &Filter, mAttackMSec), this);
 }
 
 float ExpanderNode::GetReleaseMillisec()
@@ -1781,7 +1781,7 @@ void ExpanderNode::SetReleaseMillisec(float release)
 {
   mReleaseMSec = Math::Max(release, 0.0f);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetReleaseMSec, &Filter, mReleaseMSec), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetReleaseMSec, &Filter, mReleaseMSec), this);
 }
 
 float ExpanderNode::GetRatio()
@@ -1793,7 +1793,7 @@ void ExpanderNode::SetRatio(float ratio)
 {
   mRatio = ratio;
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetRatio, &Filter, mRatio), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetRatio, &Filter, mRatio), this);
 }
 
 float ExpanderNode::GetOutputGainDecibels()
@@ -1805,7 +1805,7 @@ void ExpanderNode::SetOutputGainDecibels(float dB)
 {
   mOutputGainDB = Math::Clamp(dB, cMinDecibelsValue, cMaxDecibelsValue);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetOutputGain, &Filter, mOutputGainDB), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetOutputGain, &Filter, mOutputGainDB), this);
 }
 
 float ExpanderNode::GetKneeWidth()
@@ -1817,7 +1817,7 @@ void ExpanderNode::SetKneeWidth(float knee)
 {
   mKneeWidth = knee;
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetKneeWidth, &Filter, mKneeWidth), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetKneeWidth, &Filter, mKneeWidth), this);
 }
 
 bool ExpanderNode::GetOutputSamples(BufferType* outputBuffer,
@@ -1886,7 +1886,7 @@ void AddNoiseNode::SetAdditiveGain(float decibels)
 {
   mAdditiveNoiseDB = Math::Clamp(decibels, cMinDecibelsValue, cMaxDecibelsValue);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&AddNoiseNode::mAddGainThreaded, this, ValueFromDecibels(mAdditiveNoiseDB)),
+  Z::gSound->Mixer.AddTask(MakeFunctor(&AddNoiseNode::mAddGainThreaded, this, ValueFromDecibels(mAdditiveNoiseDB)),
                            this);
 }
 
@@ -1900,7 +1900,7 @@ void AddNoiseNode::SetMultiplicativeGain(float decibels)
   mMultipleNoiseDB = Math::Clamp(decibels, cMinDecibelsValue, cMaxDecibelsValue);
 
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&AddNoiseNode::mMultiplyGainThreaded, this, ValueFromDecibels(mMultipleNoiseDB)), this);
+      MakeFunctor(&AddNoiseNode::mMultiplyGainThreaded, this, ValueFromDecibels(mMultipleNoiseDB)), this);
 }
 
 float AddNoiseNode::GetAdditiveCutoff()
@@ -1913,7 +1913,7 @@ void AddNoiseNode::SetAdditiveCutoff(float frequency)
   mAdditiveNoiseCutoffHz = Math::Max(frequency, 0.0f);
 
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&AddNoiseNode::mAddPeriodThreaded, this, ValueFromFrequency(mAdditiveNoiseCutoffHz)), this);
+      MakeFunctor(&AddNoiseNode::mAddPeriodThreaded, this, ValueFromFrequency(mAdditiveNoiseCutoffHz)), this);
 }
 
 float AddNoiseNode::GetMultiplicativeCutoff()
@@ -1926,7 +1926,7 @@ void AddNoiseNode::SetMultiplicativeCutoff(float frequency)
   mMultipleNoiseCutoffHz = Math::Max(frequency, 0.0f);
 
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&AddNoiseNode::mMultiplyPeriodThreaded, this, ValueFromFrequency(mMultipleNoiseCutoffHz)), this);
+      MakeFunctor(&AddNoiseNode::mMultiplyPeriodThreaded, this, ValueFromFrequency(mMultipleNoiseCutoffHz)), this);
 }
 
 bool AddNoiseNode::GetOutputSamples(BufferType* outputBuffer,
@@ -2005,7 +2005,7 @@ void ModulationNode::SetUseAmplitudeModulation(bool useAmplitude)
 {
   mAmplitude.Set(useAmplitude, AudioThreads::MainThread);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&ModulationNode::SetUseAmplitudeThreaded, this, useAmplitude), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&ModulationNode::SetUseAmplitudeThreaded, this, useAmplitude), this);
 }
 
 float ModulationNode::GetFrequency()
@@ -2018,7 +2018,7 @@ void ModulationNode::SetFrequency(float frequency)
   mFrequency.Set(Math::Max(frequency, 0.0f), AudioThreads::MainThread);
 
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&ModulationNode::SetFrequencyThreaded, this, mFrequency.Get(AudioThreads::MainThread)), this);
+      MakeFunctor(&ModulationNode::SetFrequencyThreaded, this, mFrequency.Get(AudioThreads::MainThread)), this);
 }
 
 float ModulationNode::GetWetPercent()
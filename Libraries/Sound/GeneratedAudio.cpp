@@ -46,7 +46,7 @@ void GeneratedWaveNode::SetWaveType(SynthWaveType::Enum newType)
 {
   mWaveType = newType;
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&Oscillator::SetType, &WaveDataThreaded, newType), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&Oscillator::SetType, &WaveDataThreaded, newType), this);
 }
 
 float GeneratedWaveNode::GetWaveFrequency()
@@ -58,13 +58,13 @@ void GeneratedWaveNode::SetWaveFrequency(float frequency)
 {
   frequency = Math::Clamp(frequency, 0.0f, 20000.0f);
   mWaveFrequency.Set(frequency, AudioThreads::MainThread);
-  Z::gSound->Mixer.AddTask(CreateFunctor(&Oscillator::SetFrequency, &WaveDataThreaded, frequency), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&Oscillator::SetFrequency, &WaveDataThreaded, frequency), this);
 }
 
 void GeneratedWaveNode::InterpolateWaveFrequency(float frequency, float time)
 {
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(
+      MakeFunctor(
           &GeneratedWaveNode::InterpolateFrequencyThreaded, this, Math::Clamp(frequency, 0.0f, 20000.0f), time),
       this);
 }
@@ -91,7 +91,7 @@ void GeneratedWaveNode::SetVolume(float volume)
 
 void GeneratedWaveNode::InterpolateVolume(float volume, float time)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&GeneratedWaveNode::InterpolateVolumeThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&GeneratedWaveNode::InterpolateVolumeThreaded,
                                          this,
                                          Math::Clamp(volume, 0.0f, cMaxVolumeValue),
                                          Math::Max(time, 0.01f)),
@@ -123,7 +123,7 @@ void GeneratedWaveNode::SetSquareWavePulseValue(float value)
   mSquareWavePulseValue = Math::Clamp(value, 0.0f, 1.0f);
 
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&Oscillator::SetSquareWavePositiveFraction, &WaveDataThreaded, mSquareWavePulseValue), this);
+      MakeFunctor(&Oscillator::SetSquareWavePositiveFraction, &WaveDataThreaded, mSquareWavePulseValue), this);
 }
 
 bool GeneratedWaveNode::GetOutputSamples(BufferType* outputBuffer,
@@ -304,7 +304,7 @@ void AdditiveSynthNode::AddHarmonic(float multiplier, float volume, AdsrEnvelope
                                     Math::Max(envelope.mReleaseTime, 0.0f));
 
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&AdditiveSynthNode::AddHarmonicThreaded,
+      MakeFunctor(&AdditiveSynthNode::AddHarmonicThreaded,
                     this,
                     HarmonicData(Math::Max(multiplier, 0.0f), Math::Max(volume, 0.0f), envelopeSettings, type)),
       this);
@@ -312,7 +312,7 @@ void AdditiveSynthNode::AddHarmonic(float multiplier, float volume, AdsrEnvelope
 
 void AdditiveSynthNode::RemoveAllHarmonics()
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&HarmonicDataListType::Clear, &HarmonicsListThreaded), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&HarmonicDataListType::Clear, &HarmonicsListThreaded), this);
 }
 
 void AdditiveSynthNode::NoteOn(float midiNote, float volume)
@@ -320,17 +320,17 @@ void AdditiveSynthNode::NoteOn(float midiNote, float volume)
   if (midiNote < 0 || midiNote > 127)
     return;
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&AdditiveSynthNode::NoteOnThreaded, this, (int)midiNote, volume), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&AdditiveSynthNode::NoteOnThreaded, this, (int)midiNote, volume), this);
 }
 
 void AdditiveSynthNode::NoteOff(float midiNote)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&AdditiveSynthNode::NoteOffThreaded, this, (int)midiNote), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&AdditiveSynthNode::NoteOffThreaded, this, (int)midiNote), this);
 }
 
 void AdditiveSynthNode::StopAllNotes()
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&AdditiveSynthNode::StopAllNotesThreaded, this), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&AdditiveSynthNode::StopAllNotesThreaded, this), this);
 }
 
 bool AdditiveSynthNode::GetOutputSamples(BufferType* outputBuffer,
@@ -456,7 +456,7 @@ void MicrophoneInputNode::SetVolume(float volume)
   // Don't change volume if we are currently not active or deactivating
   if (mActive.Get(AudioThreads::MainThread) && mStopping.Get() == cFalse)
     Z::gSound->Mixer.AddTask(
-        CreateFunctor(&InterpolatingObject::SetValues, &VolumeInterpolatorThreaded, volume, cPropertyChangeFrames),
+        MakeFunctor(&InterpolatingObject::SetValues, &VolumeInterpolatorThreaded, volume, cPropertyChangeFrames),
         this);
 }
 
@@ -481,14 +481,14 @@ void MicrophoneInputNode::SetActive(bool active)
   {
     mStopping.Set(cTrue);
     Z::gSound->Mixer.AddTask(
-        CreateFunctor(&InterpolatingObject::SetValues, &VolumeInterpolatorThreaded, 0.0f, cPropertyChangeFrames), this);
+        MakeFunctor(&InterpolatingObject::SetValues, &VolumeInterpolatorThreaded, 0.0f, cPropertyChangeFrames), this);
   }
   // Otherwise we are activating
   {
     // Make sure the stopping flag is reset
     mStopping.Set(cFalse);
     // Interpolate volume to its previous setting
-    Z::gSound->Mixer.AddTask(CreateFunctor(&InterpolatingObject::SetValues,
+    Z::gSound->Mixer.AddTask(MakeFunctor(&InterpolatingObject::SetValues,
                                            &VolumeInterpolatorThreaded,
                                            mVolume.Get(AudioThreads::MainThread),
                                            cPropertyChangeFrames),
@@ -1011,7 +1011,7 @@ void GranularSynthNode::Stop()
 
 void GranularSynthNode::SetSound(HandleOf<Sound> sound, float startTime, float stopTime)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&GranularSynthNode::SetSoundThreaded, this, sound, startTime, stopTime), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&GranularSynthNode::SetSoundThreaded, this, sound, startTime, stopTime), this);
 }
 
 float GranularSynthNode::GetGrainVolume()
@@ -1063,7 +1063,7 @@ int GranularSynthNode::GetGrainLength()
 
 void GranularSynthNode::SetGrainLength(int lengthMS)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&GranularSynthNode::SetGrainLengthThreaded, this, lengthMS), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&GranularSynthNode::SetGrainLengthThreaded, this, lengthMS), this);
 }
 
 int GranularSynthNode::GetGrainLengthVariance()
@@ -150,7 +150,7 @@ bool InterpolatingObject::Finished(HandleOf<SoundNode> nodeForEvent)
     {
       // Notify the external object that the interpolation is done
       Z::gSound->Mixer.AddTaskThreaded(
-          CreateFunctor(&SoundNode::DispatchEventFromMixThread, *nodeForEvent, Events::AudioInterpolationDone),
+          MakeFunctor(&SoundNode::DispatchEventFromMixThread, *nodeForEvent, Events::AudioInterpolationDone),
           nodeForEvent);
     }
 
@@ -34,12 +34,12 @@ ListenerNode::~ListenerNode()
 
 void ListenerNode::SetPositionData(ListenerWorldPositionInfo positionInfo)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&ListenerNode::SetPositionDataThreaded, this, positionInfo), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&ListenerNode::SetPositionDataThreaded, this, positionInfo), this);
 }
 
 void ListenerNode::SetActive(const bool active)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&ListenerNode::SetActiveThreaded, this, active), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&ListenerNode::SetActiveThreaded, this, active), this);
 }
 
 bool ListenerNode::GetActive()
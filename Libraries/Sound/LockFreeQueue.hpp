@@ -164,4 +164,84 @@ private:
   s32 WriteLock;
 };
 
+// Bounded Lock Free Queue
+
+// Fixed capacity ring buffer for a single writer thread and a single reader
+// thread. Values are stored in a buffer allocated up front so neither side
+// allocates or takes a lock. Capacity must be a power of two.
+template <typename T, unsigned Capacity>
+class BoundedLockFreeQueue
+{
+public:
+  BoundedLockFreeQueue() : WriteIndex(0), ReadIndex(0)
+  {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    Slots = new MaxAlignmentType[Capacity * cSlotCount];
+  }
+
+  ~BoundedLockFreeQueue()
+  {
+    Clear();
+    delete[] Slots;
+  }
+
+  // Copies the value onto the queue. Returns false if the queue is full.
+  bool Write(const T& object)
+  {
+    // Only the writer changes the write index
+    s64 writeIndex = WriteIndex;
+    if (writeIndex - AtomicLoad(&ReadIndex) == (s64)Capacity)
+      return false;
+
+    new (GetSlot(writeIndex)) T(object);
+    // Publish the value to the reader
+    AtomicStore(&WriteIndex, writeIndex + 1);
+    return true;
+  }
+
+  // Returns the next value without removing it, or null if the queue is empty.
+  // Only the reader can call this.
+  T* Peek()
+  {
+    s64 readIndex = ReadIndex;
+    if (readIndex == AtomicLoad(&WriteIndex))
+      return nullptr;
+
+    return GetSlot(readIndex);
+  }
+
+  // Destroys the value returned by Peek and gives its slot back to the writer
+  void Pop()
+  {
+    s64 readIndex = ReadIndex;
+    GetSlot(readIndex)->~T();
+    AtomicStore(&ReadIndex, readIndex + 1);
+  }
+
+  // This function assumes that nothing is currently writing to the queue
+  void Clear()
+  {
+    while (Peek())
+      Pop();
+  }
+
+private:
+  static const size_t cSlotCount = ZeroAlignCount(sizeof(T));
+  static const size_t cCacheLineSize = 64;
+
+  T* GetSlot(s64 index)
+  {
+    return (T*)&Slots[(index & (Capacity - 1)) * cSlotCount];
+  }
+
+  MaxAlignmentType* Slots;
+  // Only changed by the writer
+  volatile s64 WriteIndex;
+  // Keeps the indexes on separate cache lines so the writer and reader don't
+  // invalidate each other's cache line every time a value is written or read
+  byte Padding[cCacheLineSize];
+  // Only changed by the reader
+  volatile s64 ReadIndex;
+};
+
 } // namespace Zero
@@ -153,7 +153,7 @@ bool RecordingNode::GetOutputSamples(BufferType* outputBuffer,
       memset(outputBuffer->Data(), 0, sizeof(float) * outputBuffer->Size());
 
     Zero::Array<float>* buffer = new Zero::Array<float>(*outputBuffer);
-    Z::gSound->Mixer.AddTaskThreaded(CreateFunctor(&RecordingNode::WriteBuffer, this, buffer, numberOfChannels), this);
+    Z::gSound->Mixer.AddTaskThreaded(MakeFunctor(&RecordingNode::WriteBuffer, this, buffer, numberOfChannels), this);
   }
 
   return isThereOutput;
@@ -218,7 +218,7 @@ void SaveAudioNode::SetSaveAudio(bool save)
 {
   if (save)
   {
-    Z::gSound->Mixer.AddTask(CreateFunctor(&SaveAudioNode::ClearSavedAudioThreaded, this), this);
+    Z::gSound->Mixer.AddTask(MakeFunctor(&SaveAudioNode::ClearSavedAudioThreaded, this), this);
     mSaveData.Set(true, AudioThreads::MainThread);
   }
   else
@@ -237,7 +237,7 @@ void SaveAudioNode::StopPlaying()
 
 void SaveAudioNode::ClearSavedAudio()
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SaveAudioNode::ClearSavedAudioThreaded, this), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SaveAudioNode::ClearSavedAudioThreaded, this), this);
 }
 
 bool SaveAudioNode::GetOutputSamples(BufferType* outputBuffer,
@@ -28,7 +28,7 @@ SoundAsset::~SoundAsset()
 void SoundAsset::AddInstance(unsigned instanceID)
 {
   ++mInstanceReferenceCount;
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundAsset::OnAddInstanceThreaded, this, instanceID), nullptr);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundAsset::OnAddInstanceThreaded, this, instanceID), nullptr);
 }
 
 void SoundAsset::RemoveInstance(unsigned instanceID)
@@ -36,7 +36,7 @@ void SoundAsset::RemoveInstance(unsigned instanceID)
   ErrorIf(mInstanceReferenceCount == 0, "Trying to remove instance on an unreferenced sound asset");
 
   --mInstanceReferenceCount;
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundAsset::OnRemoveInstanceThreaded, this, instanceID), nullptr);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundAsset::OnRemoveInstanceThreaded, this, instanceID), nullptr);
 }
 
 // Decompressed Sound Asset
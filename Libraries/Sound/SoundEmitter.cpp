@@ -297,7 +297,7 @@ void SoundEmitter::SetPaused(bool pause)
 {
   mIsPaused = pause;
   EmitterNode* node = mEmitterObject;
-  Z::gSound->Mixer.AddTask(CreateFunctor(&EmitterNode::SetPausedThreaded, node, mIsPaused), node);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&EmitterNode::SetPausedThreaded, node, mIsPaused), node);
 }
 
 HandleOf<SoundInstance> SoundEmitter::PlayCue(SoundCue* cue)
@@ -348,7 +348,7 @@ void SoundEmitter::SetEmitAngle(float angleInDegrees)
 {
   mEmitAngle = Math::Clamp(angleInDegrees, 1.0f, 360.0f);
   EmitterNode* node = mEmitterObject;
-  Z::gSound->Mixer.AddTask(CreateFunctor(&EmitterNode::SetDirectionalAngleThreaded, node, mEmitAngle, mRearVolume),
+  Z::gSound->Mixer.AddTask(MakeFunctor(&EmitterNode::SetDirectionalAngleThreaded, node, mEmitAngle, mRearVolume),
                            node);
 }
 
@@ -361,7 +361,7 @@ void SoundEmitter::SetRearVolume(float minimumVolume)
 {
   mRearVolume = Math::Clamp(minimumVolume, 0.0f, cMaxVolumeValue);
   EmitterNode* node = mEmitterObject;
-  Z::gSound->Mixer.AddTask(CreateFunctor(&EmitterNode::SetDirectionalAngleThreaded, node, mEmitAngle, mRearVolume),
+  Z::gSound->Mixer.AddTask(MakeFunctor(&EmitterNode::SetDirectionalAngleThreaded, node, mEmitAngle, mRearVolume),
                            node);
 }
 
@@ -412,7 +412,7 @@ void SoundEmitter::Update(float dt)
       velocity *= (1.0f / dt);
 
     // Update the emitter node with new data
-    Z::gSound->Mixer.AddTask(CreateFunctor(&EmitterNode::SetPositionThreaded, node, newPosition, velocity), node);
+    Z::gSound->Mixer.AddTask(MakeFunctor(&EmitterNode::SetPositionThreaded, node, newPosition, velocity), node);
 
     // If the emitter has an attenuator, update its position
     if (mAttenuatorNode)
@@ -434,7 +434,7 @@ void SoundEmitter::Update(float dt)
     Vec3 y = Vec3(by.x, by.y, by.z);
     Vec3 forward = x.Cross(y);
 
-    Z::gSound->Mixer.AddTask(CreateFunctor(&EmitterNode::SetForwardDirectionThreaded, node, forward), node);
+    Z::gSound->Mixer.AddTask(MakeFunctor(&EmitterNode::SetForwardDirectionThreaded, node, forward), node);
   }
 
   // Check for SoundCue attenuator nodes with no input
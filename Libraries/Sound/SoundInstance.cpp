@@ -145,12 +145,12 @@ void MusicNotificationObject::ProcessAndNotify(float currentTime, SoundInstance*
 
       // Send notification
       Z::gSound->Mixer.AddTaskThreaded(
-          CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicBar), instance);
+          MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicBar), instance);
     }
 
     // Send notification
     Z::gSound->Mixer.AddTaskThreaded(
-        CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicBeat), instance);
+        MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicBeat), instance);
   }
 
   // Check for eighth notes
@@ -163,7 +163,7 @@ void MusicNotificationObject::ProcessAndNotify(float currentTime, SoundInstance*
 
     // Send notification for eighth note
     Z::gSound->Mixer.AddTaskThreaded(
-        CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicEighthNote), instance);
+        MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicEighthNote), instance);
 
     // Check for other note values
 
@@ -171,7 +171,7 @@ void MusicNotificationObject::ProcessAndNotify(float currentTime, SoundInstance*
     if (mEighthNoteCount % 2 == 0)
     {
       Z::gSound->Mixer.AddTaskThreaded(
-          CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicQuarterNote),
+          MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicQuarterNote),
           instance);
     }
 
@@ -179,14 +179,14 @@ void MusicNotificationObject::ProcessAndNotify(float currentTime, SoundInstance*
     if (mEighthNoteCount % 4 == 0)
     {
       Z::gSound->Mixer.AddTaskThreaded(
-          CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicHalfNote), instance);
+          MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicHalfNote), instance);
     }
 
     // Check for whole note
     if (mEighthNoteCount % 8 == 0)
     {
       Z::gSound->Mixer.AddTaskThreaded(
-          CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicWholeNote),
+          MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicWholeNote),
           instance);
     }
   }
@@ -210,18 +210,18 @@ void MusicNotificationObject::ResetBeats(float currentTime, SoundInstance* insta
     mEighthNoteCount = 0;
 
     Z::gSound->Mixer.AddTaskThreaded(
-        CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicBar), instance);
+        MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicBar), instance);
     Z::gSound->Mixer.AddTaskThreaded(
-        CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicBeat), instance);
+        MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicBeat), instance);
     Z::gSound->Mixer.AddTaskThreaded(
-        CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicWholeNote), instance);
+        MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicWholeNote), instance);
     Z::gSound->Mixer.AddTaskThreaded(
-        CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicEighthNote), instance);
+        MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicEighthNote), instance);
     Z::gSound->Mixer.AddTaskThreaded(
-        CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicQuarterNote),
+        MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicQuarterNote),
         instance);
     Z::gSound->Mixer.AddTaskThreaded(
-        CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicHalfNote), instance);
+        MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, instance, Events::MusicHalfNote), instance);
   }
   else
   {
@@ -333,7 +333,7 @@ void SoundInstance::SetVolume(float newVolume)
 
 void SoundInstance::InterpolateVolume(float newVolume, float interpolationTime)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::SetVolumeThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::SetVolumeThreaded,
                                          this,
                                          Math::Clamp(newVolume, 0.0f, cMaxVolumeValue),
                                          Math::Max(interpolationTime, 0.0f)),
@@ -352,7 +352,7 @@ void SoundInstance::SetDecibels(float decibels)
 
 void SoundInstance::InterpolateDecibels(float decibels, float interpolationTime)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::SetVolumeThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::SetVolumeThreaded,
                                          this,
                                          Math::Clamp(DecibelsToVolume(decibels), 0.0f, cMaxVolumeValue),
                                          Math::Max(interpolationTime, 0.0f)),
@@ -371,7 +371,7 @@ void SoundInstance::SetPitch(float newPitch)
 
 void SoundInstance::InterpolatePitch(float newPitch, float interpolationTime)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::SetPitchThreaded,
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::SetPitchThreaded,
                                          this,
                                          Math::Clamp(newPitch, cMinPitchValue, cMaxPitchValue),
                                          Math::Max(interpolationTime, 0.0f)),
@@ -393,7 +393,7 @@ void SoundInstance::InterpolateSemitones(float newSemitones, float interpolation
   if (interpolationTime == 0.0f)
     mPitchSemitones.Set(newSemitones, AudioThreads::MainThread);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::SetPitchThreaded, this, newSemitones, interpolationTime),
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::SetPitchThreaded, this, newSemitones, interpolationTime),
                            this);
 }
 
@@ -404,12 +404,12 @@ bool SoundInstance::GetPaused()
 
 void SoundInstance::SetPaused(bool pause)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::SetPausedThreaded, this, pause), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::SetPausedThreaded, this, pause), this);
 }
 
 void SoundInstance::Stop()
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::StopThreaded, this), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::StopThreaded, this), this);
 }
 
 bool SoundInstance::GetIsPlaying()
@@ -446,7 +446,7 @@ void SoundInstance::SetTime(float seconds)
 {
   // Make sure the asset isn't streaming
   if (!mAssetObject->mStreaming)
-    Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::SetTimeThreaded, this, seconds), this);
+    Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::SetTimeThreaded, this, seconds), this);
   else
     DoNotifyWarning("Time Set on Streaming Sound",
                     "You cannot set the time on a SoundInstance created from a "
@@ -482,7 +482,7 @@ void SoundInstance::SetEndTime(float seconds)
     frame = mAssetObject->mFrameCount - 1;
   }
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::mEndFrameThreaded, this, frame), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::mEndFrameThreaded, this, frame), this);
 }
 
 float SoundInstance::GetLoopStartTime()
@@ -506,7 +506,7 @@ void SoundInstance::SetLoopStartTime(float seconds)
     frame = 0;
   }
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::mLoopStartFrameThreaded, this, frame), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::mLoopStartFrameThreaded, this, frame), this);
 }
 
 float SoundInstance::GetLoopEndTime()
@@ -530,7 +530,7 @@ void SoundInstance::SetLoopEndTime(float seconds)
     frame = mAssetObject->mFrameCount;
   }
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::mLoopEndFrameThreaded, this, frame), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::mLoopEndFrameThreaded, this, frame), this);
 }
 
 float SoundInstance::GetLoopTailTime()
@@ -543,7 +543,7 @@ void SoundInstance::SetLoopTailTime(float seconds)
   mLoopTailTime = Math::Clamp(seconds, 0.0f, cMaxLoopTailTime);
 
   Z::gSound->Mixer.AddTask(
-      CreateFunctor(&SoundInstance::mLoopTailFramesThreaded, this, (int)(mLoopTailTime * cSystemSampleRate)), this);
+      MakeFunctor(&SoundInstance::mLoopTailFramesThreaded, this, (int)(mLoopTailTime * cSystemSampleRate)), this);
 }
 
 bool SoundInstance::GetCrossFadeLoopTail()
@@ -566,12 +566,12 @@ float SoundInstance::GetBeatsPerMinute()
 
 void SoundInstance::SetBeatsPerMinute(float beats)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::SetBeatsPerMinuteThreaded, this, beats), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::SetBeatsPerMinuteThreaded, this, beats), this);
 }
 
 void SoundInstance::SetTimeSignature(float beats, float noteType)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::SetTimeSignatureThreaded, this, beats, noteType), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::SetTimeSignatureThreaded, this, beats, noteType), this);
 }
 
 float SoundInstance::GetCustomEventTime()
@@ -867,7 +867,7 @@ void SoundInstance::AddSamplesToBufferThreaded(BufferType* buffer, unsigned outp
         {
           mVolume.Set(volume, AudioThreads::MixThread);
 
-          Z::gSound->Mixer.AddTaskThreaded(CreateFunctor(&SoundInstance::DispatchEventFromMixThread,
+          Z::gSound->Mixer.AddTaskThreaded(MakeFunctor(&SoundInstance::DispatchEventFromMixThread,
                                                          (SoundNode*)this,
                                                          Events::AudioInterpolationDone),
                                            this);
@@ -929,7 +929,7 @@ void SoundInstance::LoopThreaded()
   }
 
   Z::gSound->Mixer.AddTaskThreaded(
-      CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, this, Events::SoundLooped), this);
+      MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, this, Events::SoundLooped), this);
 
   // Reset variables
   mFrameIndexThreaded = mLoopStartFrameThreaded;
@@ -975,11 +975,11 @@ void SoundInstance::FinishedCleanUpThreaded()
     tag->RemoveInstanceThreaded(this);
 
   Z::gSound->Mixer.AddTaskThreaded(
-      CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, this, Events::SoundStopped), this);
-  Z::gSound->Mixer.AddTaskThreaded(CreateFunctor(&SoundInstance::RemoveFromAllTagsThreaded, this), this);
-  Z::gSound->Mixer.AddTaskThreaded(CreateFunctor(&SoundNode::RemoveAllOutputs, (SoundNode*)this), this);
+      MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, this, Events::SoundStopped), this);
+  Z::gSound->Mixer.AddTaskThreaded(MakeFunctor(&SoundInstance::RemoveFromAllTagsThreaded, this), this);
+  Z::gSound->Mixer.AddTaskThreaded(MakeFunctor(&SoundNode::RemoveAllOutputs, (SoundNode*)this), this);
 
-  Z::gSound->Mixer.AddTaskThreaded(CreateFunctor(&SoundAsset::RemoveInstance, *mAssetObject, cNodeID), this);
+  Z::gSound->Mixer.AddTaskThreaded(MakeFunctor(&SoundAsset::RemoveInstance, *mAssetObject, cNodeID), this);
 }
 
 bool SoundInstance::BelowMinimumVolumeThreaded(unsigned frames)
@@ -1029,7 +1029,7 @@ void SoundInstance::MusicNotificationsThreaded()
     mCustomNotifySent.Set(true, AudioThreads::MixThread);
 
     Z::gSound->Mixer.AddTaskThreaded(
-        CreateFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, this, Events::MusicCustomTime), this);
+        MakeFunctor(&SoundInstance::DispatchInstanceEventFromMixThread, this, Events::MusicCustomTime), this);
   }
 
   MusicNotify.ProcessAndNotify((float)mCurrentTime.Get(AudioThreads::MixThread), this);
@@ -1044,7 +1044,7 @@ void SoundInstance::DisconnectThisAndAllInputs()
 {
   SoundNode::DisconnectThisAndAllInputs();
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundInstance::FinishedCleanUpThreaded, this), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundInstance::FinishedCleanUpThreaded, this), this);
 }
 
 void SoundInstance::SetPausedThreaded(bool pause)
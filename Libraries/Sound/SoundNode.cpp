@@ -89,7 +89,7 @@ void SoundNode::AddInputNode(SoundNode* newNode)
   // Add this node to the new node's outputs
   newNode->mOutputs[AudioThreads::MainThread].PushBack(this);
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundNode::AddInputNodeThreaded, this, handle), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundNode::AddInputNodeThreaded, this, handle), this);
 }
 
 void SoundNode::RemoveInputNode(SoundNode* node)
@@ -109,7 +109,7 @@ void SoundNode::RemoveInputNode(SoundNode* node)
   // Remove this node from the input node's output list
   node->mOutputs[AudioThreads::MainThread].EraseValue(HandleOf<SoundNode>(this));
 
-  Z::gSound->Mixer.AddTask(CreateFunctor(&SoundNode::RemoveInputNodeThreaded, this, handle), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&SoundNode::RemoveInputNodeThreaded, this, handle), this);
 
   // If there are no more inputs and this node should collapse, call the
   // collapse function
@@ -386,9 +386,9 @@ bool SoundNode::Evaluate(BufferType* outputBuffer, const unsigned numberOfChanne
     if (!message.Empty())
     {
       String title = "Incorrect SoundNode Structure";
-      Z::gSound->Mixer.AddTaskThreaded(CreateFunctor(&SoundNode::WarningFromMixThread, this, title, message), this);
+      Z::gSound->Mixer.AddTaskThreaded(MakeFunctor(&SoundNode::WarningFromMixThread, this, title, message), this);
 
-      Z::gSound->Mixer.AddTaskThreaded(CreateFunctor(&SoundNode::RemoveAndAttachInputsToOutputs, this), this);
+      Z::gSound->Mixer.AddTaskThreaded(MakeFunctor(&SoundNode::RemoveAndAttachInputsToOutputs, this), this);
 
       return false;
     }
@@ -648,7 +648,7 @@ bool CombineAndPauseNode::GetPaused()
 
 void CombineAndPauseNode::SetPaused(const bool paused)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&CombineAndPauseNode::SetPausedThreaded, this, paused), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&CombineAndPauseNode::SetPausedThreaded, this, paused), this);
 }
 
 bool CombineAndPauseNode::GetMuted()
@@ -658,7 +658,7 @@ bool CombineAndPauseNode::GetMuted()
 
 void CombineAndPauseNode::SetMuted(bool muted)
 {
-  Z::gSound->Mixer.AddTask(CreateFunctor(&CombineAndPauseNode::SetMutedThreaded, this, muted), this);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&CombineAndPauseNode::SetMutedThreaded, this, muted), this);
 }
 
 bool CombineAndPauseNode::GetOutputSamples(BufferType* outputBuffer,
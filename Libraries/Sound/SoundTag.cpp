@@ -97,7 +97,7 @@ void TagObject::SetVolume(float volume, float time)
   mVolume.Set(volume, AudioThreads::MainThread);
 
   // TODO -- could this crash because it's not saving a handle?
-  Z::gSound->Mixer.AddTask(CreateFunctor(&TagObject::SetVolumeThreaded, this, volume, time), nullptr);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&TagObject::SetVolumeThreaded, this, volume, time), nullptr);
 }
 
 float TagObject::GetEQBandGain(EqualizerBands::Enum whichBand)
@@ -110,7 +110,7 @@ void TagObject::SetEQBandGain(EqualizerBands::Enum whichBand, float gain)
   mEqualizerGainValues[whichBand] = gain;
 
   // TODO -- could this crash because it's not saving a handle?
-  Z::gSound->Mixer.AddTask(CreateFunctor(&TagObject::SetEQBandGainThreaded, this, whichBand, gain), nullptr);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&TagObject::SetEQBandGainThreaded, this, whichBand, gain), nullptr);
 }
 
 void TagObject::InterpolateEQBandsThreaded(float* values, float timeToInterpolate)
@@ -138,7 +138,7 @@ void TagObject::SetCompressorThresholdDb(float decibels)
   mCompressorThreshold = decibels;
 
   // TODO no handle
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetThreshold, &CompressorObjectThreaded, decibels),
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetThreshold, &CompressorObjectThreaded, decibels),
                            nullptr);
 }
 
@@ -152,7 +152,7 @@ void TagObject::SetCompressorAttackMs(float milliseconds)
   mCompressorAttackMs = milliseconds;
 
   // TODO no handle
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetAttackMSec, &CompressorObjectThreaded, milliseconds),
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetAttackMSec, &CompressorObjectThreaded, milliseconds),
                            nullptr);
 }
 
@@ -166,7 +166,7 @@ void TagObject::SetCompressorReleaseMs(float milliseconds)
   mCompressorReleaseMs = milliseconds;
 
   // TODO no handle
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetReleaseMSec, &CompressorObjectThreaded, milliseconds),
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetReleaseMSec, &CompressorObjectThreaded, milliseconds),
                            nullptr);
 }
 
@@ -180,7 +180,7 @@ void TagObject::SetCompressorRatio(float ratio)
   mCompressorRatio = ratio;
 
   // TODO no handle
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetRatio, &CompressorObjectThreaded, ratio), nullptr);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetRatio, &CompressorObjectThreaded, ratio), nullptr);
 }
 
 float TagObject::GetCompresorKneeWidth()
@@ -193,7 +193,7 @@ void TagObject::SetCompressorKneeWidth(float knee)
   mCompressorKnee = knee;
 
   // TODO no handle
-  Z::gSound->Mixer.AddTask(CreateFunctor(&DynamicsProcessor::SetKneeWidth, &CompressorObjectThreaded, knee), nullptr);
+  Z::gSound->Mixer.AddTask(MakeFunctor(&DynamicsProcessor::SetKneeWidth, &CompressorObjectThreaded, knee), nullptr);
 }
 
 void TagObject::RemoveTag()
@@ -461,7 +461,7 @@ void SoundTag::TagSound(HandleOf<SoundInstance>& instanceHandle)
 
   // Add the instance to the tag object
   if (tag)
-    Z::gSound->Mixer.AddTask(CreateFunctor(&TagObject::AddInstanceThreaded, tag, instance), nullptr);
+    Z::gSound->Mixer.AddTask(MakeFunctor(&TagObject::AddInstanceThreaded, tag, instance), nullptr);
 
   SoundEvent event;
   DispatchEvent(Events::AddedInstanceToTag, &event);
@@ -481,7 +481,7 @@ void SoundTag::UnTagSound(HandleOf<SoundInstance>& instanceHandle)
 
   // Remove it from the tag object
   if (mTagObject)
-    Z::gSound->Mixer.AddTask(CreateFunctor(&TagObject::RemoveInstanceThreaded, *mTagObject, instance), nullptr);
+    Z::gSound->Mixer.AddTask(MakeFunctor(&TagObject::RemoveInstanceThreaded, *mTagObject, instance), nullptr);
 
   if (SoundInstanceList.Empty())
   {
@@ -649,7 +649,7 @@ void SoundTag::EQSetAllBands(
     values[EqualizerBands::Above5000] = Math::Clamp(above5000Hz, 0.0f, cMaxVolumeValue);
 
     Z::gSound->Mixer.AddTask(
-        CreateFunctor(&TagObject::InterpolateEQBandsThreaded, *mTagObject, values, timeToInterpolate), nullptr);
+        MakeFunctor(&TagObject::InterpolateEQBandsThreaded, *mTagObject, values, timeToInterpolate), nullptr);
   }
 }
 
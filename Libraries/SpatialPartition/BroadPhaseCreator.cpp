@@ -27,9 +27,11 @@ BroadPhaseLibrary::BroadPhaseLibrary()
   RegisterBroadPhase(BoundingBoxBroadPhase, DynamicBit | StaticBit);
   RegisterBroadPhase(BoundingSphereBroadPhase, DynamicBit | StaticBit);
   RegisterBroadPhase(StaticAabbTreeBroadPhase, StaticBit);
+  RegisterBroadPhase(FlatAabbTreeBroadPhase, StaticBit);
   RegisterBroadPhase(SapBroadPhase, DynamicBit);
   // RegisterBroadPhase(MultiSap, dynamicOnly);
   RegisterBroadPhase(DynamicAabbTreeBroadPhase, DynamicBit | StaticBit);
+  RegisterBroadPhase(RefitDynamicAabbTreeBroadPhase, DynamicBit);
   RegisterBroadPhase(AvlDynamicAabbTreeBroadPhase, DynamicBit | StaticBit);
 }
 
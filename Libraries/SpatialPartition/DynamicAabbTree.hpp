@@ -63,6 +63,8 @@ public:
   typedef DynamicAabbTree<ClientDataType> TreeType;
   typedef BaseDynamicAabbTree<DynamicTreePolicy<ClientDataType>> BaseType;
   typedef typename BaseType::PolicyTypeDef MyPolicyType;
+  typedef typename BaseType::NodeType NodeType;
+  typedef typename BaseType::DataType DataType;
 
   using BaseType::mRoot;
 
@@ -74,7 +76,30 @@ public:
   ///(Called in Query)
   void Rebalance(uint iterations);
 
+  /// Updates a leaf's fat aabb in place without reinserting it. The leaf's
+  /// ancestors are not resized until Refit is called, so the tree must not be
+  /// queried in between.
+  void MoveProxy(BroadPhaseProxy& proxy, DataType& data);
+  /// Resizes the ancestors of every leaf moved since the last refit. Walks up
+  /// from each leaf and stops once an ancestor's aabb no longer changes.
+  void Refit();
+
+  /// The summed surface area of the internal nodes relative to the root's
+  /// surface area. This is the expected number of internal nodes visited by
+  /// a random ray, so it grows as refitting degrades the tree.
+  real ComputeCost();
+  /// Throws away the internal nodes and builds the tree again top-down
+  /// by minimizing the surface area heuristic.
+  void Rebuild();
+
 private:
+  NodeType* BuildTopDown(Array<NodeType*>& leafNodes);
+
+  /// The leaves moved since the last refit.
+  Array<NodeType*> mMovedLeaves;
+  /// Scratch space for walking the tree.
+  Array<NodeType*> mNodeStack;
+
   /// Represents what pathway to take when rebalancing the tree.
   /// The path represents taking the left or right child at a level
   /// based upon the bit #.
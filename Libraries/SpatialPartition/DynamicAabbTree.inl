@@ -180,4 +180,136 @@ void DynamicAabbTree<ClientDataType>::Rebalance(uint iterations)
   }
 }
 
+template <typename ClientDataType>
+void DynamicAabbTree<ClientDataType>::MoveProxy(BroadPhaseProxy& proxy, DataType& data)
+{
+  Aabb aabb = data.mAabb;
+  if (!aabb.Valid())
+  {
+    Error("Invalid Aabb inserted");
+
+    // We got the assert (good) but we don't want to keep getting it every frame
+    aabb.AttemptToCorrectInvalid();
+  }
+
+  NodeType* node = static_cast<NodeType*>(proxy.ToVoidPointer());
+  node->mClientData = data.mClientData;
+
+  // our old Aabb contained our new one, so nothing above us has to change
+  if (node->mAabb.ContainsPoint(aabb.mMin) && node->mAabb.ContainsPoint(aabb.mMax))
+    return;
+
+  Vec3 halfExtents = aabb.GetHalfExtents();
+  halfExtents = Math::Min(halfExtents + BaseDynamicTreeInternal::cAabbFatFactor,
+                          halfExtents * BaseDynamicTreeInternal::cAabbFatScaleFactor);
+  node->mAabb.SetCenterAndHalfExtents(aabb.GetCenter(), halfExtents);
+  mMovedLeaves.PushBack(node);
+}
+
+template <typename ClientDataType>
+void DynamicAabbTree<ClientDataType>::Refit()
+{
+  for (uint i = 0; i < mMovedLeaves.Size(); ++i)
+  {
+    NodeType* parent = mMovedLeaves[i]->mParent;
+    while (parent != nullptr)
+    {
+      Aabb oldAabb = parent->mAabb;
+      parent->mAabb = parent->mChild1->mAabb.Combined(parent->mChild2->mAabb);
+
+      // Another moved leaf (or nothing) changed this node, so everything
+      // above it is already correct
+      if (memcmp(&oldAabb, &parent->mAabb, sizeof(Aabb)) == 0)
+        break;
+
+      parent = parent->mParent;
+    }
+  }
+  mMovedLeaves.Clear();
+}
+
+template <typename ClientDataType>
+real DynamicAabbTree<ClientDataType>::ComputeCost()
+{
+  if (mRoot == nullptr || mRoot->IsLeaf())
+    return real(0.0);
+
+  real internalArea = real(0.0);
+  mNodeStack.Clear();
+  mNodeStack.PushBack(mRoot);
+  while (!mNodeStack.Empty())
+  {
+    NodeType* node = mNodeStack.Back();
+    mNodeStack.PopBack();
+    if (node->IsLeaf())
+      continue;
+
+    internalArea += node->mAabb.GetSurfaceArea();
+    mNodeStack.PushBack(node->mChild1);
+    mNodeStack.PushBack(node->mChild2);
+  }
+
+  real rootArea = Math::Max(mRoot->mAabb.GetSurfaceArea(), Math::PositiveMin());
+  return internalArea / rootArea;
+}
+
+template <typename ClientDataType>
+void DynamicAabbTree<ClientDataType>::Rebuild()
+{
+  // Any pending moves have to be applied first since the internal nodes
+  // that would be refit are about to be deleted
+  Refit();
+
+  if (mRoot == nullptr)
+    return;
+
+  // Collect the leaves while deleting the internal nodes
+  Array<NodeType*> leafNodes;
+  leafNodes.Reserve(this->GetTotalProxyCount());
+  mNodeStack.Clear();
+  mNodeStack.PushBack(mRoot);
+  while (!mNodeStack.Empty())
+  {
+    NodeType* node = mNodeStack.Back();
+    mNodeStack.PopBack();
+    if (node->IsLeaf())
+    {
+      leafNodes.PushBack(node);
+      continue;
+    }
+
+    mNodeStack.PushBack(node->mChild1);
+    mNodeStack.PushBack(node->mChild2);
+    MyPolicyType::DeleteNode(node);
+  }
+
+  mRoot = BuildTopDown(leafNodes);
+  mRoot->mParent = nullptr;
+}
+
+template <typename ClientDataType>
+typename DynamicAabbTree<ClientDataType>::NodeType*
+DynamicAabbTree<ClientDataType>::BuildTopDown(Array<NodeType*>& leafNodes)
+{
+  if (leafNodes.Size() == 1)
+    return leafNodes[0];
+
+  // The partition needs at least 3 objects to pick a split
+  uint separationIndex = 1;
+  if (leafNodes.Size() > 2)
+    separationIndex = MinimizeSurfaceAreaSumNodes<NodeType>(leafNodes);
+
+  Array<NodeType*> left, right;
+  left.Assign(leafNodes.Begin(), leafNodes.Begin() + separationIndex);
+  right.Assign(leafNodes.Begin() + separationIndex, leafNodes.End());
+
+  NodeType* node = new NodeType();
+  node->mChild1 = BuildTopDown(left);
+  node->mChild2 = BuildTopDown(right);
+  node->mChild1->mParent = node;
+  node->mChild2->mParent = node;
+  node->mAabb = node->mChild1->mAabb.Combined(node->mChild2->mAabb);
+  return node;
+}
+
 } // namespace Zero
@@ -15,4 +15,48 @@ DynamicAabbTreeBroadPhase::~DynamicAabbTreeBroadPhase()
 {
 }
 
+ZilchDefineType(RefitDynamicAabbTreeBroadPhase, builder, type)
+{
+}
+
+RefitDynamicAabbTreeBroadPhase::RefitDynamicAabbTreeBroadPhase()
+{
+  mRebuildRatio = real(1.5);
+  mRebuiltCost = real(0.0);
+}
+
+void RefitDynamicAabbTreeBroadPhase::UpdateProxy(BroadPhaseProxy& proxy, BroadPhaseData& data)
+{
+  mTree.MoveProxy(proxy, data);
+  mTree.Refit();
+}
+
+void RefitDynamicAabbTreeBroadPhase::UpdateProxies(BroadPhaseObjectArray& objects)
+{
+  // Move every leaf first so that ancestors shared by several moving
+  // leaves are only resized once
+  BroadPhaseObjectArray::range range = objects.All();
+  for (; !range.Empty(); range.PopFront())
+  {
+    BroadPhaseObject& obj = range.Front();
+    mTree.MoveProxy(*obj.mProxy, obj.mData);
+  }
+  mTree.Refit();
+}
+
+void RefitDynamicAabbTreeBroadPhase::RegisterCollisions()
+{
+  // Check the quality once a frame (before the self query that benefits
+  // the most from a good tree) rather than rebalancing a few nodes
+  real cost = mTree.ComputeCost();
+  if (mRebuiltCost == real(0.0) || cost > mRebuiltCost * mRebuildRatio)
+  {
+    mTree.Rebuild();
+    mRebuiltCost = mTree.ComputeCost();
+  }
+
+  mPairs.Clear();
+  FullTreeQuery();
+}
+
 } // namespace Zero
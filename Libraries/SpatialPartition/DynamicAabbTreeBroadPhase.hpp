@@ -19,4 +19,33 @@ public:
   ~DynamicAabbTreeBroadPhase();
 };
 
+/// A DynamicAabbTreeBroadPhase for scenes where most objects move every frame.
+/// Instead of reinserting leaves that leave their fat aabb, the leaves are
+/// resized in place and the tree is refit bottom-up once per batch of updates.
+/// Refitting degrades the tree over time, so once its surface area cost grows
+/// past mRebuildRatio times the cost after the last rebuild the whole tree is
+/// rebuilt with the surface area heuristic.
+class RefitDynamicAabbTreeBroadPhase : public DynamicAabbTreeBroadPhase
+{
+public:
+  ZilchDeclareType(RefitDynamicAabbTreeBroadPhase, TypeCopyMode::ReferenceType);
+
+  RefitDynamicAabbTreeBroadPhase();
+
+  void UpdateProxy(BroadPhaseProxy& proxy, BroadPhaseData& data) override;
+  void UpdateProxies(BroadPhaseObjectArray& objects) override;
+
+  void RegisterCollisions() override;
+
+  /// How much worse the tree's cost can get before it is rebuilt.
+  real mRebuildRatio;
+
+private:
+  /// The cost of the tree right after it was last rebuilt.
+  /// Zero means the tree has not been rebuilt yet. Proxies inserted since
+  /// then also raise the cost, so large batches of new proxies are caught by
+  /// the same check.
+  real mRebuiltCost;
+};
+
 } // namespace Zero
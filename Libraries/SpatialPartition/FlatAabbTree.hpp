@@ -0,0 +1,242 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+/// A node of an aabb tree that has been baked into an array. Nodes are stored
+/// in depth-first order so the first child of an internal node is always the
+/// node directly after it, which keeps a traversal walking forward in memory.
+struct FlatAabbNode
+{
+  static const uint cLeaf = (uint)-1;
+
+  bool IsLeaf() const
+  {
+    return mSecondChild == cLeaf;
+  }
+
+  /// Must be the first member (slab tests load the bounds 4 floats at a time
+  /// and rely on the members after mMax to keep the last load in bounds).
+  Aabb mAabb;
+  /// The index of the second child for internal nodes, cLeaf for leaves.
+  uint mSecondChild;
+  /// The index of a leaf's client data.
+  uint mLeafIndex;
+};
+
+static_assert(sizeof(FlatAabbNode) == 32, "FlatAabbNode should fill half of a cache line.");
+
+/// Direction components smaller than this are clamped before being inverted
+/// so that the slab tests never multiply zero by infinity.
+const real cFlatTreeMinDirection = real(1e-20);
+
+/// Computes the inverse of a cast direction for the slab tests.
+inline Vec3 FlatTreeInverseDirection(Vec3Param direction)
+{
+  Vec3 inverse;
+  for (uint axis = 0; axis < 3; ++axis)
+  {
+    real value = direction[axis];
+    if (Math::Abs(value) < cFlatTreeMinDirection)
+      value = (value < real(0.0)) ? -cFlatTreeMinDirection : cFlatTreeMinDirection;
+    inverse[axis] = real(1.0) / value;
+  }
+  return inverse;
+}
+
+/// Tests the parametric range [0, maxTime] of a cast against the slabs of an
+/// aabb. Tests all three axes at once with SSE on SSE2 targets (ZeroSimdSse2).
+struct FlatTreeSlabTest
+{
+  FlatTreeSlabTest(Vec3Param start, Vec3Param direction, real maxTime)
+  {
+    mStart = start;
+    mInverseDirection = FlatTreeInverseDirection(direction);
+    mMaxTime = maxTime;
+#if defined(ZeroSimdSse2)
+    mSimStart = Math::Simd::Set4(mStart.x, mStart.y, mStart.z, real(0.0));
+    mSimInverseDirection = Math::Simd::Set4(mInverseDirection.x, mInverseDirection.y, mInverseDirection.z, real(0.0));
+#endif
+  }
+
+  bool Overlap(const Aabb& aabb)
+  {
+#if defined(ZeroSimdSse2)
+    // The 4th lane of each load is the next member and is ignored below
+    Math::Simd::SimVec minTimes = Math::Simd::Subtract(Math::Simd::UnAlignedLoad(aabb.mMin.array), mSimStart);
+    Math::Simd::SimVec maxTimes = Math::Simd::Subtract(Math::Simd::UnAlignedLoad(aabb.mMax.array), mSimStart);
+    minTimes = Math::Simd::Multiply(minTimes, mSimInverseDirection);
+    maxTimes = Math::Simd::Multiply(maxTimes, mSimInverseDirection);
+
+    real nearTimes[4];
+    real farTimes[4];
+    Math::Simd::UnAlignedStore(Math::Simd::Min(minTimes, maxTimes), nearTimes);
+    Math::Simd::UnAlignedStore(Math::Simd::Max(minTimes, maxTimes), farTimes);
+
+    real entry = Math::Max(Math::Max(nearTimes[0], nearTimes[1]), Math::Max(nearTimes[2], real(0.0)));
+    real exit = Math::Min(Math::Min(farTimes[0], farTimes[1]), Math::Min(farTimes[2], mMaxTime));
+    return entry <= exit;
+#else
+    real entry = real(0.0);
+    real exit = mMaxTime;
+    for (uint axis = 0; axis < 3; ++axis)
+    {
+      real t1 = (aabb.mMin[axis] - mStart[axis]) * mInverseDirection[axis];
+      real t2 = (aabb.mMax[axis] - mStart[axis]) * mInverseDirection[axis];
+      entry = Math::Max(entry, Math::Min(t1, t2));
+      exit = Math::Min(exit, Math::Max(t1, t2));
+    }
+    return entry <= exit;
+#endif
+  }
+
+#if defined(ZeroSimdSse2)
+  Math::Simd::SimVec mSimStart;
+  Math::Simd::SimVec mSimInverseDirection;
+#endif
+  Vec3 mStart;
+  Vec3 mInverseDirection;
+  real mMaxTime;
+};
+
+/// How a query tests the nodes of a flattened tree. By default this uses the
+/// same BroadPhasePolicy as the pointer based trees.
+template <typename QueryType>
+struct FlatTreePolicy
+{
+  FlatTreePolicy(const QueryType& queryObj) : mQueryObj(queryObj)
+  {
+  }
+
+  bool Overlap(Aabb& aabb)
+  {
+    return mPolicy.Overlap(mQueryObj, aabb);
+  }
+
+  QueryType mQueryObj;
+  BroadPhasePolicy<QueryType, Aabb> mPolicy;
+};
+
+/// Rays use a slab test with a precomputed inverse direction.
+template <>
+struct FlatTreePolicy<Ray>
+{
+  FlatTreePolicy(const Ray& ray) : mSlabTest(ray.Start, ray.Direction, Math::PositiveMax())
+  {
+  }
+
+  bool Overlap(Aabb& aabb)
+  {
+    return mSlabTest.Overlap(aabb);
+  }
+
+  FlatTreeSlabTest mSlabTest;
+};
+
+/// Segments use a slab test limited to the length of the segment.
+template <>
+struct FlatTreePolicy<Segment>
+{
+  FlatTreePolicy(const Segment& segment) : mSlabTest(segment.Start, segment.End - segment.Start, real(1.0))
+  {
+  }
+
+  bool Overlap(Aabb& aabb)
+  {
+    return mSlabTest.Overlap(aabb);
+  }
+
+  FlatTreeSlabTest mSlabTest;
+};
+
+/// A range for iterating through the leaves of a flattened aabb tree that
+/// overlap the query object. The scratch buffer is used as the traversal
+/// stack and must be able to hold the depth of the tree plus one.
+/// Note: this range is invalidated if the tree is rebuilt.
+template <typename ClientDataType, typename QueryType, typename ArrayType>
+struct FlatTreeRange
+{
+  typedef Array<FlatAabbNode> NodeArray;
+  typedef Array<ClientDataType> LeafArray;
+
+  FlatTreeRange(ArrayType* scratchBuffer, NodeArray* nodes, LeafArray* leaves, const QueryType& queryObj) :
+      mPolicy(queryObj),
+      mNodes(nodes),
+      mLeaves(leaves),
+      mStack(scratchBuffer)
+  {
+    mStack->Clear();
+    if (!mNodes->Empty())
+      mStack->PushBack(0);
+    mCurrentLeaf = FlatAabbNode::cLeaf;
+    SkipDead();
+  }
+
+  void PopFront()
+  {
+    SkipDead();
+  }
+
+  ClientDataType& Front()
+  {
+    ErrorIf(Empty(), "Cannot get the front of an empty range.");
+    return (*mLeaves)[mCurrentLeaf];
+  }
+
+  bool Empty() const
+  {
+    return mCurrentLeaf == FlatAabbNode::cLeaf;
+  }
+
+  void SkipDead()
+  {
+    mCurrentLeaf = FlatAabbNode::cLeaf;
+
+    NodeArray& nodes = *mNodes;
+    while (!mStack->Empty())
+    {
+      uint index = mStack->Back();
+      mStack->PopBack();
+
+      // Walk down the first children (the next node in the array) only
+      // pushing the second children that still need to be visited
+      while (true)
+      {
+        FlatAabbNode& node = nodes[index];
+        if (!mPolicy.Overlap(node.mAabb))
+          break;
+
+        if (node.IsLeaf())
+        {
+          mCurrentLeaf = node.mLeafIndex;
+          return;
+        }
+
+        mStack->PushBack(node.mSecondChild);
+        ++index;
+      }
+    }
+  }
+
+  FlatTreePolicy<QueryType> mPolicy;
+  NodeArray* mNodes;
+  LeafArray* mLeaves;
+  ArrayType* mStack;
+  uint mCurrentLeaf;
+};
+
+// Same as forRangeBroadphaseTree, but for a tree that has been flattened. The
+// traversal stack only needs to be as deep as the tree so it is allocated on
+// the stack. This range cannot be used multiple times in the same scope.
+#define forRangeFlatBroadphaseTree(treeType, tree, queryType, queryObj)                                                \
+  Array<uint, LocalStackAllocator> flatNodeStack_;                                                                     \
+  uint flatStackSize_ = tree.GetFlatStackSize();                                                                       \
+  LocalStackAllocator flatStackAllocator_(alloca(flatStackSize_ * sizeof(uint)));                                      \
+  flatNodeStack_.SetAllocator(flatStackAllocator_);                                                                    \
+  flatNodeStack_.Reserve(flatStackSize_);                                                                              \
+  typedef decltype(tree.QueryFlat(queryObj, flatNodeStack_)) _RangeType;                                               \
+  _RangeType range = tree.QueryFlat(queryObj, flatNodeStack_);                                                         \
+  for (; !range.Empty(); range.PopFront())
+
+} // namespace Zero
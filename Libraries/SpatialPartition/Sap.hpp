@@ -9,6 +9,10 @@ namespace Zero
 /// Sap has two main failing points: If a large number of objects cluster on
 /// one axis, Sap starts performing poorly. The other issue is Sap is
 /// fairly inefficient when it comes to any form of casting.
+/// When a large fraction of the boxes are created or updated at once (such as
+/// many objects spawning or teleporting), the changed endpoints are radix
+/// sorted and merged into each axis and the pairs are regenerated with one
+/// sweep instead of shifting each endpoint into place.
 template <typename ClientDataType>
 class Sap
 {
@@ -34,6 +38,12 @@ public:
   void UpdateProxy(BroadPhaseProxy& proxy, DataType& data);
   void UpdateProxies(DataObjectArray& objects);
 
+  /// UpdateProxies takes the batch path when at least this fraction of the
+  /// live boxes are being updated. 0 always batches, anything above 1 never
+  /// does (the incremental path, which is the default).
+  void SetBatchRatio(real ratio);
+  real GetBatchRatio() const;
+
   /// A range for performing a re-entrant cast into Sap. A policy must be
   /// provided that tells the range how to collide an Aabb with a QueryType
   /// through a function called Overlap. Most implementations should just
@@ -63,6 +73,7 @@ private:
   void Setup();
   void MakeSentinel();
   uint GetNewBoxIndex();
+  uint GetLiveBoxCount() const;
 
   // helpers
 
@@ -76,6 +87,21 @@ private:
 
   // batch operations
 
+  /// Updates every object by removing its pairs and endpoints then sorting
+  /// the endpoints back in with BatchSort.
+  void BatchUpdateProxies(DataObjectArray& objects);
+  /// Returns the axis the given boxes are spread out the most on. Sweeping
+  /// that axis keeps the set of open boxes (and the pair tests) smallest.
+  uint ChooseSweepAxis(Array<uint>& boxes);
+  /// Calls BatchPairAdd on an axis chosen at runtime.
+  void SweepPairAdd(uint axis, uint startIndex);
+  /// Calls BatchPairRemove on an axis chosen at runtime.
+  void SweepPairRemove(uint axis);
+  /// Pushes the min and max endpoints of each box on the given axis.
+  template <uint Axis>
+  void GatherEndPoints(Array<uint>& boxes, EndPointArray& endpoints);
+  /// Stable LSD radix sort of the endpoints by value (smallest first).
+  void RadixSort(EndPointArray& endpoints);
   template <uint Axis>
   void RemoveEndPoints(uint boxNum);
   void InsertPair(uint box1Index, uint box2Index);
@@ -89,6 +115,7 @@ private:
   template <uint Axis>
   void RemoveWithSet(BoxSet& boxSet, uint boxIndex);
   /// Sorts the new endpoints into the old endpoints. Does not add pairs.
+  /// The new endpoints are radix sorted and then merged from the back.
   /// Returns the last position that was iterated to for sorting. Call for each
   /// axis.
   template <uint Axis>
@@ -152,6 +179,13 @@ private:
   Array<uint> mOpenIndices;
   // Where the endpoints are stored for each axis.
   EndPointArray mAxes[3];
+
+  // The fraction of live boxes an update needs to use the batch path.
+  real mBatchRatio;
+  // Scratch space for the batch operations so they don't allocate every call.
+  Array<uint> mBatchBoxes;
+  EndPointArray mBatchEndPoints;
+  EndPointArray mSortScratch;
 };
 
 } // namespace Zero
@@ -5,6 +5,24 @@ namespace SapInternal
 
 const uintptr_t cSentinelPattern = (uintptr_t)0xffdeadff;
 
+// The radix sort looks at 11 bits of a value per pass.
+const uint cRadixBits = 11;
+const uint cRadixBuckets = 1 << cRadixBits;
+const uint cRadixPasses = 3;
+
+// Flips the bits of a float so that comparing the bits as unsigned
+// integers gives the same order as comparing the floats.
+inline uint SortableKey(float value)
+{
+  uint bits;
+  memcpy(&bits, &value, sizeof(bits));
+  const uint signBit = (uint)1 << 31;
+  // negative values sort in reverse so flip all of their bits
+  if (bits & signBit)
+    return ~bits;
+  return bits | signBit;
+}
+
 } // namespace SapInternal
 
 namespace Zero
@@ -96,13 +114,14 @@ void Sap<ClientDataType>::CreateProxies(DataObjectArray& objects)
   }
 
   // sort all of the endpoints to be in the correct spot
-  uint startIndex;
-  BatchSort<0>(newEndpoints[0]);
-  BatchSort<1>(newEndpoints[1]);
-  startIndex = BatchSort<2>(newEndpoints[2]);
+  uint startIndex[3];
+  startIndex[0] = BatchSort<0>(newEndpoints[0]);
+  startIndex[1] = BatchSort<1>(newEndpoints[1]);
+  startIndex[2] = BatchSort<2>(newEndpoints[2]);
 
   // add all of the pairs that we just created
-  BatchPairAdd<2>(startIndex);
+  uint sweepAxis = ChooseSweepAxis(insertBoxes);
+  SweepPairAdd(sweepAxis, startIndex[sweepAxis]);
 
   // fill back out the obj ptr that we used to
   // signify this box was just added
@@ -182,6 +201,14 @@ void Sap<ClientDataType>::UpdateProxy(BroadPhaseProxy& proxy, DataType& data)
 template <typename ClientDataType>
 void Sap<ClientDataType>::UpdateProxies(DataObjectArray& objects)
 {
+  // Large updates are sorted in one batch so that objects moving far
+  // (or all at once) don't shift past every endpoint in between
+  if (objects.Size() > 1 && real(objects.Size()) >= mBatchRatio * real(GetLiveBoxCount()))
+  {
+    BatchUpdateProxies(objects);
+    return;
+  }
+
   typename DataObjectArray::range range = objects.All();
   while (!range.Empty())
   {
@@ -192,6 +219,18 @@ void Sap<ClientDataType>::UpdateProxies(DataObjectArray& objects)
   }
 }
 
+template <typename ClientDataType>
+void Sap<ClientDataType>::SetBatchRatio(real ratio)
+{
+  mBatchRatio = Math::Max(ratio, real(0.0));
+}
+
+template <typename ClientDataType>
+real Sap<ClientDataType>::GetBatchRatio() const
+{
+  return mBatchRatio;
+}
+
 template <typename ClientDataType>
 template <typename QueryType, typename PolicyType>
 SapRange<ClientDataType, QueryType> Sap<ClientDataType>::QueryWithPolicy(const QueryType& queryObj, PolicyType policy)
@@ -372,6 +411,9 @@ void Sap<ClientDataType>::Setup()
   // for 300 boxes. This is just the value that I currently use
   // in my game.
   uint objectStartSize = 300;
+  // Batching is opt in, the incremental path is cheaper for ordinary
+  // amounts of movement (see PhysicsBenchmark to compare the two)
+  mBatchRatio = Math::PositiveMax();
   mBoxes.Reserve(objectStartSize);
   mIndices.Reserve(objectStartSize * 6);
   mAxes[0].Reserve(objectStartSize * 2);
@@ -436,6 +478,13 @@ uint Sap<ClientDataType>::GetNewBoxIndex()
   return index;
 }
 
+template <typename ClientDataType>
+uint Sap<ClientDataType>::GetLiveBoxCount() const
+{
+  // ignore the sentinel
+  return mBoxes.Size() - 1 - mOpenIndices.Size();
+}
+
 template <typename ClientDataType>
 uint Sap<ClientDataType>::GetBoxIndex(uint axis, uint index)
 {
@@ -540,12 +589,183 @@ void Sap<ClientDataType>::RemoveWithSet(BoxSet& boxSet, uint boxIndex)
   }
 }
 
+template <typename ClientDataType>
+void Sap<ClientDataType>::BatchUpdateProxies(DataObjectArray& objects)
+{
+  mBatchBoxes.Clear();
+  for (uint i = 0; i < objects.Size(); ++i)
+  {
+    uint index = objects[i].mProxy->ToU32();
+    ErrorIf(index >= mBoxes.Size() || (mBoxes[index].mObj == nullptr && !mBatchBoxes.Contains(index)),
+            "Invalid proxy updated. Proxy did not reference a valid object.");
+
+    // mark the box as being updated by nulling it's obj ptr (the same
+    // way CreateProxies and RemoveProxies mark the boxes they change)
+    if (mBoxes[index].mObj != nullptr)
+    {
+      mBoxes[index].mObj = nullptr;
+      mBatchBoxes.PushBack(index);
+    }
+  }
+
+  // remove every pair involving an updated box while the endpoints are
+  // still sorted by the old positions
+  SweepPairRemove(ChooseSweepAxis(mBatchBoxes));
+
+  for (uint i = 0; i < objects.Size(); ++i)
+  {
+    DataObjectType& object = objects[i];
+    BoxType& box = mBoxes[object.mProxy->ToU32()];
+    box.mData.mClientData = object.mData.mClientData;
+    box.UpdateBox(0, object.mData);
+    box.UpdateBox(1, object.mData);
+    box.UpdateBox(2, object.mData);
+  }
+
+  // pull the old endpoints out of each axis and merge the new ones back in
+  uint startIndex[3];
+  BatchEndPointRemove<0>();
+  GatherEndPoints<0>(mBatchBoxes, mBatchEndPoints);
+  startIndex[0] = BatchSort<0>(mBatchEndPoints);
+  BatchEndPointRemove<1>();
+  GatherEndPoints<1>(mBatchBoxes, mBatchEndPoints);
+  startIndex[1] = BatchSort<1>(mBatchEndPoints);
+  BatchEndPointRemove<2>();
+  GatherEndPoints<2>(mBatchBoxes, mBatchEndPoints);
+  startIndex[2] = BatchSort<2>(mBatchEndPoints);
+
+  // the boxes may be spread out differently now so choose the axis again
+  uint sweepAxis = ChooseSweepAxis(mBatchBoxes);
+  SweepPairAdd(sweepAxis, startIndex[sweepAxis]);
+
+  for (uint i = 0; i < mBatchBoxes.Size(); ++i)
+  {
+    uint boxIndex = mBatchBoxes[i];
+    mBoxes[boxIndex].mObj = &mBoxes[boxIndex].mData;
+  }
+}
+
+template <typename ClientDataType>
+uint Sap<ClientDataType>::ChooseSweepAxis(Array<uint>& boxes)
+{
+  if (boxes.Empty())
+    return 2;
+
+  // find the variance of the box centers on each axis
+  Vec3 sum = Vec3::cZero;
+  Vec3 sumSquared = Vec3::cZero;
+  for (uint i = 0; i < boxes.Size(); ++i)
+  {
+    BoxType& box = mBoxes[boxes[i]];
+    Vec3 center = (box.mMins + box.mMaxs) * real(0.5);
+    sum += center;
+    sumSquared += center * center;
+  }
+
+  real count = real(boxes.Size());
+  Vec3 mean = sum / count;
+  Vec3 variance = sumSquared / count - mean * mean;
+
+  uint axis = 2;
+  if (variance[0] > variance[axis])
+    axis = 0;
+  if (variance[1] > variance[axis])
+    axis = 1;
+  return axis;
+}
+
+template <typename ClientDataType>
+void Sap<ClientDataType>::SweepPairAdd(uint axis, uint startIndex)
+{
+  if (axis == 0)
+    BatchPairAdd<0>(startIndex);
+  else if (axis == 1)
+    BatchPairAdd<1>(startIndex);
+  else
+    BatchPairAdd<2>(startIndex);
+}
+
+template <typename ClientDataType>
+void Sap<ClientDataType>::SweepPairRemove(uint axis)
+{
+  if (axis == 0)
+    BatchPairRemove<0>();
+  else if (axis == 1)
+    BatchPairRemove<1>();
+  else
+    BatchPairRemove<2>();
+}
+
+template <typename ClientDataType>
+template <uint Axis>
+void Sap<ClientDataType>::GatherEndPoints(Array<uint>& boxes, EndPointArray& endpoints)
+{
+  endpoints.Clear();
+  endpoints.Reserve(boxes.Size() * 2);
+  for (uint i = 0; i < boxes.Size(); ++i)
+  {
+    uint index = boxes[i];
+    BoxType& box = mBoxes[index];
+    endpoints.PushBack(EndPointType(GetBoxMin(Axis, index), true, box.mMins[Axis]));
+    endpoints.PushBack(EndPointType(GetBoxMax(Axis, index), false, box.mMaxs[Axis]));
+  }
+}
+
+template <typename ClientDataType>
+void Sap<ClientDataType>::RadixSort(EndPointArray& endpoints)
+{
+  uint count = endpoints.Size();
+  if (count < 2)
+    return;
+
+  mSortScratch.Resize(count);
+  EndPointArray* source = &endpoints;
+  EndPointArray* destination = &mSortScratch;
+
+  uint bucketStarts[SapInternal::cRadixBuckets];
+  for (uint pass = 0; pass < SapInternal::cRadixPasses; ++pass)
+  {
+    uint shift = pass * SapInternal::cRadixBits;
+    uint mask = SapInternal::cRadixBuckets - 1;
+
+    memset(bucketStarts, 0, sizeof(bucketStarts));
+    EndPointArray& from = *source;
+    for (uint i = 0; i < count; ++i)
+      ++bucketStarts[(SapInternal::SortableKey(from[i].mVal) >> shift) & mask];
+
+    // values that are close together often share all of these bits
+    // (typically the exponent) so there's nothing to sort on this pass
+    uint firstBucket = (SapInternal::SortableKey(from[0].mVal) >> shift) & mask;
+    if (bucketStarts[firstBucket] == count)
+      continue;
+
+    // turn the counts into the start of each bucket
+    uint total = 0;
+    for (uint bucket = 0; bucket < SapInternal::cRadixBuckets; ++bucket)
+    {
+      uint bucketCount = bucketStarts[bucket];
+      bucketStarts[bucket] = total;
+      total += bucketCount;
+    }
+
+    // scatter in order so that the sort is stable (a box's min stays
+    // in front of its max when they are equal)
+    EndPointArray& to = *destination;
+    for (uint i = 0; i < count; ++i)
+      to[bucketStarts[(SapInternal::SortableKey(from[i].mVal) >> shift) & mask]++] = from[i];
+
+    Swap(source, destination);
+  }
+
+  if (source != &endpoints)
+    endpoints.Swap(mSortScratch);
+}
+
 template <typename ClientDataType>
 template <uint Axis>
 uint Sap<ClientDataType>::BatchSort(EndPointArray& newEndpoints)
 {
-  // reverse sort the new endpoints
-  Zero::Sort(newEndpoints.All(), greater<EndPointType>());
+  RadixSort(newEndpoints);
 
   EndPointArray& axis = mAxes[Axis];
 
@@ -554,21 +774,21 @@ uint Sap<ClientDataType>::BatchSort(EndPointArray& newEndpoints)
   uint insertIndex = axis.Size() - 1;
 
   // loop from the end to the front while we still have new endpoints to Insert
-  Array<EndPointType>::range newRange = newEndpoints.All();
-  while (!newRange.Empty())
+  uint newPos = newEndpoints.Size();
+  while (newPos > 0)
   {
     // check to see which is larger between the old max endpoint
     // and the new max endpoint. Take whichever was larger and Insert
     // it at the Insert position then move to the next element.
-    if (axis[oldPos] > newRange.Front())
+    if (axis[oldPos] > newEndpoints[newPos - 1])
     {
       axis[insertIndex] = axis[oldPos];
       --oldPos;
     }
     else
     {
-      axis[insertIndex] = newRange.Front();
-      newRange.PopFront();
+      axis[insertIndex] = newEndpoints[newPos - 1];
+      --newPos;
     }
 
     // fix the index of the updated endpoint
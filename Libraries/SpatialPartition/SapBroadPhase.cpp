@@ -115,4 +115,14 @@ void SapBroadPhase::RegisterCollisions()
 {
 }
 
+void SapBroadPhase::SetBatchRatio(real ratio)
+{
+  mSap.SetBatchRatio(ratio);
+}
+
+real SapBroadPhase::GetBatchRatio() const
+{
+  return mSap.GetBatchRatio();
+}
+
 } // namespace Zero
@@ -40,6 +40,11 @@ public:
 
   virtual void Cleanup(){};
 
+  /// The fraction of the proxies an UpdateProxies call has to move before
+  /// Sap sorts them in one batch. See Sap::SetBatchRatio.
+  void SetBatchRatio(real ratio);
+  real GetBatchRatio() const;
+
 private:
   BroadPhaseType mSap;
   Sap<int> temp;
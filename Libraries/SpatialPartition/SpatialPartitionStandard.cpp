@@ -13,8 +13,10 @@ ZilchDefineStaticLibrary(SpatialPartitionLibrary)
   ZilchInitializeType(BoundingBoxBroadPhase);
   ZilchInitializeType(BoundingSphereBroadPhase);
   ZilchInitializeType(StaticAabbTreeBroadPhase);
+  ZilchInitializeType(FlatAabbTreeBroadPhase);
   ZilchInitializeType(SapBroadPhase);
   ZilchInitializeType(DynamicAabbTreeBroadPhase);
+  ZilchInitializeType(RefitDynamicAabbTreeBroadPhase);
   ZilchInitializeType(AvlDynamicAabbTreeBroadPhase);
   ZilchInitializeType(DynamicBroadphasePropertyExtension);
   ZilchInitializeType(StaticBroadphasePropertyExtension);
@@ -26,6 +26,8 @@ public:
 #include "BroadPhase.hpp"
 #include "SimpleCastCallbacks.hpp"
 #include "BroadPhaseRanges.hpp"
+#include "AabbTreeNode.hpp"
+#include "AabbTreeMethods.hpp"
 #include "BaseDynamicAabbTreeBroadPhase.hpp"
 #include "DynamicTreeHelpers.hpp"
 #include "BaseDynamicAabbTree.hpp"
@@ -43,8 +45,7 @@ public:
 #include "SapContainers.hpp"
 #include "Sap.hpp"
 #include "SapBroadPhase.hpp"
-#include "AabbTreeNode.hpp"
-#include "AabbTreeMethods.hpp"
+#include "FlatAabbTree.hpp"
 #include "StaticAabbTree.hpp"
 #include "StaticAabbTreeBroadPhase.hpp"
 #include "BroadPhasePackage.hpp"
@@ -37,7 +37,8 @@ struct StaticTreeRange
 /// case where objects are not moving over the DynamicAabbTree because more time
 /// is spent in building the tree. This allows the tree to build itself more
 /// optimally. Adds, updates and removes will not take effect until construct is
-/// called.
+/// called. When flattened, construct also bakes the tree into an array of
+/// FlatAabbNodes that queries can walk without chasing pointers.
 template <typename ClientDataType>
 class StaticAabbTree
 {
@@ -51,6 +52,8 @@ public:
 
   typedef Pair<NodePointer, DataType> UpdatePair;
   typedef Array<UpdatePair> UpdateArray;
+  typedef Array<FlatAabbNode> FlatNodeArray;
+  typedef Array<ClientDataType> FlatLeafArray;
 
   StaticAabbTree();
   ~StaticAabbTree();
@@ -123,9 +126,30 @@ public:
     return RangeType(&scratchBuffer, mRoot, queryObj);
   }
 
+  /// Returns a range to iterate through the leaves of the flattened tree that
+  /// collide with the object of QueryType. The scratch buffer is used as the
+  /// traversal stack and must hold GetFlatStackSize elements. In general, one
+  /// should use the forRangeFlatBroadphaseTree macro instead of calling this
+  /// directly. Only valid when the tree is flattened.
+  template <typename QueryType, typename ArrayType>
+  FlatTreeRange<ClientDataType, QueryType, ArrayType> QueryFlat(const QueryType& queryObj, ArrayType& scratchBuffer)
+  {
+    typedef FlatTreeRange<ClientDataType, QueryType, ArrayType> RangeType;
+
+    return RangeType(&scratchBuffer, &mFlatNodes, &mFlatLeaves, queryObj);
+  }
+
   /// Sets the current partition method.
   void SetPartitionMethod(PartitionMethods::Enum method);
 
+  /// Whether or not construct bakes the tree into a flat array. Flattened trees
+  /// are always built with the surface area heuristic since they are meant for
+  /// geometry that is cast against far more often than it is rebuilt.
+  bool GetFlattened() const;
+  void SetFlattened(bool flattened);
+  /// The number of elements needed for the traversal stack of QueryFlat.
+  uint GetFlatStackSize() const;
+
 private:
   template <typename ClientDataTypeOther>
   friend void SerializeAabbTree(Serializer& stream, StaticAabbTree<ClientDataTypeOther>& tree);
@@ -141,6 +165,10 @@ private:
   /// not in the removal set into the passed in array.
   void DeleteInternalNodes(NodeArray& leafNodes);
 
+  /// Bakes the current tree into the flat node array.
+  void Flatten();
+  uint FlattenNode(NodePointer node, uint depth);
+
   ConstructionMethod mConstructMethod;
   StopCriteria mStopCriteria;
   uint mXPrimitives;
@@ -152,6 +180,12 @@ private:
   NodeSet mNodesRemoved;
 
   uint mProxyCount;
+
+  bool mFlattened;
+  FlatNodeArray mFlatNodes;
+  FlatLeafArray mFlatLeaves;
+  /// The depth of the deepest leaf in the flat tree.
+  uint mFlatDepth;
 };
 
 typedef StaticAabbTree<void*> StaticAabbTreeDefault;
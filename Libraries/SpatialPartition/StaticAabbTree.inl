@@ -8,6 +8,8 @@ StaticAabbTree<ClientDataType>::StaticAabbTree()
 {
   mRoot = nullptr;
   mProxyCount = 0;
+  mFlattened = false;
+  mFlatDepth = 0;
 
   mConstructMethod = TopDown;
   mStopCriteria = XPrimitives;
@@ -132,8 +134,14 @@ void StaticAabbTree<ClientDataType>::Construct()
     return;
 
   // now build the tree from all of these leaf nodes
-  mRoot = BuildTreeTopDownNodes<NodeType>(mNodesAdded, CurrPartitionMethod);
+  PartitionNodeMethodPtr partitionMethod = CurrPartitionMethod;
+  if (mFlattened)
+    partitionMethod = &MinimizeSurfaceAreaSumNodes<NodeType>;
+  mRoot = BuildTreeTopDownNodes<NodeType>(mNodesAdded, partitionMethod);
   mNodesAdded.Clear();
+
+  if (mFlattened)
+    Flatten();
 }
 
 template <typename ClientDataType>
@@ -205,6 +213,76 @@ void StaticAabbTree<ClientDataType>::SetPartitionMethod(PartitionMethods::Enum m
     CurrPartitionMethod = &MidPointNodes<NodeType>;
 }
 
+template <typename ClientDataType>
+bool StaticAabbTree<ClientDataType>::GetFlattened() const
+{
+  return mFlattened;
+}
+
+template <typename ClientDataType>
+void StaticAabbTree<ClientDataType>::SetFlattened(bool flattened)
+{
+  mFlattened = flattened;
+  if (mFlattened)
+  {
+    Flatten();
+  }
+  else
+  {
+    mFlatNodes.Clear();
+    mFlatLeaves.Clear();
+    mFlatDepth = 0;
+  }
+}
+
+template <typename ClientDataType>
+uint StaticAabbTree<ClientDataType>::GetFlatStackSize() const
+{
+  // A traversal holds at most one second child per level of the tree
+  return mFlatDepth + 1;
+}
+
+template <typename ClientDataType>
+void StaticAabbTree<ClientDataType>::Flatten()
+{
+  mFlatNodes.Clear();
+  mFlatLeaves.Clear();
+  mFlatDepth = 0;
+
+  if (mRoot == nullptr)
+    return;
+
+  // A binary tree with n leaves has 2n - 1 nodes
+  mFlatNodes.Reserve(mProxyCount * 2);
+  mFlatLeaves.Reserve(mProxyCount);
+  FlattenNode(mRoot, 0);
+}
+
+template <typename ClientDataType>
+uint StaticAabbTree<ClientDataType>::FlattenNode(NodePointer node, uint depth)
+{
+  uint index = mFlatNodes.Size();
+  FlatAabbNode& flatNode = mFlatNodes.PushBack();
+  flatNode.mAabb = node->mAabb;
+  mFlatDepth = Math::Max(mFlatDepth, depth);
+
+  if (node->IsLeaf())
+  {
+    flatNode.mSecondChild = FlatAabbNode::cLeaf;
+    flatNode.mLeafIndex = mFlatLeaves.Size();
+    mFlatLeaves.PushBack(node->mClientData);
+    return index;
+  }
+
+  // The first child is written directly after this node (depth-first order).
+  // The node is looked up again since the array may have grown.
+  FlattenNode(node->mChild1, depth + 1);
+  uint secondChild = FlattenNode(node->mChild2, depth + 1);
+  mFlatNodes[index].mSecondChild = secondChild;
+  mFlatNodes[index].mLeafIndex = 0;
+  return index;
+}
+
 template <typename ClientDataType>
 void StaticAabbTree<ClientDataType>::DrawTree(NodePointer node)
 {
@@ -253,6 +331,9 @@ void StaticAabbTree<ClientDataType>::DeleteInternalNodes(Array<NodePointer>& lea
 
   mRoot = nullptr;
   mNodesRemoved.Clear();
+  mFlatNodes.Clear();
+  mFlatLeaves.Clear();
+  mFlatDepth = 0;
 }
 
 template <typename ClientDataType>
@@ -271,6 +352,8 @@ void SerializeAabbTree(Serializer& stream, StaticAabbTree<ClientDataType>& tree)
     {
       tree.mRoot = SerializeAabbTree<ClientDataType>(stream);
       tree.CountProxies();
+      if (tree.mFlattened)
+        tree.Flatten();
       stream.EndPolymorphic();
     }
   }
@@ -7,6 +7,15 @@ ZilchDefineType(StaticAabbTreeBroadPhase, builder, type)
 {
 }
 
+ZilchDefineType(FlatAabbTreeBroadPhase, builder, type)
+{
+}
+
+FlatAabbTreeBroadPhase::FlatAabbTreeBroadPhase()
+{
+  mTree.SetFlattened(true);
+}
+
 void StaticAabbTreeBroadPhase::Serialize(Serializer& stream)
 {
   IBroadPhase::Serialize(stream);
@@ -73,6 +82,13 @@ void StaticAabbTreeBroadPhase::SelfQuery(ClientPairArray& results)
 
 void StaticAabbTreeBroadPhase::Query(BroadPhaseData& data, ClientPairArray& results)
 {
+  if (mTree.GetFlattened())
+  {
+    forRangeFlatBroadphaseTree(TreeType, mTree, Aabb, data.mAabb)
+        results.PushBack(ClientPair(data.mClientData, range.Front()));
+    return;
+  }
+
   forRangeBroadphaseTree(TreeType, mTree, Aabb, data.mAabb)
       results.PushBack(ClientPair(data.mClientData, range.Front()));
 }
@@ -93,6 +109,12 @@ void StaticAabbTreeBroadPhase::CastRay(CastDataParam data, ProxyCastResults& res
 {
   SimpleRayCallback callback(mCastRayCallBack, &results);
 
+  if (mTree.GetFlattened())
+  {
+    forRangeFlatBroadphaseTree(TreeType, mTree, Ray, data.GetRay()) callback.Refine(range.Front(), data);
+    return;
+  }
+
   forRangeBroadphaseTree(TreeType, mTree, Ray, data.GetRay()) callback.Refine(range.Front(), data);
 }
 
@@ -100,6 +122,12 @@ void StaticAabbTreeBroadPhase::CastSegment(CastDataParam data, ProxyCastResults&
 {
   SimpleSegmentCallback callback(mCastSegmentCallBack, &results);
 
+  if (mTree.GetFlattened())
+  {
+    forRangeFlatBroadphaseTree(TreeType, mTree, Segment, data.GetSegment()) callback.Refine(range.Front(), data);
+    return;
+  }
+
   forRangeBroadphaseTree(TreeType, mTree, Segment, data.GetSegment()) callback.Refine(range.Front(), data);
 }
 
@@ -107,6 +135,12 @@ void StaticAabbTreeBroadPhase::CastAabb(CastDataParam data, ProxyCastResults& re
 {
   SimpleAabbCallback callback(mCastAabbCallBack, &results);
 
+  if (mTree.GetFlattened())
+  {
+    forRangeFlatBroadphaseTree(TreeType, mTree, Aabb, data.GetAabb()) callback.Refine(range.Front(), data);
+    return;
+  }
+
   forRangeBroadphaseTree(TreeType, mTree, Aabb, data.GetAabb()) callback.Refine(range.Front(), data);
 }
 
@@ -114,6 +148,12 @@ void StaticAabbTreeBroadPhase::CastSphere(CastDataParam data, ProxyCastResults&
 {
   SimpleSphereCallback callback(mCastSphereCallBack, &results);
 
+  if (mTree.GetFlattened())
+  {
+    forRangeFlatBroadphaseTree(TreeType, mTree, Sphere, data.GetSphere()) callback.Refine(range.Front(), data);
+    return;
+  }
+
   forRangeBroadphaseTree(TreeType, mTree, Sphere, data.GetSphere()) callback.Refine(range.Front(), data);
 }
 
@@ -121,6 +161,12 @@ void StaticAabbTreeBroadPhase::CastFrustum(CastDataParam data, ProxyCastResults&
 {
   SimpleFrustumCallback callback(mCastFrustumCallBack, &results);
 
+  if (mTree.GetFlattened())
+  {
+    forRangeFlatBroadphaseTree(TreeType, mTree, Frustum, data.GetFrustum()) callback.Refine(range.Front(), data);
+    return;
+  }
+
   forRangeBroadphaseTree(TreeType, mTree, Frustum, data.GetFrustum()) callback.Refine(range.Front(), data);
 }
 
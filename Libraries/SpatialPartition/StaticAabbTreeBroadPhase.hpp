@@ -37,9 +37,20 @@ public:
   virtual void RegisterCollisions(){};
   virtual void Cleanup(){};
 
-private:
+protected:
   typedef StaticAabbTreeDefault TreeType;
   StaticAabbTreeDefault mTree;
 };
 
+/// A StaticAabbTreeBroadPhase that bakes its tree into a flat, depth-first
+/// array every time it is constructed. Rebuilding is slower, but queries walk
+/// an array of 32 byte nodes instead of chasing pointers through the tree.
+class FlatAabbTreeBroadPhase : public StaticAabbTreeBroadPhase
+{
+public:
+  ZilchDeclareType(FlatAabbTreeBroadPhase, TypeCopyMode::ReferenceType);
+
+  FlatAabbTreeBroadPhase();
+};
+
 } // namespace Zero
@@ -260,6 +260,14 @@ void ZeroStartup::Startup()
   if (mLoadContent)
     LoadContentConfig();
 
+  auto graphics = engine->has(GraphicsEngine);
+  if (!mCreateMainWindow)
+  {
+    // Without a window to present to the rendering pipeline still runs, nothing is drawn.
+    graphics->CreateRenderer(nullptr);
+    return;
+  }
+
   ZPrint("Creating main window.\n");
 
   OsShell* osShell = engine->has(OsShell);
@@ -311,7 +319,6 @@ void ZeroStartup::Startup()
   mainWindow->SetMinClientSize(minSize);
 
   // Pass window handle to initialize the graphics api
-  auto graphics = engine->has(GraphicsEngine);
   graphics->CreateRenderer(mainWindow);
 
   if (mUseSplashScreen)
@@ -46,6 +46,8 @@ protected:
   // If changes are ever made to these flags (especially mWindowStyle), ALL platforms and programs
   // (Editor/Game/Launcher) must be considered.
   bool mLoadContent = true;
+  // If false, no main window is created (mMainWindow stays null) and graphics runs on the EmptyRenderer.
+  bool mCreateMainWindow = true;
   WindowState::Enum mWindowState = WindowState::Maximized;
   // If this value is IntVec2::cZero, the primary monitor usable size will be used.
   IntVec2 mWindowSize = IntVec2::cZero;
@@ -0,0 +1,41 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+BenchmarkTimer::BenchmarkTimer() : mTotalSeconds(0.0)
+{
+}
+
+void BenchmarkTimer::Start()
+{
+  mTimer.Reset();
+}
+
+void BenchmarkTimer::Stop()
+{
+  mTotalSeconds += mTimer.UpdateAndGetTime();
+}
+
+double BenchmarkTimer::GetTotalSeconds() const
+{
+  return mTotalSeconds;
+}
+
+double BenchmarkTimer::GetMsPerRun(uint runs) const
+{
+  return mTotalSeconds * 1000.0 / double(Math::Max(runs, 1u));
+}
+
+void PrintBenchmarkResult(cstr benchmarkName, cstr resultFormat, ...)
+{
+  va_list va;
+  va_start(va, resultFormat);
+  String result = String::FormatArgs(resultFormat, va);
+  va_end(va);
+
+  ZPrint("%s: %s\n", benchmarkName, result.c_str());
+}
+
+} // namespace Zero
@@ -0,0 +1,34 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+/// Accumulates the time spent in the timed sections of a benchmark, so that
+/// the setup done between sections (creating data, resetting state) isn't
+/// counted.
+class BenchmarkTimer
+{
+public:
+  BenchmarkTimer();
+
+  /// Starts timing a section.
+  void Start();
+  /// Stops timing the current section and adds it to the total.
+  void Stop();
+
+  /// Total time of every timed section in seconds.
+  double GetTotalSeconds() const;
+  /// Average time in milliseconds of each of the given number of runs.
+  double GetMsPerRun(uint runs) const;
+
+private:
+  Timer mTimer;
+  double mTotalSeconds;
+};
+
+/// Prints one benchmark result line as "<benchmarkName>: <result>" (the result
+/// is printf formatted).
+void PrintBenchmarkResult(cstr benchmarkName, cstr resultFormat, ...);
+
+} // namespace Zero
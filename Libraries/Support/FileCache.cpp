@@ -0,0 +1,134 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Zero
+{
+
+namespace
+{
+// An entry in the cache, used to find the least recently used entries
+struct FileCacheEntry
+{
+  String mPath;
+  bool mIsDirectory;
+  u64 mSize;
+  TimeType mLastUsed;
+};
+
+struct SortByLeastRecentlyUsed
+{
+  bool operator()(const FileCacheEntry& left, const FileCacheEntry& right)
+  {
+    return left.mLastUsed < right.mLastUsed;
+  }
+};
+
+// Counts the temporary files written by this process
+Atomic<s64> gTempFileCount;
+} // namespace
+
+// Unique per writer (the process id separates processes and the count
+// separates threads) so that writers storing the same entry don't collide
+static String GetTempFile(StringParam file)
+{
+  return String::Format("%s.%llx.%llx.tmp",
+                        file.c_str(),
+                        (unsigned long long)Process::GetCurrentProcessId(),
+                        (unsigned long long)gTempFileCount.FetchAdd(1));
+}
+
+String FileCache::GetEntryPath(StringParam cachePath, StringParam key, StringParam extension)
+{
+  // Split the entries into sub directories to keep directories small
+  String prefix = key.SubStringFromByteIndices(0, 2);
+  return FilePath::Combine(cachePath, prefix, BuildString(key, extension));
+}
+
+bool FileCache::StoreFile(StringParam file, const byte* data, size_t size)
+{
+  CreateDirectoryAndParents(FilePath::GetDirectoryPath(file));
+
+  String tempFile = GetTempFile(file);
+  if (WriteToFile(tempFile.c_str(), data, size) == size && MoveFile(file, tempFile))
+    return true;
+
+  DeleteFile(tempFile);
+  return false;
+}
+
+bool FileCache::StoreFileCopy(StringParam file, StringParam sourceFile)
+{
+  CreateDirectoryAndParents(FilePath::GetDirectoryPath(file));
+
+  String tempFile = GetTempFile(file);
+  if (CopyFile(tempFile, sourceFile) && MoveFile(file, tempFile))
+    return true;
+
+  DeleteFile(tempFile);
+  return false;
+}
+
+void FileCache::Trim(StringParam cachePath, u64 maxSize)
+{
+  if (cachePath.Empty() || !DirectoryExists(cachePath))
+    return;
+
+  // Gather every entry (the entries are split into prefix directories)
+  Array<FileCacheEntry> entries;
+  u64 totalSize = 0;
+  for (FileRange prefixes(cachePath); !prefixes.Empty(); prefixes.PopFront())
+  {
+    String prefixDirectory = FilePath::Combine(cachePath, prefixes.Front());
+    if (!DirectoryExists(prefixDirectory))
+      continue;
+
+    for (FileRange keys(prefixDirectory); !keys.Empty(); keys.PopFront())
+    {
+      FileEntry key = keys.FrontEntry();
+      FileCacheEntry& entry = entries.PushBack();
+      entry.mPath = key.GetFullPath();
+      entry.mIsDirectory = DirectoryExists(entry.mPath);
+      entry.mSize = 0;
+      entry.mLastUsed = 0;
+
+      if (entry.mIsDirectory)
+      {
+        for (FileRange files(entry.mPath); !files.Empty(); files.PopFront())
+        {
+          FileEntry file = files.FrontEntry();
+          entry.mSize += file.mSize;
+          entry.mLastUsed = Math::Max(entry.mLastUsed, GetFileModifiedTime(file.GetFullPath()));
+        }
+      }
+      else
+      {
+        entry.mSize = key.mSize;
+        entry.mLastUsed = GetFileModifiedTime(entry.mPath);
+      }
+      totalSize += entry.mSize;
+    }
+  }
+
+  if (totalSize <= maxSize)
+    return;
+
+  // Remove the least recently used entries until the cache fits
+  Sort(entries.All(), SortByLeastRecentlyUsed());
+  forRange (FileCacheEntry& entry, entries.All())
+  {
+    if (totalSize <= maxSize)
+      break;
+
+    bool removed = entry.mIsDirectory ? DeleteDirectory(entry.mPath) : DeleteFile(entry.mPath);
+    if (removed)
+      totalSize -= entry.mSize;
+  }
+}
+
+void FileCache::Clear(StringParam cachePath)
+{
+  if (!cachePath.Empty() && DirectoryExists(cachePath))
+    DeleteDirectoryContents(cachePath);
+}
+
+} // namespace Zero
@@ -0,0 +1,33 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Zero
+{
+
+// Layout and upkeep shared by the content addressed caches on disk (such as
+// the content build cache and the shader cache). Each entry is a file or a
+// directory named by its key, placed in a sub directory named by the first two
+// characters of the key. Multiple processes may share a cache.
+class FileCache
+{
+public:
+  // Path of the entry for the key (the extension is appended to the key).
+  static String GetEntryPath(StringParam cachePath, StringParam key, StringParam extension = String());
+
+  // Writes the data to the file through a unique temporary file and a move so
+  // that readers never see a partially written file. Returns false if the file
+  // couldn't be stored.
+  static bool StoreFile(StringParam file, const byte* data, size_t size);
+  // Same as StoreFile, copying the contents of the source file.
+  static bool StoreFileCopy(StringParam file, StringParam sourceFile);
+
+  // Removes the least recently used entries until the cache is no larger than
+  // maxSize (in bytes). An entry was last used when any of its files was last
+  // modified, so restoring an entry should touch its files.
+  static void Trim(StringParam cachePath, u64 maxSize);
+
+  // Removes every entry from the cache.
+  static void Clear(StringParam cachePath);
+};
+
+} // namespace Zero
@@ -6,6 +6,7 @@
 
 #include "Urls.hpp"
 #include "FileSupport.hpp"
+#include "FileCache.hpp"
 #include "Profiler.hpp"
 #include "NameValidation.hpp"
 #include "ChunkReader.hpp"
@@ -18,3 +19,4 @@
 #include "PngSupport.hpp"
 #include "HdrSupport.hpp"
 #include "BuildVersion.hpp"
+#include "Benchmark.hpp"
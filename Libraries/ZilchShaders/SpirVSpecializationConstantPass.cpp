@@ -52,6 +52,11 @@ bool SpirVSpecializationConstantPass::RunTranslationPass(ShaderTranslationPassRe
   return success;
 }
 
+String SpirVSpecializationConstantPass::GetCacheDescription()
+{
+  return String::Format("SpirVSpecializationConstantPass:%d:%d", mTargetEnv, (int)mFreezeAllConstants);
+}
+
 void SpirVSpecializationConstantPass::GetSpecializationFlags(Array<String>& outFlags,
                                                              ShaderStageInterfaceReflection& inputStageReflection,
                                                              ShaderStageInterfaceReflection& outputStageReflection)
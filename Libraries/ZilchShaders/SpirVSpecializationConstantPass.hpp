@@ -45,6 +45,9 @@ class SpirVSpecializationConstantPass : public BaseSpirVOptimizerPass
 public:
   SpirVSpecializationConstantPass();
   bool RunTranslationPass(ShaderTranslationPassResult& inputData, ShaderTranslationPassResult& outputData) override;
+  /// Values set through CollectSpecializationConstants aren't part of the
+  /// description, a pass with listeners shouldn't be cached.
+  String GetCacheDescription() override;
 
   void GetSpecializationFlags(Array<String>& outFlags,
                               ShaderStageInterfaceReflection& inputStageReflection,
@@ -126,6 +126,11 @@ bool SpirVOptimizerPass::RunTranslationPass(ShaderTranslationPassResult& inputDa
   return success;
 }
 
+String SpirVOptimizerPass::GetCacheDescription()
+{
+  return String::Format("SpirVOptimizerPass:%d:%d", (int)SPV_OPTIMIZER_SIZE_PASS, mTargetEnv);
+}
+
 SpirVValidatorPass::SpirVValidatorPass()
 {
   mTargetEnv = SPV_ENV_UNIVERSAL_1_3;
@@ -50,6 +50,7 @@ class SpirVOptimizerPass : public BaseSpirVOptimizerPass
 {
 public:
   bool RunTranslationPass(ShaderTranslationPassResult& inputData, ShaderTranslationPassResult& outputData) override;
+  String GetCacheDescription() override;
 };
 
 /// Runs the spir-v validator tool over the given input data. The output data
@@ -40,6 +40,14 @@ public:
     return String();
   }
 
+  /// Returns the name of the pass and the value of every setting that changes
+  /// its output. Used to key caches of translated shaders, a pass that returns
+  /// an empty string can't have its results cached.
+  virtual String GetCacheDescription()
+  {
+    return String();
+  }
+
   ZilchRefLink(ZilchShaderIRTranslationPass);
 
 protected: